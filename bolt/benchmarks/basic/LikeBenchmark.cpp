@@ -32,6 +32,7 @@
 #include <folly/init/Init.h>
 
 #include "bolt/benchmarks/ExpressionBenchmarkBuilder.h"
+#include "bolt/functions/lib/MultiPatternMatch.h"
 #include "bolt/functions/lib/Re2Functions.h"
 #include "bolt/functions/prestosql/registration/RegistrationFunctions.h"
 #include "bolt/functions/sparksql/ICURegexFunctions.h"
@@ -55,6 +56,9 @@ int main(int argc, char** argv) {
       "re2_rlike", re2SearchSignatures(), makeRLike);
   // Register the scalar functions.
   prestosql::registerAllScalarFunctions("");
+  // Evaluate OR chains as written so that they can be compared with the
+  // explicit multi_like_any calls below.
+  unregisterMultiLikeRewrites();
 
   // exec::register
   ExpressionBenchmarkBuilder benchmarkBuilder;
@@ -120,6 +124,38 @@ int main(int argc, char** argv) {
           "like_icu", vectorMaker.rowVector({"col0"}, {substringInput}))
       .addExpression("icu_rlike", R"(icu_rlike(col0, 'a_b_c'))");
 
+  // Rows hold one of the keywords, or none of them, at varying offsets.
+  const std::vector<std::string> keywords = {
+      "error", "timeout", "refused", "oom", "panic", "fatal", "abort", "retry"};
+  auto multiPatternInput =
+      vectorMaker.flatVector<std::string>(vectorSize, [&](auto row) {
+        auto padding = std::string(row % 64, 'x');
+        if (row % 3 == 0) {
+          return padding;
+        }
+        return fmt::format(
+            "{} {} {}", padding, keywords[row % keywords.size()], padding);
+      });
+
+  benchmarkBuilder
+      .addBenchmarkSet(
+          "like_multi_pattern",
+          vectorMaker.rowVector({"col0"}, {multiPatternInput}))
+      .addExpression(
+          "or_chain",
+          "like(col0, '%error%') or like(col0, '%timeout%') or "
+          "like(col0, '%refused%') or like(col0, 'oom%') or "
+          "like(col0, '%panic') or like(col0, '%fatal%') or "
+          "like(col0, '%abort%') or rlike(col0, 'ret+ry')")
+      .addExpression(
+          "multi_like_any",
+          "multi_like_any(col0, 'LLLLLLLR', '%error%', '%timeout%', "
+          "'%refused%', 'oom%', '%panic', '%fatal%', '%abort%', 'ret+ry')")
+      .addExpression(
+          "multi_like_index",
+          "multi_like_index(col0, 'LLLLLLLR', '%error%', '%timeout%', "
+          "'%refused%', 'oom%', '%panic', '%fatal%', '%abort%', 'ret+ry') > 0");
+
   benchmarkBuilder.registerBenchmarks();
   benchmarkBuilder.testBenchmarks();
   folly::runBenchmarks();
@@ -31,6 +31,9 @@ std::string MetaBloomFilter::toString() const {
     case BloomFilterKind::kNGram:
       strKind = "NGram";
       break;
+    case BloomFilterKind::kOrc:
+      strKind = "Orc";
+      break;
     default:
       break;
   }
@@ -77,7 +80,7 @@ NGramBloomFilter::NGramBloomFilter(
       words_((size_ + sizeof(uint64_t) - 1) / sizeof(uint64_t)) {
   BOLT_CHECK(size_ != 0);
   BOLT_CHECK(hashes_ != 0);
-  filter_.reserve(size_);
+  filter_.assign(words_, 0);
   memcpy(filter_.data(), bits, size_);
 }
 
@@ -97,14 +100,24 @@ bool NGramBloomFilter::mayContain(const char* data, size_t len) const {
 }
 
 void NGramBloomFilter::insert(const char* data, size_t len) {
-  int64_t hash1 = CityHash64WithSeed(data, len, seed_);
-  int64_t hash2 =
-      CityHash64WithSeed(data, len, SEED_GEN_A * seed_ + SEED_GEN_B);
+  insert(filter_.data(), size_, hashes_, seed_, data, len);
+}
 
-  for (int64_t i = 0; i < hashes_; ++i) {
-    int64_t pos = (hash1 + i * hash2 + i * i) % (8 * size_);
+// static
+void NGramBloomFilter::insert(
+    uint64_t* words,
+    int64_t size,
+    int32_t hashes,
+    int32_t seed,
+    const char* data,
+    size_t len) {
+  int64_t hash1 = CityHash64WithSeed(data, len, seed);
+  int64_t hash2 = CityHash64WithSeed(data, len, SEED_GEN_A * seed + SEED_GEN_B);
+
+  for (int64_t i = 0; i < hashes; ++i) {
+    int64_t pos = (hash1 + i * hash2 + i * i) % (8 * size);
     pos = std::abs(pos);
-    filter_[pos / (8 * sizeof(uint64_t))] |=
+    words[pos / (8 * sizeof(uint64_t))] |=
         (1ULL << (pos % (8 * sizeof(uint64_t))));
   }
 }
@@ -198,4 +211,97 @@ void BlockSplitBloomFilter::insert(uint64_t hash) {
   }
 }
 
+OrcBloomFilter::OrcBloomFilter(
+    uint32_t numHashFunctions,
+    std::vector<uint64_t> bits)
+    : MetaBloomFilter(BloomFilterKind::kOrc),
+      numHashFunctions_(numHashFunctions),
+      bits_(std::move(bits)) {
+  BOLT_CHECK_GT(numHashFunctions_, 0);
+  BOLT_CHECK(!bits_.empty());
+}
+
+template <typename Func>
+bool OrcBloomFilter::forEachBit(uint64_t hash, Func func) const {
+  // Java int arithmetic: the combined hash wraps around at 32 bits.
+  const uint32_t hash1 = static_cast<uint32_t>(hash);
+  const uint32_t hash2 = static_cast<uint32_t>(hash >> 32);
+  const uint64_t numBits = bits_.size() * 64;
+  for (uint32_t i = 1; i <= numHashFunctions_; ++i) {
+    auto combined = static_cast<int32_t>(hash1 + i * hash2);
+    if (combined < 0) {
+      combined = ~combined;
+    }
+    if (!func(static_cast<uint64_t>(combined) % numBits)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool OrcBloomFilter::mayContain(uint64_t hash) const {
+  return forEachBit(
+      hash, [&](auto bit) { return bits::isBitSet(bits_.data(), bit); });
+}
+
+void OrcBloomFilter::insert(uint64_t hash) {
+  forEachBit(hash, [&](auto bit) {
+    bits::setBit(bits_.data(), bit);
+    return true;
+  });
+}
+
+uint64_t OrcBloomFilter::hashLong(int64_t value) {
+  // Shifts right are arithmetic, as in Java's '>>'.
+  uint64_t key = value;
+  key = ~key + (key << 21);
+  key ^= static_cast<uint64_t>(static_cast<int64_t>(key) >> 24);
+  key = key + (key << 3) + (key << 8);
+  key ^= static_cast<uint64_t>(static_cast<int64_t>(key) >> 14);
+  key = key + (key << 2) + (key << 4);
+  key ^= static_cast<uint64_t>(static_cast<int64_t>(key) >> 28);
+  key += key << 31;
+  return key;
+}
+
+uint64_t OrcBloomFilter::hashBytes(const char* data, size_t size) {
+  // Murmur3 64-bit variant of the ORC writers, org.apache.orc.util.Murmur3.
+  constexpr uint64_t kC1 = 0x87c37b91114253d5ULL;
+  constexpr uint64_t kC2 = 0x4cf5ad432745937fULL;
+  constexpr uint64_t kM = 5;
+  constexpr uint64_t kN1 = 0x52dce729;
+  constexpr uint64_t kSeed = 104729;
+  auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+
+  uint64_t hash = kSeed;
+  const auto numBlocks = size / 8;
+  for (size_t i = 0; i < numBlocks; ++i) {
+    uint64_t k;
+    memcpy(&k, data + i * 8, sizeof(k));
+    k *= kC1;
+    k = rotl(k, 31);
+    k *= kC2;
+    hash ^= k;
+    hash = rotl(hash, 27) * kM + kN1;
+  }
+  const auto* tail = reinterpret_cast<const uint8_t*>(data + numBlocks * 8);
+  if (const auto tailSize = size - numBlocks * 8; tailSize > 0) {
+    uint64_t k = 0;
+    for (size_t i = 0; i < tailSize; ++i) {
+      k ^= static_cast<uint64_t>(tail[i]) << (i * 8);
+    }
+    k *= kC1;
+    k = rotl(k, 31);
+    k *= kC2;
+    hash ^= k;
+  }
+  hash ^= size;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
 } // namespace bytedance::bolt
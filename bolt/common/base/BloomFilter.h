@@ -152,6 +152,7 @@ class BloomFilter {
 enum class BloomFilterKind {
   kParquet,
   kNGram,
+  kOrc,
 };
 
 class MetaBloomFilter {
@@ -299,6 +300,55 @@ class BlockSplitBloomFilter : public MetaBloomFilter {
   int32_t num_bytes_;
 };
 
+// Used for the row group bloom filters of ORC files. Hashes values the way
+// the ORC writers do: integers, dates and the bits of doubles with Thomas
+// Wang's 64-bit integer hash and strings with 64-bit Murmur3.
+class OrcBloomFilter : public MetaBloomFilter {
+ public:
+  // 'bits' is the bit set of the filter as stored in the file, bit i of the
+  // filter being bit i % 64 of word i / 64.
+  OrcBloomFilter(uint32_t numHashFunctions, std::vector<uint64_t> bits);
+
+  bool mayContain(uint64_t hash) const override;
+  void insert(uint64_t hash) override;
+
+  uint64_t Hash(int32_t value) const override {
+    return hashLong(value);
+  }
+  uint64_t Hash(int64_t value) const override {
+    return hashLong(value);
+  }
+  // ORC writes floats to bloom filters as doubles.
+  uint64_t Hash(float value) const override {
+    return Hash(static_cast<double>(value));
+  }
+  uint64_t Hash(double value) const override {
+    int64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return hashLong(bits);
+  }
+  uint64_t Hash(const std::string value) const override {
+    return hashBytes(value.data(), value.size());
+  }
+
+  int64_t GetBitsetSize() const override {
+    return bits_.size() * sizeof(uint64_t);
+  }
+
+  static uint64_t hashLong(int64_t value);
+
+  static uint64_t hashBytes(const char* data, size_t size);
+
+ private:
+  // Calls 'func' with the position of each bit 'hash' maps to until 'func'
+  // returns false. Returns false if 'func' did.
+  template <typename Func>
+  bool forEachBit(uint64_t hash, Func func) const;
+
+  const uint32_t numHashFunctions_;
+  std::vector<uint64_t> bits_;
+};
+
 class NGramBloomFilter : public MetaBloomFilter {
  public:
   static constexpr int64_t SEED_GEN_A = 845897321;
@@ -337,6 +387,16 @@ class NGramBloomFilter : public MetaBloomFilter {
   }
   void clear();
 
+  /// Sets the bits of 'data' in the bit set of 'size' bytes at 'words' the
+  /// way insert() does. Lets writers keep the bit set in memory they manage.
+  static void insert(
+      uint64_t* words,
+      int64_t size,
+      int32_t hashes,
+      int32_t seed,
+      const char* data,
+      size_t len);
+
   /// Checks if this contains everything from another bloom filter.
   /// Bloom filters must have equal size and seed.
   bool contains(const NGramBloomFilter& bf);
@@ -129,3 +129,50 @@ TEST(NGramBloomFilterTest, basic) {
     EXPECT_TRUE(bloom.mayContain(find));
   }
 }
+
+TEST(OrcBloomFilterTest, basic) {
+  constexpr int32_t kNumValues = 1'000;
+  // ~10 bits per value and 7 hash functions give ~1% false positives.
+  OrcBloomFilter bloom(7, std::vector<uint64_t>(kNumValues * 10 / 64 + 1));
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    bloom.insert(bloom.Hash(i * 3));
+    bloom.insert(bloom.Hash(fmt::format("value{}", i)));
+  }
+  bloom.insert(bloom.Hash(1.5));
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    ASSERT_TRUE(bloom.mayContain(bloom.Hash(i * 3)));
+    ASSERT_TRUE(bloom.mayContain(bloom.Hash(fmt::format("value{}", i))));
+  }
+  // Narrow integers and floats hash like the wider types ORC writes.
+  EXPECT_TRUE(bloom.mayContain(bloom.Hash(static_cast<int32_t>(3))));
+  EXPECT_TRUE(bloom.mayContain(bloom.Hash(1.5f)));
+
+  int32_t numFalsePositives = 0;
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    numFalsePositives += bloom.mayContain(bloom.Hash(i * 3 + 1));
+    numFalsePositives +=
+        bloom.mayContain(bloom.Hash(fmt::format("missing{}", i)));
+  }
+  EXPECT_LT(numFalsePositives, kNumValues / 10);
+}
+
+TEST(OrcBloomFilterTest, referenceHashes) {
+  // Hashes of the Apache ORC writers, BloomFilter.getLongHash() and
+  // Murmur3.hash64() of org.apache.orc. Checked against the bloom filters of
+  // dwio/orc/test/examples/orc_bloom_filter.orc.
+  EXPECT_EQ(OrcBloomFilter::hashLong(0), 0ULL);
+  EXPECT_EQ(OrcBloomFilter::hashLong(1), 0x5bca7c69b794f8ceULL);
+  EXPECT_EQ(OrcBloomFilter::hashLong(-1), 0x5bca868437950d03ULL);
+  EXPECT_EQ(OrcBloomFilter::hashLong(42), 0x0f3db82f1e7b6f7aULL);
+  EXPECT_EQ(OrcBloomFilter::hashLong(1LL << 40), 0x539d165267021515ULL);
+
+  auto hashString = [](std::string_view value) {
+    return OrcBloomFilter::hashBytes(value.data(), value.size());
+  };
+  EXPECT_EQ(hashString(""), 0x74a18dc8f20adb48ULL);
+  EXPECT_EQ(hashString("a"), 0xddd9b0af19f61187ULL);
+  EXPECT_EQ(hashString("abc"), 0xc76f181be3eea0ceULL);
+  // Longer than one 8 byte block.
+  EXPECT_EQ(hashString("hello world"), 0xb868febc7ed7b2acULL);
+  EXPECT_EQ(hashString("name00042"), 0x0b5d7d9cdb946db9ULL);
+}
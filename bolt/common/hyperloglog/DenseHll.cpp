@@ -30,6 +30,8 @@
 
 #include "bolt/common/hyperloglog/DenseHll.h"
 
+#include <algorithm>
+#include <array>
 #include <exception>
 #include <sstream>
 #include "bolt/common/base/IOUtils.h"
@@ -42,6 +44,71 @@ const int8_t kMaxDelta = (1 << kBitsPerBucket) - 1;
 const int8_t kBucketMask = (1 << kBitsPerBucket) - 1;
 constexpr double kLinearCountingMinEmptyBuckets = 0.4;
 
+/// Number of delta bytes merged as one block. The per-byte loops over a block
+/// have no branches and are vectorized by the compiler.
+constexpr int32_t kMergeBlockBytes = 32;
+
+/// Sum of 1 / 2^delta over the two deltas packed in each byte value.
+constexpr std::array<double, 256> makeDeltaPairReciprocals() {
+  std::array<double, 256> reciprocals{};
+  for (int i = 0; i < 256; ++i) {
+    reciprocals[i] = 1.0 / (1 << (i & kBucketMask)) + 1.0 / (1 << (i >> 4));
+  }
+  return reciprocals;
+}
+
+constexpr std::array<double, 256> kDeltaPairReciprocals =
+    makeDeltaPairReciprocals();
+
+/// Returns the number of zero deltas in 'numBytes' bytes of packed deltas.
+int32_t countZeroDeltas(const uint8_t* deltas, int32_t numBytes) {
+  int32_t count = 0;
+  for (int32_t i = 0; i < numBytes; ++i) {
+    count += ((deltas[i] & kBucketMask) == 0) + ((deltas[i] >> 4) == 0);
+  }
+  return count;
+}
+
+/// Returns true if any of the deltas in a block of packed deltas is kMaxDelta,
+/// i.e. the bucket may have an overflow entry.
+bool hasMaxDelta(const uint8_t* deltas) {
+  uint8_t found = 0;
+  for (int32_t i = 0; i < kMergeBlockBytes; ++i) {
+    found |= ((deltas[i] & kBucketMask) == kMaxDelta) |
+        ((deltas[i] >> 4) == kMaxDelta);
+  }
+  return found != 0;
+}
+
+/// Merges a block of packed deltas from 'otherDeltas' into 'deltas'. The deltas
+/// of each side are lowered by the amount their baseline is below the new
+/// baseline, 'shift' and 'otherShift', one of which is zero. The merged deltas
+/// must not exceed kMaxDelta. Returns the number of zero merged deltas.
+int32_t mergeBlock(
+    uint8_t* deltas,
+    const uint8_t* otherDeltas,
+    uint8_t shift,
+    uint8_t otherShift) {
+  int32_t zeros = 0;
+  for (int32_t i = 0; i < kMergeBlockBytes; ++i) {
+    // Saturating subtractions. The side with the higher baseline is never
+    // lowered, so clamping the other one at zero does not change the max.
+    const uint8_t low1 = deltas[i] & kBucketMask;
+    const uint8_t high1 = deltas[i] >> 4;
+    const uint8_t low2 = otherDeltas[i] & kBucketMask;
+    const uint8_t high2 = otherDeltas[i] >> 4;
+    const uint8_t low = std::max<uint8_t>(
+        low1 > shift ? low1 - shift : 0,
+        low2 > otherShift ? low2 - otherShift : 0);
+    const uint8_t high = std::max<uint8_t>(
+        high1 > shift ? high1 - shift : 0,
+        high2 > otherShift ? high2 - otherShift : 0);
+    zeros += (low == 0) + (high == 0);
+    deltas[i] = (high << 4) | low;
+  }
+  return zeros;
+}
+
 /// Buckets are stored in a byte array. Each byte stored 2 buckets, 4 bits each.
 /// Even buckets are stored in the first 4 bits of the byte. Odd buckets are
 /// stored in the last 4 bits of the byte. This function returns the offset in
@@ -157,6 +224,19 @@ void DenseHll::insertHash(uint64_t hash) {
   insert(index, value);
 }
 
+void DenseHll::insertHashes(const uint64_t* hashes, int32_t numHashes) {
+  for (int32_t i = 0; i < numHashes; ++i) {
+    const auto index = computeIndex(hashes[i], indexBitLength_);
+    const auto value = numberOfLeadingZeros(hashes[i], indexBitLength_) + 1;
+    // Below kMaxDelta the stored delta is the whole bucket value.
+    const auto oldDelta = getDelta(index);
+    if (oldDelta < kMaxDelta && value - baseline_ <= oldDelta) {
+      continue;
+    }
+    insert(index, value);
+  }
+}
+
 void DenseHll::insert(int32_t index, int8_t value) {
   auto delta = value - baseline_;
   auto oldDelta = getDelta(index);
@@ -219,11 +299,19 @@ struct DenseHllView {
 int64_t cardinalityImpl(const DenseHllView& hll) {
   auto numBuckets = 1 << hll.indexBitLength;
 
+  // Number of occurrences of each value of the bytes holding two deltas. Both
+  // the count of zero deltas and the harmonic sum follow from it, without
+  // decoding the buckets one by one.
+  std::array<int32_t, 256> byteCounts{};
+  const auto* deltas = reinterpret_cast<const uint8_t*>(hll.deltas);
+  for (int i = 0; i < numBuckets / 2; i++) {
+    ++byteCounts[deltas[i]];
+  }
+
   int32_t baselineCount = 0;
-  for (int i = 0; i < numBuckets; i++) {
-    if (hll.getDelta(i) == 0) {
-      baselineCount++;
-    }
+  for (int i = 0; i < 256; i++) {
+    baselineCount +=
+        byteCounts[i] * (((i & kBucketMask) == 0) + ((i >> 4) == 0));
   }
 
   // If baseline is zero, then baselineCount is the number of buckets with value
@@ -233,10 +321,24 @@ int64_t cardinalityImpl(const DenseHllView& hll) {
     return std::round(linearCounting(baselineCount, numBuckets));
   }
 
+  // Sum of 1 / 2^value over the buckets, with value = baseline + delta, plus
+  // the overflow of the buckets at kMaxDelta.
   double sum = 0;
-  for (int i = 0; i < numBuckets; i++) {
-    int value = hll.getValue(i);
-    sum += 1.0 / (1L << value);
+  for (int i = 0; i < 256; i++) {
+    sum += byteCounts[i] * kDeltaPairReciprocals[i];
+  }
+  sum = std::ldexp(sum, -hll.baseline);
+  for (int i = 0; i < hll.overflows; i++) {
+    // Like getValue(), only apply the first entry of a bucket at kMaxDelta.
+    const auto* buckets = hll.overflowBuckets;
+    const auto bucket = buckets[i];
+    if (bucket >= numBuckets || hll.getDelta(bucket) != kMaxDelta ||
+        std::find(buckets, buckets + i, bucket) != buckets + i) {
+      continue;
+    }
+    const int value = hll.baseline + kMaxDelta;
+    sum +=
+        1.0 / (1L << (value + hll.overflowValues[i])) - 1.0 / (1L << value);
   }
 
   double estimate = (alpha(hll.indexBitLength) * numBuckets * numBuckets) / sum;
@@ -531,12 +633,8 @@ DenseHll::DenseHll(const char* serialized, HashStringAllocator* allocator)
         overflowValues_.data());
   }
 
-  baselineCount_ = 0;
-  for (int i = 0; i < numBuckets; i++) {
-    if (getDelta(i) == 0) {
-      baselineCount_++;
-    }
-  }
+  baselineCount_ = countZeroDeltas(
+      reinterpret_cast<const uint8_t*>(deltas_.data()), deltas_.size());
 }
 
 void DenseHll::mergeWith(const DenseHll& other) {
@@ -584,49 +682,76 @@ void DenseHll::mergeWith(
   int8_t newBaseline = std::max(baseline_, otherBaseline);
   int32_t baselineCount = 0;
 
-  int bucket = 0;
-  for (int i = 0; i < deltas_.size(); i++) {
-    int newSlot = 0;
+  // Merges the bytes in [begin, end) one bucket at a time, looking up and
+  // updating overflow entries as needed.
+  auto mergeSlots = [&](int32_t begin, int32_t end) {
+    int bucket = begin * 2;
+    for (int i = begin; i < end; i++) {
+      int newSlot = 0;
 
-    int8_t slot1 = deltas_[i];
-    int8_t slot2 = otherDeltas[i];
+      int8_t slot1 = deltas_[i];
+      int8_t slot2 = otherDeltas[i];
 
-    for (int shift = 4; shift >= 0; shift -= 4) {
-      int8_t delta1 = (slot1 >> shift) & kBucketMask;
-      int8_t delta2 = (slot2 >> shift) & kBucketMask;
+      for (int shift = 4; shift >= 0; shift -= 4) {
+        int8_t delta1 = (slot1 >> shift) & kBucketMask;
+        int8_t delta2 = (slot2 >> shift) & kBucketMask;
 
-      int8_t value1 = baseline_ + delta1;
-      int8_t value2 = otherBaseline + delta2;
+        int8_t value1 = baseline_ + delta1;
+        int8_t value2 = otherBaseline + delta2;
 
-      int16_t overflowEntry = -1;
-      if (delta1 == kMaxDelta) {
-        overflowEntry = findOverflowEntry(bucket);
-        if (overflowEntry != -1) {
-          value1 += overflowValues_[overflowEntry];
+        int16_t overflowEntry = -1;
+        if (delta1 == kMaxDelta) {
+          overflowEntry = findOverflowEntry(bucket);
+          if (overflowEntry != -1) {
+            value1 += overflowValues_[overflowEntry];
+          }
         }
-      }
 
-      if (delta2 == kMaxDelta) {
-        value2 += getOverflowImpl(
-            bucket, otherOverflows, otherOverflowBuckets, otherOverflowValues);
-      }
+        if (delta2 == kMaxDelta) {
+          value2 += getOverflowImpl(
+              bucket,
+              otherOverflows,
+              otherOverflowBuckets,
+              otherOverflowValues);
+        }
 
-      int8_t newValue = std::max(value1, value2);
-      int8_t newDelta = newValue - newBaseline;
+        int8_t newValue = std::max(value1, value2);
+        int8_t newDelta = newValue - newBaseline;
 
-      if (newDelta == 0) {
-        baselineCount++;
-      }
+        if (newDelta == 0) {
+          baselineCount++;
+        }
 
-      newDelta = updateOverflow(bucket, overflowEntry, newDelta);
+        newDelta = updateOverflow(bucket, overflowEntry, newDelta);
 
-      newSlot <<= 4;
-      newSlot |= newDelta;
-      bucket++;
-    }
+        newSlot <<= 4;
+        newSlot |= newDelta;
+        bucket++;
+      }
 
-    deltas_[i] = newSlot;
+      deltas_[i] = newSlot;
+    }
+  };
+
+  // Only buckets at kMaxDelta can have an overflow entry, and merging buckets
+  // below kMaxDelta cannot produce one. Blocks without such buckets on either
+  // side, or all blocks if neither side has overflows, are merged with
+  // vectorized byte operations.
+  const bool noOverflows = overflows_ == 0 && otherOverflows == 0;
+  auto* deltas = reinterpret_cast<uint8_t*>(deltas_.data());
+  const auto* other = reinterpret_cast<const uint8_t*>(otherDeltas);
+  const uint8_t shift = newBaseline - baseline_;
+  const uint8_t otherShift = newBaseline - otherBaseline;
+  const int32_t numBytes = deltas_.size();
+  int32_t i = 0;
+  for (; i + kMergeBlockBytes <= numBytes; i += kMergeBlockBytes) {
+    if (noOverflows || (!hasMaxDelta(deltas + i) && !hasMaxDelta(other + i))) {
+      baselineCount += mergeBlock(deltas + i, other + i, shift, otherShift);
+    } else {
+      mergeSlots(i, i + kMergeBlockBytes);
+    }
   }
+  mergeSlots(i, numBytes);
 
   baseline_ = newBaseline;
   baselineCount_ = baselineCount;
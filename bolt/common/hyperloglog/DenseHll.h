@@ -62,6 +62,11 @@ class DenseHll {
 
   void insertHash(uint64_t hash);
 
+  /// Inserts 'numHashes' hashes. Same as calling insertHash() for each one,
+  /// but skips the general insert path for hashes that cannot raise their
+  /// bucket, which is most of them once the HLL has filled up.
+  void insertHashes(const uint64_t* hashes, int32_t numHashes);
+
   /// Inserts pre-computed {bucket, value} pair. These value must be compatible
   /// with computeIndex and computeValue methods called with the indexBitLength
   /// value of this HLL. Used by SparseHll.toDense().
@@ -29,6 +29,9 @@
  */
 
 #include "bolt/common/hyperloglog/SparseHll.h"
+
+#include <algorithm>
+
 #include "bolt/common/base/IOUtils.h"
 #include "bolt/common/hyperloglog/HllUtils.h"
 namespace bytedance::bolt::common::hll {
@@ -201,39 +204,42 @@ void SparseHll::mergeWith(const char* serialized) {
 void SparseHll::mergeWith(size_t otherSize, const uint32_t* otherEntries) {
   BOLT_CHECK_GT(otherSize, 0);
 
-  auto size = entries_.size();
-  std::vector<uint32_t> merged(size + otherSize);
-
-  int pos = 0;
-  int leftPos = 0;
-  int rightPos = 0;
-
-  while (leftPos < size && rightPos < otherSize) {
-    auto left = decodeIndex(entries_[leftPos]);
-    auto right = decodeIndex(otherEntries[rightPos]);
-    if (left < right) {
-      merged[pos++] = entries_[leftPos++];
-    } else if (left > right) {
-      merged[pos++] = otherEntries[rightPos++];
+  // Merge from the back into the grown 'entries_', so that no temporary buffer
+  // is needed. A write never overtakes the unread entries of 'entries_', since
+  // entries with the same index only collapse into one.
+  const int64_t size = entries_.size();
+  entries_.resize(size + otherSize);
+
+  int64_t pos = size + otherSize;
+  int64_t leftPos = size;
+  int64_t rightPos = otherSize;
+
+  while (leftPos > 0 && rightPos > 0) {
+    auto left = decodeIndex(entries_[leftPos - 1]);
+    auto right = decodeIndex(otherEntries[rightPos - 1]);
+    if (left > right) {
+      entries_[--pos] = entries_[--leftPos];
+    } else if (left < right) {
+      entries_[--pos] = otherEntries[--rightPos];
     } else {
       auto value = std::max(
-          decodeValue(entries_[leftPos++]),
-          decodeValue(otherEntries[rightPos++]));
-      merged[pos++] = encode(left, value);
+          decodeValue(entries_[--leftPos]),
+          decodeValue(otherEntries[--rightPos]));
+      entries_[--pos] = encode(left, value);
     }
   }
 
-  while (leftPos < size) {
-    merged[pos++] = entries_[leftPos++];
-  }
-
-  while (rightPos < otherSize) {
-    merged[pos++] = otherEntries[rightPos++];
+  while (rightPos > 0) {
+    entries_[--pos] = otherEntries[--rightPos];
   }
 
-  entries_.resize(pos);
-  for (auto i = 0; i < pos; i++) {
-    entries_[i] = merged[i];
+  // The remaining entries of 'entries_' are in [0, leftPos). Close the gap
+  // left by collapsed entries between them and the merged ones.
+  const auto gap = pos - leftPos;
+  if (gap > 0) {
+    std::move_backward(
+        entries_.begin(), entries_.begin() + leftPos, entries_.begin() + pos);
+    entries_.erase(entries_.begin(), entries_.begin() + gap);
   }
 }
 
@@ -239,6 +239,25 @@ TEST_P(DenseHllTest, mergeWith) {
   testMergeWith(indexBitLength, sequence(0, 2'000'000), sequence(0, 2'000'000));
 }
 
+TEST_P(DenseHllTest, insertHashes) {
+  int8_t indexBitLength = GetParam();
+
+  DenseHll expected{indexBitLength, &allocator_};
+  DenseHll denseHll{indexBitLength, &allocator_};
+  std::vector<uint64_t> hashes;
+  for (int i = 0; i < 1'000'000; i++) {
+    hashes.push_back(hashOne(i));
+    expected.insertHash(hashes.back());
+    if (hashes.size() == 1'000) {
+      denseHll.insertHashes(hashes.data(), hashes.size());
+      hashes.clear();
+    }
+  }
+
+  ASSERT_EQ(denseHll.cardinality(), expected.cardinality());
+  ASSERT_EQ(serialize(denseHll), serialize(expected));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     DenseHllTest,
     DenseHllTest,
@@ -126,6 +126,13 @@ class MemoryManager {
     /// NOTE: this only applies for MmapAllocator.
     int32_t mmapArenaCapacityRatio{10};
 
+    /// If true, MmapAllocator keeps separate size classes per NUMA node and
+    /// serves each allocation from the node of the allocating thread. The
+    /// topology can be overridden with --bolt_numa_topology.
+    ///
+    /// NOTE: this only applies for MmapAllocator.
+    bool numaAwareAllocation{false};
+
     /// If not zero, reserve 'smallAllocationReservePct'% of space from
     /// 'allocatorCapacity' for ad hoc small allocations. And those allocations
     /// are delegated to std::malloc. If 'maxMallocBytes' is 0, this value will
@@ -395,6 +395,8 @@ Stats Stats::operator-(const Stats& other) const {
     result.sizes[i] = sizes[i] - other.sizes[i];
   }
   result.numAdvise = numAdvise - other.numAdvise;
+  // A gauge, not a cumulative count.
+  result.numaNodePages = numaNodePages;
   return result;
 }
 
@@ -434,6 +436,12 @@ std::string Stats::toString() const {
         sizes[i].clocks() >> 20,
         sizes[i].numAllocations);
   }
+  for (auto node = 0; node < numaNodePages.size(); ++node) {
+    out << fmt::format(
+        "NUMA node {}: {}MB\n",
+        node,
+        AllocationTraits::pageBytes(numaNodePages[node]) >> 20);
+  }
   return out.str();
 }
 
@@ -149,6 +149,10 @@ struct Stats {
 
   /// Cumulative count of pages advised away, if the allocator exposes this.
   int64_t numAdvise{0};
+
+  /// Machine pages currently allocated on each NUMA node, if the allocator
+  /// places memory by node. Empty otherwise.
+  std::vector<int64_t> numaNodePages;
 };
 
 class MemoryAllocator;
@@ -37,6 +37,19 @@
 #include "bolt/common/base/StatsReporter.h"
 #include "bolt/common/memory/Memory.h"
 namespace bytedance::bolt::memory {
+namespace {
+
+std::shared_ptr<const NumaTopology> numaTopologyOf(
+    const MmapAllocator::Options& options) {
+  if (!options.numaAware) {
+    return nullptr;
+  }
+  return options.numaTopology != nullptr ? options.numaTopology
+                                         : NumaTopology::get();
+}
+
+} // namespace
+
 MmapAllocator::MmapAllocator(const Options& options)
     : MemoryAllocator(options.largestSizeClass),
       kind_(MemoryAllocator::Kind::kMmap),
@@ -48,9 +61,16 @@ MmapAllocator::MmapAllocator(const Options& options)
               : options.capacity * options.smallAllocationReservePct / 100),
       capacity_(bits::roundUp(
           AllocationTraits::numPages(options.capacity - mallocReservedBytes_),
-          64 * sizeClassSizes_.back())) {
-  for (const auto& size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+          64 * sizeClassSizes_.back())),
+      numaTopology_(numaTopologyOf(options)),
+      nodeAllocatedPages_(numNumaNodes()) {
+  // Each node's size classes cover the whole capacity, so that any node can
+  // serve any mix of sizes. Only the address space is reserved per node.
+  for (auto node = 0; node < numNumaNodes(); ++node) {
+    for (const auto& size : sizeClassSizes_) {
+      sizeClasses_.push_back(std::make_unique<SizeClass>(
+          capacity_ / size, size, numaTopology_ == nullptr ? -1 : node));
+    }
   }
 
   if (useMmapArena_) {
@@ -104,16 +124,20 @@ bool MmapAllocator::allocateNonContiguousWithoutRetry(
 
   ++numAllocations_;
   numAllocatedPages_ += sizeMix.totalPages;
+  const auto node = currentNode();
+  const auto firstSizeClass = node * sizeClassSizes_.size();
   MachinePageCount newMapsNeeded = 0;
   for (int i = 0; i < sizeMix.numSizes; ++i) {
     bool success;
+    const auto unitSize = sizeClassSizes_[sizeMix.sizeIndices[i]];
     stats_.recordAllocate(
-        AllocationTraits::pageBytes(sizeClassSizes_[sizeMix.sizeIndices[i]]),
-        sizeMix.sizeCounts[i],
-        [&]() {
-          success = sizeClasses_[sizeMix.sizeIndices[i]]->allocate(
-              sizeMix.sizeCounts[i], newMapsNeeded, out);
+        AllocationTraits::pageBytes(unitSize), sizeMix.sizeCounts[i], [&]() {
+          success = sizeClasses_[firstSizeClass + sizeMix.sizeIndices[i]]
+                        ->allocate(sizeMix.sizeCounts[i], newMapsNeeded, out);
         });
+    if (success) {
+      nodeAllocatedPages_[node] += sizeMix.sizeCounts[i] * unitSize;
+    }
     if (success && ((i > 0) || (sizeMix.numSizes == 1)) &&
         testingHasInjectedFailure(InjectedFailure::kAllocate)) {
       // Trigger memory allocation failure in the middle of the size class
@@ -208,10 +232,13 @@ MachinePageCount MmapAllocator::freeNonContiguousInternal(
       // Increment the free time only if the allocation contained
       // pages in the class. Note that size class indices in the
       // allocator are not necessarily the same as in the stats.
-      const auto sizeIndex =
-          Stats::sizeIndex(AllocationTraits::pageBytes(sizeClassSizes_[i]));
+      const auto sizeIndex = Stats::sizeIndex(AllocationTraits::pageBytes(
+          sizeClassSizes_[i % sizeClassSizes_.size()]));
       stats_.sizes[sizeIndex].freeClocks += clocks;
     }
+    if (pages > 0) {
+      nodeAllocatedPages_[i / sizeClassSizes_.size()] -= pages;
+    }
     numFreed += pages;
   }
   allocation.clear();
@@ -536,7 +563,10 @@ MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    int32_t numaNode)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(AllocationTraits::pageBytes(capacity_ * unitSize_)),
@@ -565,6 +595,11 @@ MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
         unitSize_);
   }
   address_ = reinterpret_cast<uint8_t*>(ptr);
+  if (numaNode >= 0 &&
+      !NumaTopology::preferNode(address_, byteSize_, numaNode)) {
+    BOLT_MEM_LOG(WARNING) << "Could not prefer NUMA node " << numaNode
+                          << " for sizeClass " << unitSize_;
+  }
 }
 
 MmapAllocator::SizeClass::~SizeClass() {
@@ -996,6 +1031,12 @@ std::string MmapAllocator::toString() const {
                     capacity() - AllocationTraits::pageBytes(numAllocated())))
       << " allocated pages " << numAllocated_ << " mapped pages " << numMapped_
       << " external mapped pages " << numExternalMapped_ << std::endl;
+  if (numaTopology_ != nullptr) {
+    for (auto node = 0; node < nodeAllocatedPages_.size(); ++node) {
+      out << "NUMA node " << node << " allocated pages "
+          << nodeAllocatedPages_[node] << std::endl;
+    }
+  }
   for (auto& sizeClass : sizeClasses_) {
     out << sizeClass->toString() << std::endl;
   }
@@ -44,6 +44,7 @@
 #include "bolt/common/memory/MemoryAllocator.h"
 #include "bolt/common/memory/MemoryPool.h"
 #include "bolt/common/memory/MmapArena.h"
+#include "bolt/common/memory/NumaTopology.h"
 namespace bytedance::bolt::memory {
 
 /// Denotes a number of pages of one size class, i.e. one page consists
@@ -93,6 +94,17 @@ class MmapAllocator : public MemoryAllocator {
     /// and 'smallAllocationReservePct' will be automatically set to 0
     /// disregarding any passed in value.
     int32_t maxMallocBytes = 3072;
+
+    /// If true, each NUMA node gets its own set of size classes, whose pages
+    /// are preferably backed by memory of that node, and non-contiguous
+    /// allocations are served from the size classes of the node the
+    /// allocating thread runs on. Contiguous allocations are placed by the
+    /// kernel's first touch policy.
+    bool numaAware = false;
+
+    /// Topology used if 'numaAware' is true. Defaults to
+    /// NumaTopology::get().
+    std::shared_ptr<const NumaTopology> numaTopology;
   };
 
   explicit MmapAllocator(const Options& options);
@@ -168,9 +180,25 @@ class MmapAllocator : public MemoryAllocator {
     return numMallocBytes_.readFull();
   }
 
+  /// Returns the number of NUMA nodes the size classes are split over, 1 if
+  /// 'this' is not NUMA aware.
+  int32_t numNumaNodes() const {
+    return numaTopology_ == nullptr ? 1 : numaTopology_->numNodes();
+  }
+
+  /// Returns the machine pages allocated from the size classes of 'node'.
+  MachinePageCount numAllocatedOnNode(int32_t node) const {
+    return nodeAllocatedPages_[node];
+  }
+
   Stats stats() const override {
     auto stats = stats_;
     stats.numAdvise = numAdvisedPages_;
+    if (numaTopology_ != nullptr) {
+      for (const auto& pages : nodeAllocatedPages_) {
+        stats.numaNodePages.push_back(pages);
+      }
+    }
     return stats;
   }
 
@@ -183,7 +211,12 @@ class MmapAllocator : public MemoryAllocator {
   // 'unitSize_' machine pages.
   class SizeClass {
    public:
-    SizeClass(size_t capacity, MachinePageCount unitSize);
+    // If 'numaNode' is not negative, the pages of 'this' are preferably backed
+    // by memory of that node.
+    SizeClass(
+        size_t capacity,
+        MachinePageCount unitSize,
+        int32_t numaNode = -1);
 
     ~SizeClass();
 
@@ -389,6 +422,11 @@ class MmapAllocator : public MemoryAllocator {
 
   bool useMalloc(uint64_t bytes);
 
+  // Returns the NUMA node whose size classes serve the calling thread.
+  int32_t currentNode() const {
+    return numaTopology_ == nullptr ? 0 : numaTopology_->currentNode();
+  }
+
   const Kind kind_;
 
   // If set true, allocations larger than the largest size class size will be
@@ -417,8 +455,17 @@ class MmapAllocator : public MemoryAllocator {
   // to std::malloc().
   const MachinePageCount capacity_ = 0;
 
+  // Set if 'this' is NUMA aware.
+  const std::shared_ptr<const NumaTopology> numaTopology_;
+
+  // The size classes of each NUMA node in turn, i.e. size class 'i' of node
+  // 'n' is at n * sizeClassSizes_.size() + i. There is one node if 'this' is
+  // not NUMA aware.
   std::vector<std::unique_ptr<SizeClass>> sizeClasses_;
 
+  // Machine pages allocated from the size classes of each NUMA node.
+  std::vector<std::atomic<int64_t>> nodeAllocatedPages_;
+
   // Statistics.
   std::atomic<uint64_t> numAllocations_ = 0;
   std::atomic<uint64_t> numAllocatedPages_ = 0;
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/common/memory/NumaTopology.h"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <fmt/format.h>
+#include <folly/Conv.h>
+#include <folly/String.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bolt/common/base/Exceptions.h"
+namespace bytedance::bolt::memory {
+namespace {
+
+// Parses a sysfs cpulist such as "0-3,8,10-11".
+std::vector<int32_t> parseCpuList(folly::StringPiece cpuList) {
+  std::vector<int32_t> cpus;
+  std::vector<folly::StringPiece> ranges;
+  folly::split(',', folly::trimWhitespace(cpuList), ranges, true);
+  for (const auto& range : ranges) {
+    folly::StringPiece first;
+    folly::StringPiece last;
+    if (folly::split('-', range, first, last)) {
+      const auto begin = folly::to<int32_t>(folly::trimWhitespace(first));
+      const auto end = folly::to<int32_t>(folly::trimWhitespace(last));
+      BOLT_USER_CHECK_LE(begin, end, "Invalid CPU range: {}", range.str());
+      for (auto cpu = begin; cpu <= end; ++cpu) {
+        cpus.push_back(cpu);
+      }
+    } else {
+      cpus.push_back(folly::to<int32_t>(folly::trimWhitespace(range)));
+    }
+  }
+  return cpus;
+}
+
+std::vector<int32_t> allCpus() {
+  std::vector<int32_t> cpus(std::max(1U, std::thread::hardware_concurrency()));
+  for (auto i = 0; i < cpus.size(); ++i) {
+    cpus[i] = i;
+  }
+  return cpus;
+}
+
+} // namespace
+
+NumaTopology::NumaTopology(std::vector<std::vector<int32_t>> nodeCpus)
+    : nodeCpus_(std::move(nodeCpus)) {
+  BOLT_CHECK(!nodeCpus_.empty(), "A NUMA topology needs at least one node");
+  for (auto node = 0; node < nodeCpus_.size(); ++node) {
+    for (auto cpu : nodeCpus_[node]) {
+      BOLT_CHECK_GE(cpu, 0);
+      if (cpu >= cpuNodes_.size()) {
+        cpuNodes_.resize(cpu + 1, 0);
+      }
+      cpuNodes_[cpu] = node;
+    }
+  }
+}
+
+std::shared_ptr<const NumaTopology> NumaTopology::parse(
+    std::string_view spec) {
+  std::vector<folly::StringPiece> nodes;
+  folly::split(';', folly::StringPiece(spec), nodes, true);
+  std::vector<std::vector<int32_t>> nodeCpus;
+  nodeCpus.reserve(nodes.size());
+  for (const auto& node : nodes) {
+    nodeCpus.push_back(parseCpuList(node));
+  }
+  BOLT_USER_CHECK(!nodeCpus.empty(), "Empty NUMA topology: '{}'", spec);
+  return std::make_shared<const NumaTopology>(std::move(nodeCpus));
+}
+
+std::shared_ptr<const NumaTopology> NumaTopology::detect() {
+  std::vector<std::vector<int32_t>> nodeCpus;
+#ifdef __linux__
+  // Node ids are assumed to be dense, which holds for the hosts we run on.
+  for (;;) {
+    std::ifstream in(fmt::format(
+        "/sys/devices/system/node/node{}/cpulist", nodeCpus.size()));
+    std::string cpuList;
+    if (!in || !std::getline(in, cpuList)) {
+      break;
+    }
+    nodeCpus.push_back(parseCpuList(cpuList));
+  }
+#endif
+  if (nodeCpus.empty()) {
+    nodeCpus.push_back(allCpus());
+  }
+  return std::make_shared<const NumaTopology>(std::move(nodeCpus));
+}
+
+const std::shared_ptr<const NumaTopology>& NumaTopology::get() {
+  static const std::shared_ptr<const NumaTopology> topology =
+      FLAGS_bolt_numa_topology.empty() ? detect()
+                                       : parse(FLAGS_bolt_numa_topology);
+  return topology;
+}
+
+int32_t NumaTopology::nodeOf(int32_t cpu) const {
+  return cpu >= 0 && cpu < cpuNodes_.size() ? cpuNodes_[cpu] : 0;
+}
+
+int32_t NumaTopology::currentNode() const {
+  if (nodeCpus_.size() == 1) {
+    return 0;
+  }
+#ifdef __linux__
+  return nodeOf(::sched_getcpu());
+#else
+  return 0;
+#endif
+}
+
+bool NumaTopology::pinCurrentThread(int32_t node) const {
+  BOLT_CHECK_LT(node, nodeCpus_.size());
+  return setCurrentThreadCpus(nodeCpus_[node]);
+}
+
+// static
+std::vector<int32_t> NumaTopology::currentThreadCpus() {
+  std::vector<int32_t> cpus;
+#ifdef __linux__
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  if (::pthread_getaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet) !=
+      0) {
+    return cpus;
+  }
+  for (int32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpuSet)) {
+      cpus.push_back(cpu);
+    }
+  }
+#endif
+  return cpus;
+}
+
+// static
+bool NumaTopology::setCurrentThreadCpus(const std::vector<int32_t>& cpus) {
+#ifdef __linux__
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  bool anyCpu = false;
+  for (auto cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &cpuSet);
+      anyCpu = true;
+    }
+  }
+  return anyCpu &&
+      ::pthread_setaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet) ==
+      0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool NumaTopology::preferNode(void* address, size_t bytes, int32_t node) {
+#ifdef __linux__
+  // From <numaif.h>, which is not installed without libnuma.
+  constexpr int kMpolPreferred = 1;
+  constexpr int32_t kMaxNodes = sizeof(unsigned long) * 8;
+  if (node < 0 || node >= kMaxNodes) {
+    return false;
+  }
+  const unsigned long nodeMask = 1UL << node;
+  // The kernel reads one bit less than 'maxnode'.
+  return ::syscall(
+             SYS_mbind,
+             address,
+             bytes,
+             kMpolPreferred,
+             &nodeMask,
+             kMaxNodes + 1,
+             0) == 0;
+#else
+  return false;
+#endif
+}
+
+std::string NumaTopology::toString() const {
+  std::stringstream out;
+  out << "NumaTopology[" << nodeCpus_.size() << " nodes:";
+  for (auto node = 0; node < nodeCpus_.size(); ++node) {
+    out << " " << node << ": " << nodeCpus_[node].size() << " cpus";
+  }
+  out << "]";
+  return out.str();
+}
+
+namespace {
+
+struct ThreadPinState {
+  // Node the thread is pinned to, -1 if none.
+  int32_t node{-1};
+  // CPUs of the thread before it was pinned. Empty if not pinned.
+  std::vector<int32_t> savedCpus;
+};
+
+ThreadPinState& threadPinState() {
+  thread_local ThreadPinState state;
+  return state;
+}
+
+} // namespace
+
+// static
+bool NumaThreadPin::pin(const NumaTopology& topology, int32_t node) {
+  auto& state = threadPinState();
+  if (state.node == node) {
+    return true;
+  }
+  if (state.savedCpus.empty()) {
+    state.savedCpus = NumaTopology::currentThreadCpus();
+    if (state.savedCpus.empty()) {
+      return false;
+    }
+  }
+  if (!topology.pinCurrentThread(node)) {
+    unpin();
+    return false;
+  }
+  state.node = node;
+  return true;
+}
+
+// static
+void NumaThreadPin::unpin() {
+  auto& state = threadPinState();
+  if (state.savedCpus.empty()) {
+    return;
+  }
+  NumaTopology::setCurrentThreadCpus(state.savedCpus);
+  state.savedCpus.clear();
+  state.node = -1;
+}
+
+// static
+int32_t NumaThreadPin::pinnedNode() {
+  return threadPinState().node;
+}
+
+} // namespace bytedance::bolt::memory
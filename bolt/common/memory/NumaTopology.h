@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+DECLARE_string(bolt_numa_topology);
+namespace bytedance::bolt::memory {
+
+/// Describes which CPUs belong to which NUMA node. Used to place memory on
+/// the node of the thread that allocates it and to pin threads to a node.
+class NumaTopology {
+ public:
+  /// 'nodeCpus[i]' lists the CPUs of node i. There must be at least one node.
+  explicit NumaTopology(std::vector<std::vector<int32_t>> nodeCpus);
+
+  /// Parses a topology given as one CPU list per node, separated by ';'. A
+  /// CPU list uses the sysfs 'cpulist' format, e.g. "0-3,8-11;4-7,12-15"
+  /// for two nodes of 8 CPUs each.
+  static std::shared_ptr<const NumaTopology> parse(std::string_view spec);
+
+  /// Reads the topology of this host from /sys/devices/system/node. Returns
+  /// a single node holding all CPUs if that is not available.
+  static std::shared_ptr<const NumaTopology> detect();
+
+  /// Returns the topology given by --bolt_numa_topology or, if that is
+  /// empty, the detected one. Evaluated once per process.
+  static const std::shared_ptr<const NumaTopology>& get();
+
+  int32_t numNodes() const {
+    return nodeCpus_.size();
+  }
+
+  const std::vector<int32_t>& cpus(int32_t node) const {
+    return nodeCpus_[node];
+  }
+
+  /// Returns the node of 'cpu', or 0 if 'cpu' is not in the topology.
+  int32_t nodeOf(int32_t cpu) const;
+
+  /// Returns the node of the CPU the calling thread is running on.
+  int32_t currentNode() const;
+
+  /// Restricts the calling thread to the CPUs of 'node'. Returns false if
+  /// the platform does not support this or none of the CPUs is usable.
+  bool pinCurrentThread(int32_t node) const;
+
+  /// Returns the CPUs the calling thread may run on, or an empty list if the
+  /// platform does not support this.
+  static std::vector<int32_t> currentThreadCpus();
+
+  /// Restricts the calling thread to 'cpus'. Returns false if the platform
+  /// does not support this or none of the CPUs is usable.
+  static bool setCurrentThreadCpus(const std::vector<int32_t>& cpus);
+
+  /// Asks the kernel to back the pages of [address, address + bytes) that
+  /// are touched later with memory of 'node' where possible. Returns false if
+  /// the platform does not support this or 'node' does not exist, e.g. for a
+  /// topology given in the config of a single node host.
+  static bool preferNode(void* address, size_t bytes, int32_t node);
+
+  std::string toString() const;
+
+ private:
+  const std::vector<std::vector<int32_t>> nodeCpus_;
+
+  // Node of each CPU, indexed by CPU number.
+  std::vector<int32_t> cpuNodes_;
+};
+
+/// Keeps the calling thread pinned to a node across calls, so that a thread
+/// that keeps running work of one node, e.g. an executor thread running
+/// drivers, changes its CPU affinity only when the node changes.
+class NumaThreadPin {
+ public:
+  /// Pins the calling thread to 'node' unless it already is. The CPUs the
+  /// thread could run on before the first pin are kept for unpin(). Returns
+  /// false if the thread could not be pinned.
+  static bool pin(const NumaTopology& topology, int32_t node);
+
+  /// Gives the calling thread back the CPUs it could run on before the first
+  /// pin(). Does nothing if the thread is not pinned.
+  static void unpin();
+
+  /// Returns the node the calling thread is pinned to, or -1 if none.
+  static int32_t pinnedNode();
+};
+
+} // namespace bytedance::bolt::memory
@@ -35,6 +35,7 @@
 #include "bolt/common/memory/MallocAllocator.h"
 #include "bolt/common/memory/MmapAllocator.h"
 #include "bolt/common/memory/MmapArena.h"
+#include "bolt/common/memory/NumaTopology.h"
 #include "bolt/common/memory/SharedArbitrator.h"
 #include "bolt/common/testutil/TestValue.h"
 
@@ -45,6 +46,7 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 #include <fstream>
+#include <numeric>
 
 DECLARE_bool(bolt_memory_leak_check_enabled);
 using namespace bytedance::bolt::common::testutil;
@@ -2147,4 +2149,44 @@ TEST_F(MmapConfigTest, sizeClasses) {
   }
 }
 
+TEST(NumaTopologyTest, parse) {
+  auto topology = NumaTopology::parse("0-3,8;4-7, 9");
+  ASSERT_EQ(topology->numNodes(), 2);
+  EXPECT_EQ(topology->cpus(0), (std::vector<int32_t>{0, 1, 2, 3, 8}));
+  EXPECT_EQ(topology->cpus(1), (std::vector<int32_t>{4, 5, 6, 7, 9}));
+  EXPECT_EQ(topology->nodeOf(2), 0);
+  EXPECT_EQ(topology->nodeOf(9), 1);
+  EXPECT_EQ(topology->nodeOf(100), 0);
+  BOLT_ASSERT_THROW(NumaTopology::parse("3-1"), "Invalid CPU range: 3-1");
+
+  EXPECT_GE(NumaTopology::detect()->numNodes(), 1);
+}
+
+TEST(NumaTopologyTest, mmapAllocator) {
+  // All CPUs are on node 1, so that all allocations are served from there.
+  std::vector<int32_t> cpus(4096);
+  std::iota(cpus.begin(), cpus.end(), 0);
+  MmapAllocator::Options options;
+  options.capacity = 64 << 20;
+  options.numaAware = true;
+  options.numaTopology = std::make_shared<const NumaTopology>(
+      std::vector<std::vector<int32_t>>{{}, std::move(cpus)});
+  MmapAllocator allocator(options);
+  ASSERT_EQ(allocator.numNumaNodes(), 2);
+
+  Allocation allocation;
+  ASSERT_TRUE(allocator.allocateNonContiguous(100, allocation));
+  EXPECT_EQ(allocator.numAllocatedOnNode(0), 0);
+  EXPECT_EQ(allocator.numAllocatedOnNode(1), allocation.numPages());
+  EXPECT_EQ(
+      allocator.stats().numaNodePages,
+      (std::vector<int64_t>{
+          0, static_cast<int64_t>(allocation.numPages())}));
+  EXPECT_TRUE(allocator.checkConsistency());
+
+  allocator.freeNonContiguous(allocation);
+  EXPECT_EQ(allocator.numAllocatedOnNode(1), 0);
+  EXPECT_TRUE(allocator.checkConsistency());
+}
+
 } // namespace bytedance::bolt::memory
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/common/process/PerfCounters.h"
+
+#include <folly/String.h>
+#include <glog/logging.h>
+
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+namespace bytedance::bolt::process {
+namespace {
+
+#ifdef __linux__
+struct PerfEventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+// Indexed by PerfEvent.
+constexpr std::array<PerfEventConfig, kNumPerfEvents> kPerfEventConfigs = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+}};
+
+// The events of one thread, opened as a group led by the first event that
+// could be opened so that a single read returns all of them.
+class ThreadPerfEvents {
+ public:
+  ThreadPerfEvents() {
+    int error{0};
+    for (auto i = 0; i < kNumPerfEvents; ++i) {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.type = kPerfEventConfigs[i].type;
+      attr.config = kPerfEventConfigs[i].config;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+          PERF_FORMAT_TOTAL_TIME_RUNNING;
+      const int fd = syscall(
+          SYS_perf_event_open,
+          &attr,
+          /*pid=*/0,
+          /*cpu=*/-1,
+          fds_.empty() ? -1 : fds_.front(),
+          /*flags=*/0);
+      if (fd < 0) {
+        error = errno;
+        continue;
+      }
+      fds_.push_back(fd);
+      events_.push_back(i);
+    }
+    if (fds_.empty()) {
+      LOG_FIRST_N(WARNING, 1)
+          << "Hardware perf counters are unavailable: "
+          << folly::errnoStr(error);
+    }
+  }
+
+  ~ThreadPerfEvents() {
+    for (const auto fd : fds_) {
+      close(fd);
+    }
+  }
+
+  bool read(PerfEventCounts& counts) const {
+    if (fds_.empty()) {
+      return false;
+    }
+    // The number of events, the enabled and running times and the value of
+    // each event.
+    std::array<uint64_t, 3 + kNumPerfEvents> values;
+    const auto size = (3 + events_.size()) * sizeof(uint64_t);
+    if (::read(fds_.front(), values.data(), size) !=
+        static_cast<ssize_t>(size)) {
+      return false;
+    }
+    counts = PerfEventCounts{};
+    counts.timeEnabled = values[1];
+    counts.timeRunning = values[2];
+    for (size_t i = 0; i < events_.size(); ++i) {
+      counts.counts[events_[i]] = values[3 + i];
+      counts.countedMask |= 1u << events_[i];
+    }
+    return true;
+  }
+
+ private:
+  std::vector<int> fds_;
+  // The PerfEvent of each of 'fds_'.
+  std::vector<int32_t> events_;
+};
+#endif
+
+} // namespace
+
+std::string_view perfEventMetricName(PerfEvent event) {
+  switch (event) {
+    case PerfEvent::kCycles:
+      return "perfCycles";
+    case PerfEvent::kInstructions:
+      return "perfInstructions";
+    case PerfEvent::kLlcMisses:
+      return "perfLlcMisses";
+    case PerfEvent::kBranchMisses:
+      return "perfBranchMisses";
+    case PerfEvent::kDtlbMisses:
+      return "perfDtlbMisses";
+  }
+  return "perfUnknown";
+}
+
+bool readThreadPerfEvents(PerfEventCounts& counts) {
+#ifdef __linux__
+  thread_local const ThreadPerfEvents events;
+  return events.read(counts);
+#else
+  return false;
+#endif
+}
+
+PerfEventCounts perfEventDelta(
+    const PerfEventCounts& start,
+    const PerfEventCounts& end) {
+  PerfEventCounts delta;
+  delta.countedMask = start.countedMask & end.countedMask;
+  delta.timeEnabled = end.timeEnabled - start.timeEnabled;
+  delta.timeRunning = end.timeRunning - start.timeRunning;
+  if (delta.timeRunning == 0) {
+    delta.countedMask = 0;
+    return delta;
+  }
+  const double scale =
+      static_cast<double>(delta.timeEnabled) / delta.timeRunning;
+  for (auto i = 0; i < kNumPerfEvents; ++i) {
+    if (delta.countedMask & (1u << i)) {
+      const auto count = end.counts[i] - start.counts[i];
+      delta.counts[i] = delta.timeEnabled == delta.timeRunning
+          ? count
+          : static_cast<uint64_t>(count * scale);
+    }
+  }
+  return delta;
+}
+
+} // namespace bytedance::bolt::process
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+namespace bytedance::bolt::process {
+
+/// Hardware events counted per thread.
+enum class PerfEvent : int32_t {
+  kCycles = 0,
+  kInstructions = 1,
+  /// Last level cache misses.
+  kLlcMisses = 2,
+  kBranchMisses = 3,
+  /// Data TLB read misses.
+  kDtlbMisses = 4,
+};
+
+constexpr int32_t kNumPerfEvents = 5;
+
+/// Returns the name of the runtime metric of 'event', e.g. "perfCycles".
+std::string_view perfEventMetricName(PerfEvent event);
+
+struct PerfEventCounts {
+  /// Counts indexed by PerfEvent.
+  std::array<uint64_t, kNumPerfEvents> counts{};
+
+  /// Bit i is set if the event with index i is counted.
+  uint32_t countedMask{0};
+
+  /// Nanoseconds the events were enabled and actually counted. These differ
+  /// when the events share the PMU with other events.
+  uint64_t timeEnabled{0};
+  uint64_t timeRunning{0};
+
+  bool counted(PerfEvent event) const {
+    return countedMask & (1u << static_cast<int32_t>(event));
+  }
+
+  uint64_t count(PerfEvent event) const {
+    return counts[static_cast<int32_t>(event)];
+  }
+};
+
+/// Reads the events counted on the calling thread. The events are opened as
+/// one perf_event_open(2) group on the first call on each thread and count
+/// user space only. Events the CPU or kernel does not support are left out.
+/// Returns false without changing 'counts' on a thread where no event could
+/// be opened, e.g. on other platforms than Linux or in a container without
+/// access to perf events. Only the first failure is logged.
+bool readThreadPerfEvents(PerfEventCounts& counts);
+
+/// Returns the events counted between 'start' and 'end', read on the same
+/// thread. Counts are extrapolated to the time the events were enabled if
+/// they were not counted all that time.
+PerfEventCounts perfEventDelta(
+    const PerfEventCounts& start,
+    const PerfEventCounts& end);
+
+/// Passes the events counted on the calling thread between construction and
+/// destruction to 'func'. Does nothing if the thread cannot count events.
+template <typename F>
+class DeltaPerfEventCounter {
+ public:
+  explicit DeltaPerfEventCounter(F&& func)
+      : func_(std::move(func)), counting_(readThreadPerfEvents(start_)) {}
+
+  ~DeltaPerfEventCounter() {
+    PerfEventCounts end;
+    if (counting_ && readThreadPerfEvents(end)) {
+      func_(perfEventDelta(start_, end));
+    }
+  }
+
+ private:
+  F func_;
+  PerfEventCounts start_;
+  const bool counting_;
+};
+
+} // namespace bytedance::bolt::process
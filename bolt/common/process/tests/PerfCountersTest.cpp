@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/common/process/PerfCounters.h"
+
+#include <gtest/gtest.h>
+using namespace bytedance::bolt::process;
+
+TEST(PerfCountersTest, delta) {
+  PerfEventCounts start;
+  start.counts = {100, 200, 10, 20, 5};
+  start.countedMask = 0b11111;
+  start.timeEnabled = 1'000;
+  start.timeRunning = 1'000;
+
+  PerfEventCounts end = start;
+  end.counts = {1'100, 2'200, 30, 60, 5};
+  end.countedMask = 0b01111;
+  end.timeEnabled = 2'000;
+  end.timeRunning = 2'000;
+  auto delta = perfEventDelta(start, end);
+  ASSERT_EQ(delta.countedMask, 0b01111);
+  ASSERT_EQ(delta.count(PerfEvent::kCycles), 1'000);
+  ASSERT_EQ(delta.count(PerfEvent::kInstructions), 2'000);
+  ASSERT_EQ(delta.count(PerfEvent::kLlcMisses), 20);
+  ASSERT_EQ(delta.count(PerfEvent::kBranchMisses), 40);
+  ASSERT_FALSE(delta.counted(PerfEvent::kDtlbMisses));
+
+  // Counted half of the time the events were enabled.
+  end.timeRunning = 1'500;
+  delta = perfEventDelta(start, end);
+  ASSERT_EQ(delta.count(PerfEvent::kCycles), 2'000);
+  ASSERT_EQ(delta.count(PerfEvent::kBranchMisses), 80);
+
+  // Not counted at all.
+  end.timeRunning = start.timeRunning;
+  delta = perfEventDelta(start, end);
+  ASSERT_EQ(delta.countedMask, 0);
+}
+
+TEST(PerfCountersTest, threadEvents) {
+  PerfEventCounts counts;
+  if (!readThreadPerfEvents(counts)) {
+    // No access to perf events, e.g. in a container. Every read fails then.
+    ASSERT_FALSE(readThreadPerfEvents(counts));
+    return;
+  }
+
+  uint64_t numCalls{0};
+  {
+    DeltaPerfEventCounter counter([&](const PerfEventCounts& delta) {
+      ++numCalls;
+      if (delta.counted(PerfEvent::kInstructions)) {
+        ASSERT_GT(delta.count(PerfEvent::kInstructions), 0);
+      }
+    });
+    volatile uint64_t sum{0};
+    for (auto i = 0; i < 1'000'000; ++i) {
+      sum = sum + i;
+    }
+  }
+  ASSERT_EQ(numCalls, 1);
+}
+
+TEST(PerfCountersTest, metricNames) {
+  ASSERT_EQ(perfEventMetricName(PerfEvent::kCycles), "perfCycles");
+  ASSERT_EQ(perfEventMetricName(PerfEvent::kInstructions), "perfInstructions");
+  ASSERT_EQ(perfEventMetricName(PerfEvent::kLlcMisses), "perfLlcMisses");
+  ASSERT_EQ(perfEventMetricName(PerfEvent::kBranchMisses), "perfBranchMisses");
+  ASSERT_EQ(perfEventMetricName(PerfEvent::kDtlbMisses), "perfDtlbMisses");
+}
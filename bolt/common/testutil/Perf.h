@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #if !defined(__linux__)
 namespace bytedance::bolt::common::testutil {
@@ -33,6 +38,9 @@ class Perf {
   void reset() const {}
   void report() const {}
   void report(std::ostream&) const {}
+  std::vector<std::pair<std::string, uint64_t>> counters() const {
+    return {};
+  }
 };
 } // namespace bytedance::bolt::common::testutil
 #else
@@ -192,23 +200,44 @@ class Perf {
     ReadFormat result;
     for (auto& [fd, e] : events_) {
       read(fd, &result, sizeof(result));
-      uint64_t val = result.val;
-      if (result.timeEnabled != result.timeRunning) {
-        val = result.val * (result.timeRunning / (double)result.timeEnabled);
-      }
-      os << (PerfEvent){e.type, (uint32_t)e.config} << ": " << val
-         << ", running percent: "
+      os << (PerfEvent){e.type, (uint32_t)e.config} << ": "
+         << scaledValue(result) << ", running percent: "
          << result.timeRunning * 1.0 / result.timeEnabled * 100 << "%"
          << std::endl;
     }
   }
 
+  /// Returns the name and value of each event. The values of events that were
+  /// not counted all the time they were enabled, because the PMU was
+  /// overcommitted, are extrapolated to the time they were enabled.
+  std::vector<std::pair<std::string, uint64_t>> counters() const {
+    std::vector<std::pair<std::string, uint64_t>> counters;
+    ReadFormat result;
+    for (auto& [fd, e] : events_) {
+      read(fd, &result, sizeof(result));
+      std::ostringstream name;
+      name << (PerfEvent){e.type, (uint32_t)e.config};
+      counters.emplace_back(name.str(), scaledValue(result));
+    }
+    return counters;
+  }
+
  private:
   struct __attribute__((packed)) ReadFormat {
     uint64_t val; // value of event
     uint64_t timeEnabled; // if PERF_FORMAT_TOTAL_TIME_ENABLED
     uint64_t timeRunning; // if PERF_FORMAT_TOTAL_TIME_RUNNING
   };
+
+  static uint64_t scaledValue(const ReadFormat& result) {
+    if (result.timeRunning == 0) {
+      return 0;
+    }
+    if (result.timeEnabled == result.timeRunning) {
+      return result.val;
+    }
+    return result.val * (result.timeEnabled / (double)result.timeRunning);
+  }
   std::vector<std::pair<int, perf_event_attr>> events_;
   bool autoStart_;
 };
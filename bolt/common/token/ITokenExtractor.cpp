@@ -15,6 +15,7 @@
  */
 
 #include "bolt/common/token/ITokenExtractor.h"
+#include <algorithm>
 #include <bit>
 namespace bytedance::bolt {
 
@@ -124,6 +125,35 @@ bool NgramTokenExtractor::nextInStringLike(
   return false;
 }
 
+void NgramTokenExtractor::ngrams(
+    const char* data,
+    uint32_t length,
+    std::vector<std::string_view>& ngrams) const {
+  if (ngram_ == 0) {
+    return;
+  }
+  // Start offset of the last 'ngram_' code points. Moves one code point
+  // forward for each code point after the first 'ngram_'.
+  uint32_t first = 0;
+  uint64_t numCodePoints = 0;
+  // Offset after the last space. N-grams starting before it have a space.
+  uint32_t afterSpace = 0;
+  for (uint32_t i = 0; i < length;) {
+    const uint32_t next = std::min<uint32_t>(
+        length, i + UTF8::seqLength(static_cast<uint8_t>(data[i])));
+    if (data[i] == ' ') {
+      afterSpace = next;
+    }
+    if (++numCodePoints > ngram_) {
+      first += UTF8::seqLength(static_cast<uint8_t>(data[first]));
+    }
+    if (numCodePoints >= ngram_ && first >= afterSpace) {
+      ngrams.emplace_back(data + first, next - first);
+    }
+    i = next;
+  }
+}
+
 bool SplitTokenExtractor::nextInStringLike(
     const char* data,
     uint32_t length,
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <string_view>
+#include <vector>
+
 #include "bolt/common/base/BloomFilter.h"
 namespace bytedance::bolt {
 
@@ -79,6 +82,15 @@ struct NgramTokenExtractor final
     return ngram_;
   }
 
+  /// Appends to 'ngrams' the runs of 'ngram_' code points of the value
+  /// 'data' that contain no space. These are all the tokens
+  /// nextInStringLike() can extract from a LIKE pattern matching 'data', so
+  /// a bloom filter of them has no false negatives for LIKE.
+  void ngrams(
+      const char* data,
+      uint32_t length,
+      std::vector<std::string_view>& ngrams) const;
+
  private:
   uint32_t ngram_;
 };
@@ -76,8 +76,10 @@ struct ConnectorSplit : public ISerializable {
 
   std::unique_ptr<AsyncSource<DataSource>> dataSource;
 
-  explicit ConnectorSplit(const std::string& _connectorId)
-      : connectorId(_connectorId) {}
+  explicit ConnectorSplit(
+      const std::string& _connectorId,
+      int64_t _splitWeight = 0)
+      : connectorId(_connectorId), splitWeight(_splitWeight) {}
 
   folly::dynamic serialize() const override {
     BOLT_UNSUPPORTED();
@@ -93,6 +95,16 @@ struct ConnectorSplit : public ISerializable {
   virtual std::string toString() const {
     return fmt::format("[split: {}]", connectorId);
   }
+
+  /// Returns a first part of about 'targetBytes' of this split followed by
+  /// the rest of it, or an empty vector if the split is not much larger than
+  /// 'targetBytes' or cannot be divided. The parts read disjoint data that
+  /// together is the data of this split, and their weights add up to the
+  /// weight of this split.
+  virtual std::vector<std::shared_ptr<ConnectorSplit>> divide(
+      uint64_t /*targetBytes*/) const {
+    return {};
+  }
 };
 
 class ColumnHandle : public ISerializable {
@@ -216,6 +228,17 @@ class DataSink {
   virtual void abort() = 0;
 };
 
+/// An aggregate over the output of a DataSource that the source may answer
+/// from file metadata instead of from the rows it reads.
+struct MetadataAggregate {
+  enum class Kind { kCount, kMin, kMax };
+
+  Kind kind;
+
+  /// Output channel the aggregate reads. Unset for count(*).
+  std::optional<column_index_t> channel;
+};
+
 class DataSource {
  public:
   static constexpr int64_t kUnknownRowSize = -1;
@@ -294,6 +317,24 @@ class DataSource {
     return kUnknownRowSize;
   }
 
+  // Asks the source to answer 'aggregates' from file metadata for the parts
+  // of the files whose rows all pass the filters. The rows of these parts
+  // are not returned by next(). Their partial results are returned by
+  // takeMetadataAggregates() instead. Returns false if the source does not
+  // support this, in which case next() returns all rows. Must be called
+  // before the first split is added.
+  virtual bool pushdownMetadataAggregates(
+      const std::vector<MetadataAggregate>& /*aggregates*/) {
+    return false;
+  }
+
+  // Returns the partial results computed from metadata since the last call,
+  // one per pushed down aggregate: a BIGINT count or the min or max of the
+  // column, null if there was no value.
+  virtual std::vector<variant> takeMetadataAggregates() {
+    BOLT_UNSUPPORTED("takeMetadataAggregates");
+  }
+
   virtual void close() {}
 };
 
@@ -278,6 +278,13 @@ uint64_t HiveConfig::sortWriterMaxOutputBytes(
       config::CapacityUnit::BYTE);
 }
 
+bool HiveConfig::isClusteredWriteEnabled(
+    const config::ConfigBase* session) const {
+  return session->get<bool>(
+      kClusteredWriteEnabledSession,
+      config_->get<bool>(kClusteredWriteEnabled, false));
+}
+
 uint64_t HiveConfig::footerEstimatedSize() const {
   return config_->get<uint64_t>(kFooterEstimatedSize, 1UL << 20);
 }
@@ -156,7 +156,9 @@ class HiveConfig {
   static constexpr const char* kMaxCoalescedDistanceSession =
       "orc_max_merge_distance";
 
-  /// The number of prefetch rowgroups
+  /// The number of prefetch rowgroups. DWRF and ORC readers fetch up to this
+  /// many stripes ahead of the one being read on the IO executor, adapting
+  /// the depth to how long reads wait for IO.
   static constexpr const char* kPrefetchRowGroups = "prefetch-rowgroups";
 
   /// The preload memory percent for a request.
@@ -212,6 +214,16 @@ class HiveConfig {
   static constexpr const char* kSortWriterMaxOutputBytesSession =
       "sort_writer_max_output_bytes";
 
+  /// Whether to cluster the rows of a partitioned or bucketed table write by
+  /// partition and bucket before writing them. The rows are buffered in a
+  /// spillable sort buffer and each file is written in one go when the sink
+  /// closes, so only one file writer is open at a time regardless of the
+  /// number of partitions.
+  static constexpr const char* kClusteredWriteEnabled =
+      "clustered-write-enabled";
+  static constexpr const char* kClusteredWriteEnabledSession =
+      "clustered_write_enabled";
+
   // Timestamp unit used during Bolt-Arrow conversion.
   static constexpr const char* kArrowBridgeTimestampUnit =
       "arrow_bridge_timestamp_unit";
@@ -297,6 +309,8 @@ class HiveConfig {
 
   uint64_t sortWriterMaxOutputBytes(const config::ConfigBase* session) const;
 
+  bool isClusteredWriteEnabled(const config::ConfigBase* session) const;
+
   /// Returns whether dictionary filtering is enabled for the given session.
   /// If not explicitly set in the session, falls back to the global config.
   /// @param session The configuration object to check
@@ -91,6 +91,68 @@ HiveConnectorSplitCacheLimit::create(const folly::dynamic& obj) {
       tableAndColumnCacheMap);
 }
 
+std::vector<std::shared_ptr<ConnectorSplit>> HiveConnectorSplit::divide(
+    uint64_t targetBytes) const {
+  if (targetBytes == 0 ||
+      (fileFormat != dwio::common::FileFormat::DWRF &&
+       fileFormat != dwio::common::FileFormat::ORC &&
+       fileFormat != dwio::common::FileFormat::PARQUET)) {
+    return {};
+  }
+  // The end of the split is unknown if it extends to the end of a file of
+  // unknown size.
+  uint64_t end = length > std::numeric_limits<uint64_t>::max() - start
+      ? std::numeric_limits<uint64_t>::max()
+      : start + length;
+  if (fileSize > 0) {
+    end = std::min(end, fileSize);
+  } else if (end == std::numeric_limits<uint64_t>::max()) {
+    return {};
+  }
+  // Leaves at least half of 'targetBytes' for the rest.
+  if (end <= start || end - start <= targetBytes + targetBytes / 2) {
+    return {};
+  }
+
+  // Divides the weight by bytes.
+  const auto firstWeight = static_cast<int64_t>(
+      static_cast<double>(splitWeight) * targetBytes / (end - start));
+  auto makePart = [&](uint64_t partStart,
+                      uint64_t partLength,
+                      int64_t partWeight) {
+    std::unique_ptr<HiveConnectorSplitCacheLimit> cacheLimit;
+    if (hiveConnectorSplitCacheLimit != nullptr) {
+      cacheLimit = std::make_unique<HiveConnectorSplitCacheLimit>(
+          hiveConnectorSplitCacheLimit->tableAndDataPartitionRangeOpen,
+          hiveConnectorSplitCacheLimit->tableAndDataPartitionRangeMap,
+          hiveConnectorSplitCacheLimit->splitSoftAffinityCacheable,
+          hiveConnectorSplitCacheLimit->tableAndColumnCacheMap);
+    }
+    return std::make_shared<HiveConnectorSplit>(
+        connectorId,
+        filePath,
+        fileFormat,
+        partStart,
+        partLength,
+        partitionKeys,
+        tableBucketNumber,
+        std::move(cacheLimit),
+        customSplitInfo,
+        extraFileInfo,
+        serdeParameters,
+        fileSize,
+        rowIdProperties,
+        infoColumns,
+        partWeight);
+  };
+  return {
+      makePart(start, targetBytes, firstWeight),
+      makePart(
+          start + targetBytes,
+          end - start - targetBytes,
+          splitWeight - firstWeight)};
+}
+
 // static
 std::shared_ptr<HiveConnectorSplit> HiveConnectorSplit::create(
     const folly::dynamic& obj) {
@@ -159,7 +221,9 @@ std::shared_ptr<HiveConnectorSplit> HiveConnectorSplit::create(
       extraFileInfo,
       serdeParameters,
       fileSize,
-      rowIdProperties);
+      rowIdProperties,
+      {},
+      splitWeight);
 }
 
 // static
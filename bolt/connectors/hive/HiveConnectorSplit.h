@@ -108,8 +108,9 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
       const std::unordered_map<std::string, std::string>& _serdeParameters = {},
       uint64_t _fileSize = 0,
       std::optional<RowIdProperties> _rowIdProperties = std::nullopt,
-      const std::unordered_map<std::string, std::string>& _infoColumns = {})
-      : ConnectorSplit(connectorId),
+      const std::unordered_map<std::string, std::string>& _infoColumns = {},
+      int64_t _splitWeight = 0)
+      : ConnectorSplit(connectorId, _splitWeight),
         filePath(_filePath),
         fileFormat(_fileFormat),
         start(_start),
@@ -136,6 +137,12 @@ struct HiveConnectorSplit : public connector::ConnectorSplit {
     return fmt::format("Hive: {} {} - {}", filePath, start, length);
   }
 
+  /// Divides DWRF, ORC and Parquet splits by byte range. Their readers read
+  /// the stripes or row groups that start in [start, start + length), so each
+  /// part reads whole stripes or row groups.
+  std::vector<std::shared_ptr<ConnectorSplit>> divide(
+      uint64_t targetBytes) const override;
+
   std::string getFileName() const {
     const auto i = filePath.rfind('/');
     return i == std::string::npos ? filePath : filePath.substr(i + 1);
@@ -369,13 +369,22 @@ HiveDataSink::HiveDataSink(
       hiveConfig_(hiveConfig),
       maxOpenWriters_(hiveConfig_->maxPartitionsPerWriters(
           connectorQueryCtx->sessionProperties())),
+      clusteredWriteEnabled_(
+          hiveConfig_->isClusteredWriteEnabled(
+              connectorQueryCtx->sessionProperties()) &&
+          (insertTableHandle_->isPartitioned() ||
+           insertTableHandle_->isBucketed())),
       partitionChannels_(getPartitionChannels(insertTableHandle_)),
       partitionIdGenerator_(
           !partitionChannels_.empty()
               ? std::make_unique<PartitionIdGenerator>(
                     inputType_,
                     partitionChannels_,
-                    maxOpenWriters_,
+                    // A clustered write opens one writer at a time, so the
+                    // number of partitions is not bounded by the writers.
+                    clusteredWriteEnabled_
+                        ? std::numeric_limits<uint32_t>::max()
+                        : maxOpenWriters_,
                     connectorQueryCtx_->memoryPool(),
                     hiveConfig_->isPartitionPathAsLowerCase(
                         connectorQueryCtx->sessionProperties()))
@@ -411,11 +420,9 @@ HiveDataSink::HiveDataSink(
     }
   }
 
-  if (!isBucketed()) {
-    return;
-  }
-  const auto& sortedProperty = insertTableHandle_->bucketProperty()->sortedBy();
-  if (!sortedProperty.empty()) {
+  if (isBucketed()) {
+    const auto& sortedProperty =
+        insertTableHandle_->bucketProperty()->sortedBy();
     sortColumnIndices_.reserve(sortedProperty.size());
     sortCompareFlags_.reserve(sortedProperty.size());
     for (int i = 0; i < sortedProperty.size(); ++i) {
@@ -432,6 +439,62 @@ HiveDataSink::HiveDataSink(
       }
     }
   }
+
+  if (clusteredWrite()) {
+    setupClusteredWrite();
+  }
+}
+
+void HiveDataSink::setupClusteredWrite() {
+  BOLT_CHECK(isPartitioned() || isBucketed());
+  const auto dataType = getNonPartitionTypes(dataChannels_, inputType_);
+  auto names = dataType->names();
+  auto types = dataType->children();
+  names.emplace_back("$partition_id");
+  types.emplace_back(BIGINT());
+  names.emplace_back("$bucket_id");
+  types.emplace_back(INTEGER());
+  clusteredInputType_ = ROW(std::move(names), std::move(types));
+
+  // Rows are sorted by writer id first. The bucket sort columns order the rows
+  // within each file, so the files need no sort of their own.
+  std::vector<column_index_t> sortChannels;
+  std::vector<CompareFlags> compareFlags;
+  if (isPartitioned()) {
+    sortChannels.push_back(dataType->size());
+    compareFlags.emplace_back();
+  }
+  if (isBucketed()) {
+    sortChannels.push_back(dataType->size() + 1);
+    compareFlags.emplace_back();
+  }
+  sortChannels.insert(
+      sortChannels.end(), sortColumnIndices_.begin(), sortColumnIndices_.end());
+  compareFlags.insert(
+      compareFlags.end(), sortCompareFlags_.begin(), sortCompareFlags_.end());
+
+  auto* connectorPool = connectorQueryCtx_->connectorMemoryPool();
+  clusteredPool_ = connectorPool->addAggregateChild(
+      fmt::format("{}.clustered", connectorPool->name()));
+  if (connectorPool->reclaimer() != nullptr) {
+    clusteredPool_->setReclaimer(exec::MemoryReclaimer::create());
+  }
+  clusteredSortPool_ = createSortPool(clusteredPool_);
+  auto sortBuffer = std::make_unique<exec::SortBuffer>(
+      clusteredInputType_,
+      sortChannels,
+      compareFlags,
+      clusteredSortPool_.get(),
+      &nonReclaimableSection_,
+      spillConfig_);
+  clusteredWriter_ = std::make_unique<dwio::common::SortingWriter>(
+      std::make_unique<ClusteredWriter>(this, dataType),
+      std::move(sortBuffer),
+      hiveConfig_->sortWriterMaxOutputRows(
+          connectorQueryCtx_->sessionProperties()),
+      hiveConfig_->sortWriterMaxOutputBytes(
+          connectorQueryCtx_->sessionProperties()),
+      &clusteredSpillStats_);
 }
 
 bool HiveDataSink::canReclaim() const {
@@ -458,6 +521,11 @@ void HiveDataSink::appendData(RowVectorPtr input) {
     input->childAt(i)->loadedVector();
   }
 
+  if (clusteredWrite()) {
+    appendClusteredData(input);
+    return;
+  }
+
   // All inputs belong to a single non-bucketed partition. The partition id
   // must be zero.
   if (!isBucketed() && partitionIdGenerator_->numPartitions() == 1) {
@@ -489,6 +557,45 @@ void HiveDataSink::write(size_t index, RowVectorPtr input) {
   writerInfo_[index]->numWrittenRows += dataInput->size();
 }
 
+void HiveDataSink::appendClusteredData(const RowVectorPtr& input) {
+  const auto numRows = input->size();
+  auto* pool = connectorQueryCtx_->memoryPool();
+  std::vector<VectorPtr> children;
+  children.reserve(dataChannels_.size() + 2);
+  for (auto channel : dataChannels_) {
+    children.push_back(input->childAt(channel));
+  }
+
+  if (isPartitioned()) {
+    auto partitionIds =
+        BaseVector::create<FlatVector<int64_t>>(BIGINT(), numRows, pool);
+    auto* rawPartitionIds = partitionIds->mutableRawValues();
+    for (auto row = 0; row < numRows; ++row) {
+      rawPartitionIds[row] = partitionIds_[row];
+    }
+    children.push_back(std::move(partitionIds));
+  } else {
+    children.push_back(
+        BaseVector::createConstant(BIGINT(), int64_t{0}, numRows, pool));
+  }
+
+  if (isBucketed()) {
+    auto bucketIds =
+        BaseVector::create<FlatVector<int32_t>>(INTEGER(), numRows, pool);
+    auto* rawBucketIds = bucketIds->mutableRawValues();
+    for (auto row = 0; row < numRows; ++row) {
+      rawBucketIds[row] = bucketIds_[row];
+    }
+    children.push_back(std::move(bucketIds));
+  } else {
+    children.push_back(
+        BaseVector::createConstant(INTEGER(), int32_t{0}, numRows, pool));
+  }
+
+  clusteredWriter_->write(std::make_shared<RowVector>(
+      pool, clusteredInputType_, nullptr, numRows, std::move(children)));
+}
+
 std::string HiveDataSink::stateString(State state) {
   switch (state) {
     case State::kRunning:
@@ -537,6 +644,9 @@ DataSink::Stats HiveDataSink::stats() const {
       stats.spillStats += *info->spillStats;
     }
   }
+  if (!clusteredSpillStats_.empty()) {
+    stats.spillStats += clusteredSpillStats_;
+  }
   return stats;
 }
 
@@ -630,13 +740,27 @@ void HiveDataSink::closeInternal() {
   TestValue::adjust(
       "bytedance::bolt::connector::hive::HiveDataSink::closeInternal", this);
 
+  // The writers of a clustered write are closed as they are done with and
+  // reset.
   if (state_ == State::kClosed) {
+    if (clusteredWrite()) {
+      clusteredWriter_->close();
+    }
     for (int i = 0; i < writers_.size(); ++i) {
+      if (writers_[i] == nullptr) {
+        continue;
+      }
       WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
       writers_[i]->close();
     }
   } else {
+    if (clusteredWrite()) {
+      clusteredWriter_->abort();
+    }
     for (int i = 0; i < writers_.size(); ++i) {
+      if (writers_[i] == nullptr) {
+        continue;
+      }
       WRITER_NON_RECLAIMABLE_SECTION_GUARD(i);
       writers_[i]->abort();
     }
@@ -652,9 +776,11 @@ uint32_t HiveDataSink::ensureWriter(const HiveWriterId& id) {
 }
 
 uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
-  // Check max open writers.
-  BOLT_USER_CHECK_LE(
-      writers_.size(), maxOpenWriters_, "Exceeded open writer limit");
+  // Check max open writers. A clustered write has at most one writer open.
+  if (!clusteredWrite()) {
+    BOLT_USER_CHECK_LE(
+        writers_.size(), maxOpenWriters_, "Exceeded open writer limit");
+  }
   BOLT_CHECK_EQ(writers_.size(), writerInfo_.size());
   BOLT_CHECK_EQ(writerIndexMap_.size(), writerInfo_.size());
 
@@ -672,7 +798,7 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
   auto writerPool = createWriterPool(id);
   auto sinkPool = createSinkPool(writerPool);
   std::shared_ptr<memory::MemoryPool> sortPool{nullptr};
-  if (sortWrite()) {
+  if (sortWrite() && !clusteredWrite()) {
     sortPool = createSortPool(writerPool);
   }
   writerInfo_.emplace_back(std::make_shared<HiveWriterInfo>(
@@ -729,7 +855,8 @@ uint32_t HiveDataSink::appendWriter(const HiveWriterId& id) {
 std::unique_ptr<bytedance::bolt::dwio::common::Writer>
 HiveDataSink::maybeCreateBucketSortWriter(
     std::unique_ptr<bytedance::bolt::dwio::common::Writer> writer) {
-  if (!sortWrite()) {
+  // A clustered write gets its rows already sorted.
+  if (!sortWrite() || clusteredWrite()) {
     return writer;
   }
   auto* sortPool = writerInfo_.back()->sortPool.get();
@@ -751,6 +878,40 @@ HiveDataSink::maybeCreateBucketSortWriter(
       writerInfo_.back()->spillStats.get());
 }
 
+void HiveDataSink::writeClustered(
+    const HiveWriterId& id,
+    const RowVectorPtr& data) {
+  uint32_t index;
+  auto it = writerIndexMap_.find(id);
+  if (it == writerIndexMap_.end()) {
+    closeClusteredWriter();
+    index = appendWriter(id);
+  } else {
+    index = it->second;
+    BOLT_CHECK_NOT_NULL(
+        writers_[index],
+        "Clustered input is out of order for writer {}",
+        id.toString());
+  }
+
+  WRITER_NON_RECLAIMABLE_SECTION_GUARD(index);
+  writers_[index]->write(data);
+  writerInfo_[index]->numWrittenRows += data->size();
+}
+
+void HiveDataSink::closeClusteredWriter() {
+  if (writers_.empty() || writers_.back() == nullptr) {
+    return;
+  }
+  const auto index = writers_.size() - 1;
+  {
+    WRITER_NON_RECLAIMABLE_SECTION_GUARD(index);
+    writers_[index]->close();
+  }
+  // Frees the writer's buffers before the next writer is opened.
+  writers_[index].reset();
+}
+
 HiveWriterId HiveDataSink::getWriterId(size_t row) const {
   std::optional<int32_t> partitionId;
   if (isPartitioned()) {
@@ -965,6 +1126,68 @@ LocationHandlePtr LocationHandle::create(const folly::dynamic& obj) {
   return std::make_shared<LocationHandle>(targetPath, writePath, tableType);
 }
 
+HiveDataSink::ClusteredWriter::ClusteredWriter(
+    HiveDataSink* dataSink,
+    RowTypePtr dataType)
+    : dataSink_(dataSink), dataType_(std::move(dataType)) {
+  BOLT_CHECK_NOT_NULL(dataSink_);
+  setState(State::kRunning);
+}
+
+void HiveDataSink::ClusteredWriter::write(const VectorPtr& data) {
+  checkRunning();
+  const auto* input = data->asUnchecked<RowVector>();
+  const auto numRows = input->size();
+  const auto numDataColumns = dataType_->size();
+  const auto* partitionIds =
+      input->childAt(numDataColumns)->as<SimpleVector<int64_t>>();
+  const auto* bucketIds =
+      input->childAt(numDataColumns + 1)->as<SimpleVector<int32_t>>();
+  const auto writerId = [&](vector_size_t row) {
+    HiveWriterId id;
+    if (dataSink_->isPartitioned()) {
+      id.partitionId = static_cast<uint32_t>(partitionIds->valueAt(row));
+    }
+    if (dataSink_->isBucketed()) {
+      id.bucketId = static_cast<uint32_t>(bucketIds->valueAt(row));
+    }
+    return id;
+  };
+
+  const auto dataInput = std::make_shared<RowVector>(
+      input->pool(),
+      dataType_,
+      nullptr,
+      numRows,
+      std::vector<VectorPtr>(
+          input->children().begin(),
+          input->children().begin() + numDataColumns));
+  vector_size_t begin = 0;
+  while (begin < numRows) {
+    const auto id = writerId(begin);
+    auto end = begin + 1;
+    while (end < numRows && writerId(end) == id) {
+      ++end;
+    }
+    dataSink_->writeClustered(
+        id,
+        end - begin == numRows ? dataInput
+                               : std::static_pointer_cast<RowVector>(
+                                     dataInput->slice(begin, end - begin)));
+    begin = end;
+  }
+}
+
+void HiveDataSink::ClusteredWriter::close() {
+  setState(State::kClosed);
+  dataSink_->closeClusteredWriter();
+}
+
+void HiveDataSink::ClusteredWriter::abort() {
+  // The open writer, if any, is aborted with the others.
+  setState(State::kAborted);
+}
+
 std::unique_ptr<memory::MemoryReclaimer> HiveDataSink::WriterReclaimer::create(
     HiveDataSink* dataSink,
     HiveWriterInfo* writerInfo) {
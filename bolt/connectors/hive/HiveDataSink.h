@@ -504,6 +504,31 @@ class HiveDataSink : public DataSink {
     HiveWriterInfo* const writerInfo_;
   };
 
+  // Receives the clustered input sorted by writer id and writes each run of
+  // rows with the same writer id through the writer for that id. A writer is
+  // closed as soon as the next one is needed.
+  class ClusteredWriter : public dwio::common::Writer {
+   public:
+    ClusteredWriter(HiveDataSink* dataSink, RowTypePtr dataType);
+
+    void write(const VectorPtr& data) override;
+
+    void flush() override {}
+
+    void close() override;
+
+    void abort() override;
+
+   private:
+    HiveDataSink* const dataSink_;
+    const RowTypePtr dataType_;
+  };
+
+  // Returns true if the input is clustered by writer id before it is written.
+  FOLLY_ALWAYS_INLINE bool clusteredWrite() const {
+    return clusteredWriteEnabled_;
+  }
+
   FOLLY_ALWAYS_INLINE bool sortWrite() const {
     return !sortColumnIndices_.empty();
   }
@@ -575,6 +600,22 @@ class HiveDataSink : public DataSink {
   // Invoked to write 'input' to the specified file writer.
   void write(size_t index, RowVectorPtr input);
 
+  // Creates the sort buffer and the writers that cluster the input by writer
+  // id.
+  void setupClusteredWrite();
+
+  // Appends the partition and bucket ids of 'input' to its data columns and
+  // adds the result to 'clusteredWriter_'.
+  void appendClusteredData(const RowVectorPtr& input);
+
+  // Writes 'data', which holds only data columns, to the writer of 'id'. Opens
+  // that writer and closes the previous one if 'id' is new. Ids must come in
+  // clustered order.
+  void writeClustered(const HiveWriterId& id, const RowVectorPtr& data);
+
+  // Closes and releases the most recently opened writer of a clustered write.
+  void closeClusteredWriter();
+
   void closeInternal();
 
   const RowTypePtr inputType_;
@@ -583,6 +624,7 @@ class HiveDataSink : public DataSink {
   const CommitStrategy commitStrategy_;
   const std::shared_ptr<const HiveConfig> hiveConfig_;
   const uint32_t maxOpenWriters_;
+  const bool clusteredWriteEnabled_;
   const std::vector<column_index_t> partitionChannels_;
   const std::unique_ptr<PartitionIdGenerator> partitionIdGenerator_;
   // Indices of dataChannel are stored in ascending order
@@ -621,6 +663,15 @@ class HiveDataSink : public DataSink {
 
   // Reusable buffers for bucket id calculations.
   std::vector<uint32_t> bucketIds_;
+
+  // Set for a clustered write. The clustered input holds the data columns
+  // followed by the partition and the bucket id columns. 'clusteredWriter_'
+  // sorts it in 'clusteredSortPool_' and feeds it to a ClusteredWriter.
+  RowTypePtr clusteredInputType_;
+  std::shared_ptr<memory::MemoryPool> clusteredPool_;
+  std::shared_ptr<memory::MemoryPool> clusteredSortPool_;
+  common::SpillStats clusteredSpillStats_;
+  std::unique_ptr<dwio::common::Writer> clusteredWriter_;
 };
 
 } // namespace bytedance::bolt::connector::hive
@@ -45,6 +45,7 @@
 #include "bolt/dwio/common/ReaderFactory.h"
 #include "bolt/dwio/common/exception/Exception.h"
 #include "bolt/expression/FieldReference.h"
+#include "bolt/type/NumericTypeUtils.h"
 namespace bytedance::bolt::connector::hive {
 
 class HiveTableHandle;
@@ -345,6 +346,10 @@ std::unique_ptr<SplitReader> HiveDataSource::createConfiguredSplitReader(
 
   auto splitReader = createSplitReader(split, isPartOfPaimonSplit);
   splitReader->configureReaderOptions();
+  if (metadataAggregation_ && !isPartOfPaimonSplit) {
+    splitReader->rowReaderOptions().setMetadataAggregation(
+        metadataAggregation_);
+  }
   splitReader->rowReaderOptions().setAppendParquetRowNumberAndFileName(
       enable_parquet_rownum_and_filename);
 
@@ -808,6 +813,10 @@ void HiveDataSource::setFromDataSource(
     std::unique_ptr<DataSource> sourceUnique) {
   auto source = dynamic_cast<HiveDataSource*>(sourceUnique.get());
   BOLT_CHECK(source, "Bad DataSource type");
+  // The row readers of 'source' do not answer aggregates from metadata.
+  BOLT_CHECK_NULL(
+      metadataAggregation_,
+      "Preloaded splits do not support metadata aggregates");
 
   split_ = std::move(source->split_);
   if (source->splitReader_ && source->splitReader_->emptySplit()) {
@@ -828,6 +837,94 @@ void HiveDataSource::setFromDataSource(
   connectorQueryCtx_ = std::move(source->connectorQueryCtx_);
 }
 
+namespace {
+
+variant integerVariant(TypeKind kind, int64_t value) {
+  switch (kind) {
+    case TypeKind::BIGINT:
+      return variant(value);
+    case TypeKind::INTEGER:
+      return variant(static_cast<int32_t>(value));
+    case TypeKind::SMALLINT:
+      return variant(static_cast<int16_t>(value));
+    case TypeKind::TINYINT:
+      return variant(static_cast<int8_t>(value));
+    default:
+      BOLT_UNREACHABLE();
+  }
+}
+
+} // namespace
+
+bool HiveDataSource::pushdownMetadataAggregates(
+    const std::vector<MetadataAggregate>& aggregates) {
+  BOLT_CHECK_NULL(
+      split_, "Metadata aggregates must be pushed down before any split");
+  // Rows dropped by the remaining filter are not visible in the metadata.
+  if (remainingFilterExprSet_ != nullptr || aggregates.empty()) {
+    return false;
+  }
+  using Kind = dwio::common::MetadataAggregation::Kind;
+  std::vector<dwio::common::MetadataAggregation::Aggregate> readerAggregates;
+  std::vector<TypePtr> types;
+  for (const auto& aggregate : aggregates) {
+    if (!aggregate.channel.has_value()) {
+      BOLT_CHECK(aggregate.kind == MetadataAggregate::Kind::kCount);
+      readerAggregates.push_back({Kind::kCount, ""});
+      types.push_back(BIGINT());
+      continue;
+    }
+    const auto channel = aggregate.channel.value();
+    BOLT_CHECK_LT(channel, outputType_->size());
+    const auto& name = readerOutputType_->nameOf(channel);
+    if (partitionKeys_.count(name) > 0 || infoColumns_.count(name) > 0) {
+      return false;
+    }
+    switch (aggregate.kind) {
+      case MetadataAggregate::Kind::kCount:
+        readerAggregates.push_back({Kind::kCount, name});
+        types.push_back(BIGINT());
+        break;
+      case MetadataAggregate::Kind::kMin:
+      case MetadataAggregate::Kind::kMax: {
+        const auto& type = outputType_->childAt(channel);
+        if (!bolt::type::NumericTypeUtils::isIntegralType(type)) {
+          return false;
+        }
+        readerAggregates.push_back(
+            {aggregate.kind == MetadataAggregate::Kind::kMin ? Kind::kMin
+                                                             : Kind::kMax,
+             name});
+        types.push_back(type);
+        break;
+      }
+    }
+  }
+  metadataAggregation_ = std::make_shared<dwio::common::MetadataAggregation>(
+      std::move(readerAggregates));
+  metadataAggregateTypes_ = std::move(types);
+  return true;
+}
+
+std::vector<variant> HiveDataSource::takeMetadataAggregates() {
+  BOLT_CHECK_NOT_NULL(metadataAggregation_);
+  const auto results = metadataAggregation_->takeResults();
+  std::vector<variant> values;
+  values.reserve(results.size());
+  for (auto i = 0; i < results.size(); ++i) {
+    const auto& aggregate = metadataAggregation_->aggregates()[i];
+    const auto kind = metadataAggregateTypes_[i]->kind();
+    if (aggregate.kind == dwio::common::MetadataAggregation::Kind::kCount) {
+      values.emplace_back(results[i].count);
+    } else if (!results[i].value.has_value()) {
+      values.push_back(variant::null(kind));
+    } else {
+      values.push_back(integerVariant(kind, results[i].value.value()));
+    }
+  }
+  return values;
+}
+
 int64_t HiveDataSource::estimatedRowSize() {
   if (!splitReader_) {
     return kUnknownRowSize;
@@ -40,6 +40,7 @@
 #include "bolt/connectors/hive/TableHandle.h"
 #include "bolt/core/QueryConfig.h"
 #include "bolt/dwio/common/BufferedInput.h"
+#include "bolt/dwio/common/MetadataAggregation.h"
 #include "bolt/dwio/common/Reader.h"
 #include "bolt/dwio/common/ScanSpec.h"
 #include "bolt/dwio/common/Statistics.h"
@@ -105,6 +106,11 @@ class HiveDataSource : public DataSource {
 
   int64_t estimatedRowSize() override;
 
+  bool pushdownMetadataAggregates(
+      const std::vector<MetadataAggregate>& aggregates) override;
+
+  std::vector<variant> takeMetadataAggregates() override;
+
   std::unique_ptr<SplitReader> createConfiguredSplitReader(
       const std::shared_ptr<HiveConnectorSplit>& split,
       const bool isPartOfPaimonSplit);
@@ -201,6 +207,12 @@ class HiveDataSource : public DataSource {
 
   std::shared_ptr<common::MetadataFilter> metadataFilter_;
   std::unique_ptr<exec::ExprSet> remainingFilterExprSet_;
+
+  // Set by pushdownMetadataAggregates(). Shared with the row readers, which
+  // add the row groups they answer from statistics to it.
+  std::shared_ptr<dwio::common::MetadataAggregation> metadataAggregation_;
+  // Result type of each aggregate in 'metadataAggregation_'.
+  std::vector<TypePtr> metadataAggregateTypes_;
   RowVectorPtr emptyOutput_;
   bool emptySplit_;
   bool native_cache_enabled;
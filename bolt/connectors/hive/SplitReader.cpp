@@ -330,6 +330,12 @@ void SplitReader::prepareSplit(
       hiveSplit_,
       hiveConfig_,
       connectorQueryCtx_->sessionProperties());
+  // Rows deleted by a deletion vector are not visible in the statistics.
+  auto deletionFile = hiveSplit_->customSplitInfo.find(KPaimonDeletionFilePath);
+  if (deletionFile != hiveSplit_->customSplitInfo.end() &&
+      !deletionFile->second.empty()) {
+    baseRowReaderOpts_.setMetadataAggregation(nullptr);
+  }
   // NOTE: we firstly reset the finished 'baseRowReader_' of previous split
   // before setting up for the next one to avoid doubling the peak memory usage.
   baseRowReader_.reset();
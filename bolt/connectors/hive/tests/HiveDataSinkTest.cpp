@@ -32,6 +32,7 @@
 #include "bolt/exec/tests/utils/HiveConnectorTestBase.h"
 
 #include <folly/init/Init.h>
+#include <folly/json.h>
 #include <re2/re2.h>
 #include "bolt/common/base/Fs.h"
 #include "bolt/common/base/tests/GTestUtils.h"
@@ -579,6 +580,75 @@ TEST_F(HiveDataSinkTest, basicBucket) {
   verifyWrittenData(outputDirectory->getPath(), numBuckets);
 }
 
+TEST_F(HiveDataSinkTest, clusteredWrite) {
+  connectorConfig_ =
+      std::make_shared<HiveConfig>(std::make_shared<config::ConfigBase>(
+          std::unordered_map<std::string, std::string>{
+              {HiveConfig::kClusteredWriteEnabled, "true"}}));
+  const int numBatches = 10;
+  const int batchSize = 500;
+
+  {
+    SCOPED_TRACE("bucketed");
+    const auto outputDirectory = TempDirectoryPath::create();
+    const int32_t numBuckets = 4;
+    auto bucketProperty = std::make_shared<HiveBucketProperty>(
+        HiveBucketProperty::Kind::kHiveCompatible,
+        numBuckets,
+        std::vector<std::string>{"c0"},
+        std::vector<TypePtr>{BIGINT()},
+        std::vector<std::shared_ptr<const HiveSortingColumn>>{
+            std::make_shared<HiveSortingColumn>(
+                "c1", core::SortOrder{false, false})});
+    auto dataSink = createDataSink(
+        rowType_,
+        outputDirectory->getPath(),
+        dwio::common::FileFormat::DWRF,
+        {},
+        bucketProperty);
+    const auto vectors = createVectors(batchSize, numBatches);
+    for (const auto& vector : vectors) {
+      dataSink->appendData(vector);
+    }
+    // Nothing is written before the input is complete.
+    ASSERT_EQ(dataSink->stats().numWrittenBytes, 0);
+
+    const auto partitions = dataSink->close();
+    ASSERT_EQ(partitions.size(), numBuckets);
+    ASSERT_EQ(dataSink->stats().numWrittenFiles, numBuckets);
+    createDuckDbTable(vectors);
+    verifyWrittenData(outputDirectory->getPath(), numBuckets);
+  }
+
+  {
+    SCOPED_TRACE("partitioned");
+    // More partitions than the open writer limit of 100.
+    const int32_t numPartitions = 150;
+    const auto outputDirectory = TempDirectoryPath::create();
+    auto dataSink = createDataSink(
+        rowType_,
+        outputDirectory->getPath(),
+        dwio::common::FileFormat::DWRF,
+        {"c2"});
+    auto vectors = createVectors(batchSize, numBatches);
+    for (auto& vector : vectors) {
+      vector->childAt(2) = makeFlatVector<int16_t>(
+          vector->size(), [&](auto row) { return row % numPartitions; });
+      dataSink->appendData(vector);
+    }
+
+    const auto partitions = dataSink->close();
+    ASSERT_EQ(partitions.size(), numPartitions);
+    ASSERT_EQ(dataSink->stats().numWrittenFiles, numPartitions);
+    ASSERT_EQ(listFiles(outputDirectory->getPath()).size(), numPartitions);
+    int64_t numWrittenRows = 0;
+    for (const auto& partition : partitions) {
+      numWrittenRows += folly::parseJson(partition)["rowCount"].asInt();
+    }
+    ASSERT_EQ(numWrittenRows, numBatches * batchSize);
+  }
+}
+
 TEST_F(HiveDataSinkTest, close) {
   for (bool empty : {true, false}) {
     SCOPED_TRACE(fmt::format("Data sink is empty: {}", empty));
@@ -88,6 +88,14 @@ class QueryConfig {
   static constexpr const char* kOperatorTrackCpuUsage =
       "track_operator_cpu_usage";
 
+  /// Whether to count cycles, instructions, last level cache misses, branch
+  /// misses and data TLB misses of individual operators with hardware perf
+  /// counters and report them as runtime stats, e.g. 'perfLlcMisses'. False
+  /// by default. Nothing is reported where the process has no access to
+  /// perf events.
+  static constexpr const char* kOperatorTrackPerfCounters =
+      "track_operator_perf_counters";
+
   /// Flags used to configure the CAST operator:
 
   static constexpr const char* kLegacyCast = "legacy_cast";
@@ -168,6 +176,14 @@ class QueryConfig {
   static constexpr const char* kHashAggregationCompositeOutputAccumulatorRatio =
       "hashaggregation_composite_output_accumulator_ratio";
 
+  /// Number of hash bits used to radix partition a final or single hash
+  /// aggregation into independent grouping sets, each with its own small hash
+  /// table and row container. Keeps inserts cache resident for high
+  /// cardinality group by. The bits start at the spill start partition bit. 0
+  /// disables radix partitioning.
+  static constexpr const char* kHashAggregationRadixPartitionBits =
+      "hashaggregation_radix_partition_bits";
+
   static constexpr const char* kAdaptiveSkippedDataSizeThreshold =
       "adaptive_skipped_datasize_threshold";
 
@@ -180,6 +196,14 @@ class QueryConfig {
   static constexpr const char* kMaxPartitionedOutputBufferSize =
       "max_page_partitioning_buffer_size";
 
+  /// PartitionedOutput with at least this many destinations sorts each input
+  /// batch by partition once and serializes every destination from a
+  /// contiguous slice of the sorted batch. Batches with rows that are
+  /// replicated to every destination are not gathered. 0 disables the
+  /// partition-major gather.
+  static constexpr const char* kPartitionMajorGatherMinDestinations =
+      "partitioned_output_partition_major_gather_min_destinations";
+
   /// Deprecated. Use kMaxOutputBufferSize instead.
   static constexpr const char* kMaxArbitraryBufferSize =
       "max_arbitrary_buffer_size";
@@ -207,6 +231,18 @@ class QueryConfig {
 
   static constexpr const char* kMinOutputBatchRows = "min_output_batch_rows";
 
+  /// If true, the output batch sizes above are scaled per task with the
+  /// memory headroom of the query: up while the query uses less than half of
+  /// the memory it can get and down while it uses more than 80%. The factor
+  /// is bounded by kAdaptiveOutputBatchMaxScale and its inverse.
+  static constexpr const char* kAdaptiveOutputBatchSizing =
+      "adaptive_output_batch_sizing";
+
+  /// Upper bound of the scale factor of adaptive_output_batch_sizing. Must be
+  /// at least 1.
+  static constexpr const char* kAdaptiveOutputBatchMaxScale =
+      "adaptive_output_batch_max_scale";
+
   /// TableScan operator will exit getOutput() method after this many
   /// milliseconds even if it has no data to return yet. Zero means 'no time
   /// limit'.
@@ -232,6 +268,13 @@ class QueryConfig {
 
   static constexpr const char* kHllSketchRounded = "hll_sketch_rounded";
 
+  /// If true, a partial global aggregation of only count, min and max that
+  /// reads directly from a table scan has the scan answer the row groups
+  /// whose rows all pass the filters from file statistics instead of reading
+  /// them.
+  static constexpr const char* kAggregationMetadataPushdown =
+      "aggregation_metadata_pushdown";
+
   static constexpr const char* kSpilledAggregationBypassHTRatio =
       "spilled_aggregation_bypass_hashtable_ratio";
 
@@ -245,6 +288,18 @@ class QueryConfig {
   static constexpr const char* kOrderBySpillInOutputStageEnabled =
       "order_by_spill_output_stage_enabled";
 
+  /// Number of key ranges that the sorted runs of a spilled OrderBy are
+  /// merged in. The driver merges the first range while the query executor
+  /// merges each of the others into a new spill file that is read back in
+  /// order. 1 merges all runs on the driver.
+  ///
+  /// Each range merged on the executor reads the runs from their start,
+  /// skipping the rows before the range, and writes its rows again, so the
+  /// spill IO grows with this setting. The ranges are all merged at once and
+  /// their memory cannot be reclaimed by spilling.
+  static constexpr const char* kOrderBySpillMergeParallelism =
+      "order_by_spill_merge_parallelism";
+
   /// Window spilling flag, only applies if "spill_enabled" flag is set.
   static constexpr const char* kWindowSpillEnabled = "window_spill_enabled";
 
@@ -289,6 +344,28 @@ class QueryConfig {
   static constexpr const char* kOrderBySpillMemoryThreshold =
       "order_by_spill_memory_threshold";
 
+  /// Maximum number of bytes of the normalized sort keys that prefix sort
+  /// encodes per row in OrderBy, TopN, window and spill sorts. 0 disables
+  /// prefix sort.
+  static constexpr const char* kPrefixSortNormalizedKeyMaxBytes =
+      "prefixsort_normalized_key_max_bytes";
+
+  /// Minimum number of rows to sort with prefix sort. Smaller inputs are
+  /// sorted by comparing the rows.
+  static constexpr const char* kPrefixSortMinRows = "prefixsort_min_rows";
+
+  /// Number of leading bytes of a VARCHAR or VARBINARY sort key that prefix
+  /// sort encodes. Rows whose prefixes tie are compared in full.
+  static constexpr const char* kPrefixSortMaxStringPrefixLength =
+      "prefixsort_max_string_prefix_length";
+
+  /// If true, TopN pushes the leading sort key value of its current last row
+  /// down to the table scan as a dynamic filter once it holds 'count' rows,
+  /// so that the scan drops rows, row groups and splits that cannot make the
+  /// top rows.
+  static constexpr const char* kTopNDynamicFilterEnabled =
+      "topn_dynamic_filter_enabled";
+
   /// The threshold for enabling LZ4 spill compression.
   static constexpr const char* kSpillLowCompressByteThreshold =
       "spill_low_compress_byte_threshold";
@@ -430,6 +507,19 @@ class QueryConfig {
   static constexpr const char* kMinTableRowsForParallelJoinBuild =
       "min_table_rows_for_parallel_join_build";
 
+  /// Hash join build sides in kHash mode whose rows take at most this many
+  /// bytes have their rows copied into one contiguous block in table order
+  /// before probing. 0 disables the compaction.
+  static constexpr const char* kHashJoinCompactTableMaxBytes =
+      "hash_join_compact_table_max_bytes";
+
+  /// If true, HashProbe outputs the build side columns as lazy vectors that
+  /// keep references to the matched build rows and copy the values out of the
+  /// hash table only for the rows that a later operator loads. Only applies to
+  /// joins that cannot spill.
+  static constexpr const char* kHashJoinLateMaterializationEnabled =
+      "hash_join_late_materialization_enabled";
+
   static constexpr const char* kExchangeCompression = "exchange_compression";
 
   static constexpr const char* kNativeCacheEnabled = "native_cache_enabled";
@@ -467,6 +557,14 @@ class QueryConfig {
 
   static constexpr const char* kPreloadBytesLimit = "preload_bytes_limit";
 
+  /// Table scan splits larger than about this many bytes are read in parts
+  /// of this size. The part at the head of the split queue is taken by the
+  /// next driver that needs a split, so idle drivers take over the rest of a
+  /// large file from the driver that reads its first part. Splits are only
+  /// divided at row group or stripe boundaries. 0 disables dividing splits.
+  static constexpr const char* kTableScanSubSplitBytes =
+      "table_scan_sub_split_bytes";
+
   static constexpr const char* kPreloadAdaptive = "preload_adaptive_enabled";
 
   /// If not zero, specifies the cpu time slice limit in ms that a driver thread
@@ -475,6 +573,16 @@ class QueryConfig {
   static constexpr const char* kDriverCpuTimeSliceLimitMs =
       "driver_cpu_time_slice_limit_ms";
 
+  /// If true, each task is assigned a NUMA node by a hash of its id and the
+  /// executor threads running its drivers are pinned to that node, so that
+  /// the memory a driver allocates is used from the node it was allocated
+  /// on and both sides of a join share a node. A thread stays pinned after
+  /// the driver goes off thread and is only pinned again for a driver of
+  /// another node. It gets its previous CPU affinity back when it runs a
+  /// driver of a query without pinning. Has no effect on single node hosts
+  /// unless --bolt_numa_topology is set.
+  static constexpr const char* kNumaDriverPinning = "numa_driver_pinning";
+
   /// Enable query tracing flag.
   static constexpr const char* kQueryTraceEnabled = "query_trace_enabled";
 
@@ -521,6 +629,25 @@ class QueryConfig {
       "get_json_object_escape_emoji";
   static constexpr const char* kUseSonicJson = "use_sonic_json";
 
+  /// If true, get_json_object calls of an expression set that read the same
+  /// json input with constant paths are evaluated together, parsing each
+  /// document once for all the paths.
+  static constexpr const char* kFuseGetJsonObject = "fuse_get_json_object";
+
+  /// Number of input rows TorchOperator coalesces into one inference call.
+  /// When 0, every input is run on its own, in completion order.
+  static constexpr const char* kTorchOperatorBatchRows =
+      "torch_operator_batch_rows";
+
+  /// Maximum number of TorchOperator micro batches being run or waiting to be
+  /// consumed before the operator stops taking input.
+  static constexpr const char* kTorchOperatorMaxPendingBatches =
+      "torch_operator_max_pending_batches";
+
+  /// Number of threads each TorchOperator runs inference on.
+  static constexpr const char* kTorchOperatorNumThreads =
+      "torch_operator_num_threads";
+
   static constexpr const char* kThrowExceptionWhenEncounterBadTimestamp =
       "throw_exception_when_encounter_bad_timestamp";
 
@@ -788,6 +915,12 @@ class QueryConfig {
     return get<int32_t>(kHashAggregationCompositeOutputAccumulatorRatio, 5);
   }
 
+  uint8_t hashAggregationRadixPartitionBits() const {
+    constexpr uint8_t kMaxBits = 8;
+    return std::min(
+        kMaxBits, get<uint8_t>(kHashAggregationRadixPartitionBits, 0));
+  }
+
   uint64_t adaptiveSkippedDataSizeThreshold() const {
     return get<uint64_t>(kAdaptiveSkippedDataSizeThreshold, 20UL << 30);
   }
@@ -819,6 +952,22 @@ class QueryConfig {
     return get<uint64_t>(kOrderBySpillMemoryThreshold, kDefault);
   }
 
+  uint32_t prefixSortNormalizedKeyMaxBytes() const {
+    return get<uint32_t>(kPrefixSortNormalizedKeyMaxBytes, 128);
+  }
+
+  uint32_t prefixSortMinRows() const {
+    return get<uint32_t>(kPrefixSortMinRows, 128);
+  }
+
+  uint32_t prefixSortMaxStringPrefixLength() const {
+    return get<uint32_t>(kPrefixSortMaxStringPrefixLength, 16);
+  }
+
+  bool topNDynamicFilterEnabled() const {
+    return get<bool>(kTopNDynamicFilterEnabled, true);
+  }
+
   uint64_t spillLowCompressByteThreshold() const {
     static constexpr uint64_t kDefault = 4UL << 30;
     return get<uint64_t>(kSpillLowCompressByteThreshold, kDefault);
@@ -854,6 +1003,10 @@ class QueryConfig {
     return get<uint64_t>(kMaxPartitionedOutputBufferSize, kDefault);
   }
 
+  uint32_t partitionMajorGatherMinDestinations() const {
+    return get<uint32_t>(kPartitionMajorGatherMinDestinations, 64);
+  }
+
   /// Returns the maximum size in bytes for the task's buffered output.
   ///
   /// The producer Drivers are blocked when the buffered size exceeds
@@ -901,6 +1054,17 @@ class QueryConfig {
     return get<uint32_t>(kMinOutputBatchRows, 1);
   }
 
+  bool adaptiveOutputBatchSizing() const {
+    return get<bool>(kAdaptiveOutputBatchSizing, false);
+  }
+
+  double adaptiveOutputBatchMaxScale() const {
+    const auto value = get<double>(kAdaptiveOutputBatchMaxScale, 4);
+    BOLT_USER_CHECK_GE(
+        value, 1, "{} must be at least 1", kAdaptiveOutputBatchMaxScale);
+    return value;
+  }
+
   uint32_t tableScanGetOutputTimeLimitMs() const {
     return get<uint64_t>(kTableScanGetOutputTimeLimitMs, 5'000);
   }
@@ -998,6 +1162,10 @@ class QueryConfig {
     return get<bool>(kAggregationSpillEnabled, true);
   }
 
+  bool aggregationMetadataPushdown() const {
+    return get<bool>(kAggregationMetadataPushdown, false);
+  }
+
   /// Returns 'is hll sketch return rounded result' flag.
   bool hllSketchRounded() const {
 #ifdef ES_COMPATIBLE
@@ -1033,6 +1201,10 @@ class QueryConfig {
     return get<bool>(kOrderBySpillInOutputStageEnabled, true);
   }
 
+  uint32_t orderBySpillMergeParallelism() const {
+    return get<uint32_t>(kOrderBySpillMergeParallelism, 1);
+  }
+
   /// Returns true if spilling is enabled for Window operator. Must also
   /// check the spillEnabled()!
   bool windowSpillEnabled() const {
@@ -1310,6 +1482,10 @@ class QueryConfig {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
 
+  bool operatorTrackPerfCounters() const {
+    return get<bool>(kOperatorTrackPerfCounters, false);
+  }
+
   uint32_t taskWriterCount() const {
     return get<uint32_t>(kTaskWriterCount, 4);
   }
@@ -1327,6 +1503,14 @@ class QueryConfig {
     return get<uint32_t>(kMinTableRowsForParallelJoinBuild, 1'000);
   }
 
+  uint64_t hashJoinCompactTableMaxBytes() const {
+    return get<uint64_t>(kHashJoinCompactTableMaxBytes, 1L << 20);
+  }
+
+  bool hashJoinLateMaterializationEnabled() const {
+    return get<bool>(kHashJoinLateMaterializationEnabled, false);
+  }
+
   bool isExchangeCompressionEnabled() const {
     return get<bool>(kExchangeCompression, false);
   }
@@ -1371,6 +1555,10 @@ class QueryConfig {
     return get<int32_t>(kMaxSplitPreloadPerDriver, 2);
   }
 
+  uint64_t tableScanSubSplitBytes() const {
+    return get<uint64_t>(kTableScanSubSplitBytes, 0);
+  }
+
   int64_t preloadBytesLimit() const {
     return get<int64_t>(kPreloadBytesLimit, (1ULL << 30));
   }
@@ -1383,6 +1571,10 @@ class QueryConfig {
     return get<uint32_t>(kDriverCpuTimeSliceLimitMs, 0);
   }
 
+  bool numaDriverPinning() const {
+    return get<bool>(kNumaDriverPinning, false);
+  }
+
   bool iskEstimateRowSizeBasedOnSampleEnabled() const {
     return get<bool>(kEnableEstimateRowSizeBasedOnSample, false);
   }
@@ -1403,6 +1595,22 @@ class QueryConfig {
     return get<bool>(kUseSonicJson, true);
   }
 
+  bool fuseGetJsonObject() const {
+    return get<bool>(kFuseGetJsonObject, false);
+  }
+
+  int32_t torchOperatorBatchRows() const {
+    return get<int32_t>(kTorchOperatorBatchRows, 0);
+  }
+
+  int32_t torchOperatorMaxPendingBatches() const {
+    return get<int32_t>(kTorchOperatorMaxPendingBatches, 2);
+  }
+
+  int32_t torchOperatorNumThreads() const {
+    return get<int32_t>(kTorchOperatorNumThreads, 4);
+  }
+
   bool throwExceptionWhenEncounterBadTimestamp() const {
     return get<bool>(kThrowExceptionWhenEncounterBadTimestamp, false);
   }
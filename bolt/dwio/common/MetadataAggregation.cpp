@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/dwio/common/MetadataAggregation.h"
+
+#include <algorithm>
+
+#include "bolt/common/base/Exceptions.h"
+#include "bolt/dwio/common/ScanSpec.h"
+#include "bolt/type/NumericTypeUtils.h"
+namespace bytedance::bolt::dwio::common {
+
+MetadataAggregation::MetadataAggregation(std::vector<Aggregate> aggregates)
+    : aggregates_(std::move(aggregates)), results_(aggregates_.size()) {
+  BOLT_CHECK(!aggregates_.empty());
+  for (const auto& aggregate : aggregates_) {
+    BOLT_CHECK(
+        aggregate.kind == Kind::kCount || !aggregate.column.empty(),
+        "min and max need a column");
+  }
+}
+
+bool MetadataAggregation::allRowsPass(
+    const bolt::common::ScanSpec& scanSpec,
+    uint64_t numRows,
+    const ColumnStatsFunc& columnStats) const {
+  for (const auto& child : scanSpec.children()) {
+    if (child->numMetadataFilters() > 0) {
+      return false;
+    }
+    if (!child->hasFilter()) {
+      continue;
+    }
+    // Filters on constant columns and on nested fields are left to the
+    // reader.
+    auto* filter = child->filter();
+    if (filter == nullptr || child->isConstant()) {
+      return false;
+    }
+    for (const auto& grandchild : child->children()) {
+      if (grandchild->hasFilter()) {
+        return false;
+      }
+    }
+    auto stats = columnStats(child->fieldName());
+    if (!stats.stats ||
+        !bolt::common::testFilterAll(
+            filter, stats.stats.get(), numRows, stats.type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool MetadataAggregation::addRowGroup(
+    const bolt::common::ScanSpec& scanSpec,
+    uint64_t numRows,
+    const ColumnStatsFunc& columnStats) {
+  if (!allRowsPass(scanSpec, numRows, columnStats)) {
+    return false;
+  }
+  std::vector<Result> rowGroupResults(aggregates_.size());
+  for (auto i = 0; i < aggregates_.size(); ++i) {
+    const auto& aggregate = aggregates_[i];
+    if (aggregate.column.empty()) {
+      rowGroupResults[i].count = numRows;
+      continue;
+    }
+    auto stats = columnStats(aggregate.column);
+    if (!stats.stats || !stats.stats->getNumberOfValues().has_value()) {
+      return false;
+    }
+    const auto numValues = stats.stats->getNumberOfValues().value();
+    if (aggregate.kind == Kind::kCount) {
+      rowGroupResults[i].count = numValues;
+      continue;
+    }
+    if (numValues == 0) {
+      continue;
+    }
+    auto* intStats = dynamic_cast<IntegerColumnStatistics*>(stats.stats.get());
+    if (!type::NumericTypeUtils::isIntegralType(stats.type) ||
+        intStats == nullptr) {
+      return false;
+    }
+    rowGroupResults[i].value = aggregate.kind == Kind::kMin
+        ? intStats->getMinimum()
+        : intStats->getMaximum();
+    if (!rowGroupResults[i].value.has_value()) {
+      return false;
+    }
+  }
+
+  for (auto i = 0; i < aggregates_.size(); ++i) {
+    auto& result = results_[i];
+    const auto& rowGroupResult = rowGroupResults[i];
+    result.count += rowGroupResult.count;
+    if (!rowGroupResult.value.has_value()) {
+      continue;
+    }
+    if (!result.value.has_value()) {
+      result.value = rowGroupResult.value;
+    } else if (aggregates_[i].kind == Kind::kMin) {
+      result.value = std::min(*result.value, *rowGroupResult.value);
+    } else {
+      result.value = std::max(*result.value, *rowGroupResult.value);
+    }
+  }
+  ++numRowGroups_;
+  return true;
+}
+
+std::vector<MetadataAggregation::Result> MetadataAggregation::takeResults() {
+  std::vector<Result> results(aggregates_.size());
+  results.swap(results_);
+  return results;
+}
+
+} // namespace bytedance::bolt::dwio::common
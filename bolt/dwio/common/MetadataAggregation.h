@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "bolt/dwio/common/Statistics.h"
+#include "bolt/type/Type.h"
+namespace bytedance::bolt::common {
+class ScanSpec;
+}
+namespace bytedance::bolt::dwio::common {
+
+/// Aggregates over the rows of a scan that a reader may compute from column
+/// statistics instead of decoding the rows. A reader offers each row group or
+/// stripe to addRowGroup() and skips the ones it accepts: those whose rows
+/// all pass the filters of the scan and whose statistics answer every
+/// aggregate. The partial results of the accepted row groups accumulate until
+/// takeResults() is called. Not thread-safe.
+class MetadataAggregation {
+ public:
+  enum class Kind { kCount, kMin, kMax };
+
+  struct Aggregate {
+    Kind kind;
+    /// Top-level column of the file the aggregate reads. Empty for count(*).
+    /// min and max are supported on integer columns only.
+    std::string column;
+  };
+
+  /// Partial result of one aggregate.
+  struct Result {
+    /// Number of rows for count(*), of non-null values for count(column).
+    int64_t count{0};
+    /// Smallest or largest value for min and max. Unset if no non-null value
+    /// was seen.
+    std::optional<int64_t> value;
+  };
+
+  /// Statistics of a top-level column of the file in the row group being
+  /// added. 'stats' is null if there are none.
+  struct ColumnStats {
+    std::unique_ptr<ColumnStatistics> stats;
+    TypePtr type;
+  };
+
+  using ColumnStatsFunc = std::function<ColumnStats(const std::string&)>;
+
+  explicit MetadataAggregation(std::vector<Aggregate> aggregates);
+
+  const std::vector<Aggregate>& aggregates() const {
+    return aggregates_;
+  }
+
+  /// Adds a row group of 'numRows' rows to the results if the statistics
+  /// from 'columnStats' prove that all its rows pass the filters in
+  /// 'scanSpec' and answer all aggregates. Returns true if the row group was
+  /// added. The reader must then skip it. Returns false and leaves the
+  /// results unchanged otherwise.
+  bool addRowGroup(
+      const bolt::common::ScanSpec& scanSpec,
+      uint64_t numRows,
+      const ColumnStatsFunc& columnStats);
+
+  /// Returns the results accumulated since the last call, one per aggregate,
+  /// and resets them.
+  std::vector<Result> takeResults();
+
+  /// Number of row groups added so far.
+  uint64_t numRowGroups() const {
+    return numRowGroups_;
+  }
+
+ private:
+  // Returns true if all 'numRows' rows pass the filters of 'scanSpec'.
+  bool allRowsPass(
+      const bolt::common::ScanSpec& scanSpec,
+      uint64_t numRows,
+      const ColumnStatsFunc& columnStats) const;
+
+  const std::vector<Aggregate> aggregates_;
+  std::vector<Result> results_;
+  uint64_t numRowGroups_{0};
+};
+
+} // namespace bytedance::bolt::dwio::common
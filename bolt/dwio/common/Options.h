@@ -44,6 +44,7 @@
 #include "bolt/dwio/common/FlatMapHelper.h"
 #include "bolt/dwio/common/FlushPolicy.h"
 #include "bolt/dwio/common/InputStream.h"
+#include "bolt/dwio/common/MetadataAggregation.h"
 #include "bolt/dwio/common/ScanSpec.h"
 #include "bolt/dwio/common/encryption/Encryption.h"
 namespace bytedance::bolt::dwio::common {
@@ -125,6 +126,9 @@ class RowReaderOptions {
   std::shared_ptr<ColumnSelector> selector_;
   std::shared_ptr<bolt::common::ScanSpec> scanSpec_ = nullptr;
   std::shared_ptr<bolt::common::MetadataFilter> metadataFilter_;
+  // Aggregates to answer from statistics for row groups or stripes whose
+  // rows all pass the filters. Such row groups are not read.
+  std::shared_ptr<MetadataAggregation> metadataAggregation_;
   // Node id for map column to a list of keys to be projected as a struct.
   std::unordered_map<uint32_t, std::vector<std::string>> flatmapNodeIdAsStruct_;
   // Optional executors to enable internal reader parallelism.
@@ -319,6 +323,15 @@ class RowReaderOptions {
     metadataFilter_ = std::move(metadataFilter);
   }
 
+  const std::shared_ptr<MetadataAggregation>& getMetadataAggregation() const {
+    return metadataAggregation_;
+  }
+
+  void setMetadataAggregation(
+      std::shared_ptr<MetadataAggregation> metadataAggregation) {
+    metadataAggregation_ = std::move(metadataAggregation);
+  }
+
   void setFlatmapNodeIdsAsStruct(
       std::unordered_map<uint32_t, std::vector<std::string>>
           flatmapNodeIdsAsStruct) {
@@ -340,6 +340,18 @@ bool testStringFilter(
     }
   }
 
+  if (stringStats->getBlockBloomFilter() &&
+      filter->kind() == FilterKind::kBytesRange) {
+    auto* bytesRangeFilter = reinterpret_cast<BytesRange*>(filter);
+    if (bytesRangeFilter->isSingleValue()) {
+      auto hash =
+          stringStats->getBlockBloomFilter()->Hash(bytesRangeFilter->lower());
+      if (!stringStats->getBlockBloomFilter()->mayContain(hash)) {
+        return false;
+      }
+    }
+  }
+
   if (stringStats->getMinimum().has_value() &&
       stringStats->getMaximum().has_value()) {
     const auto& min = stringStats->getMinimum().value();
@@ -410,6 +422,31 @@ bool testBloomFilter(
   return filter->testBloomFilter(stringStats->getTokenBloomFilters());
 }
 
+bool bigintRangeContains(const BigintRange& range, int64_t min, int64_t max) {
+  return range.lower() <= min && max <= range.upper();
+}
+
+bool testIntFilterAll(common::Filter* filter, int64_t min, int64_t max) {
+  if (min == max) {
+    return filter->testInt64(min);
+  }
+  switch (filter->kind()) {
+    case FilterKind::kBigintRange:
+      return bigintRangeContains(
+          *static_cast<BigintRange*>(filter), min, max);
+    case FilterKind::kBigintMultiRange:
+      for (const auto& range :
+           static_cast<BigintMultiRange*>(filter)->ranges()) {
+        if (bigintRangeContains(*range, min, max)) {
+          return true;
+        }
+      }
+      return false;
+    default:
+      return false;
+  }
+}
+
 } // namespace
 
 bool testFilter(
@@ -477,6 +514,51 @@ bool testFilter(
   return true;
 }
 
+bool testFilterAll(
+    common::Filter* filter,
+    dwio::common::ColumnStatistics* stats,
+    uint64_t totalRows,
+    const TypePtr& type) {
+  if (!stats || !stats->getNumberOfValues().has_value()) {
+    return false;
+  }
+  const auto numValues = stats->getNumberOfValues().value();
+  if (numValues < totalRows && !filter->testNull()) {
+    return false;
+  }
+  if (numValues == 0) {
+    return true;
+  }
+  if (filter->kind() == FilterKind::kAlwaysTrue ||
+      filter->kind() == FilterKind::kIsNotNull) {
+    return true;
+  }
+  // Only integer bounds are exact. String bounds may be truncated and
+  // floating point bounds may leave out NaNs.
+  if (type->isDecimal()) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::BIGINT:
+    case TypeKind::INTEGER:
+    case TypeKind::SMALLINT:
+    case TypeKind::TINYINT: {
+      auto* intStats =
+          dynamic_cast<dwio::common::IntegerColumnStatistics*>(stats);
+      if (!intStats || !intStats->getMinimum().has_value() ||
+          !intStats->getMaximum().has_value()) {
+        return false;
+      }
+      return testIntFilterAll(
+          filter,
+          intStats->getMinimum().value(),
+          intStats->getMaximum().value());
+    }
+    default:
+      return false;
+  }
+}
+
 ScanSpec& ScanSpec::getChildByChannel(column_index_t channel) {
   for (auto& child : children_) {
     if (child->channel_ == channel) {
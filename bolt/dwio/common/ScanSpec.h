@@ -494,6 +494,15 @@ bool testFilter(
     uint64_t totalRows,
     const TypePtr& type);
 
+// Returns true if the stats prove that every value in the range they describe,
+// nulls included, passes the filter. False if some value may not pass or the
+// stats are not conclusive.
+bool testFilterAll(
+    common::Filter* filter,
+    dwio::common::ColumnStatistics* stats,
+    uint64_t totalRows,
+    const TypePtr& type);
+
 } // namespace common
 } // namespace bolt
 } // namespace bytedance
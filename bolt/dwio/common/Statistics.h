@@ -339,7 +339,7 @@ class IntegerColumnStatistics : public virtual ColumnStatistics {
       std::optional<int64_t> min,
       std::optional<int64_t> max,
       std::optional<int64_t> sum,
-      std::unique_ptr<BlockSplitBloomFilter>&& blockBloom = nullptr)
+      std::unique_ptr<MetaBloomFilter>&& blockBloom = nullptr)
       : ColumnStatistics(valueCount, hasNull, rawSize, size),
         min_(min),
         max_(max),
@@ -350,8 +350,13 @@ class IntegerColumnStatistics : public virtual ColumnStatistics {
       const ColumnStatistics& colStats,
       std::optional<int64_t> min,
       std::optional<int64_t> max,
-      std::optional<int64_t> sum)
-      : ColumnStatistics(colStats), min_(min), max_(max), sum_(sum) {}
+      std::optional<int64_t> sum,
+      std::unique_ptr<MetaBloomFilter>&& blockBloom = nullptr)
+      : ColumnStatistics(colStats),
+        min_(min),
+        max_(max),
+        sum_(sum),
+        blockBloom_(std::move(blockBloom)) {}
 
   ~IntegerColumnStatistics() override = default;
 
@@ -379,7 +384,7 @@ class IntegerColumnStatistics : public virtual ColumnStatistics {
     return sum_;
   }
 
-  const std::unique_ptr<BlockSplitBloomFilter>& getBlockBloomFilter() {
+  const std::unique_ptr<MetaBloomFilter>& getBlockBloomFilter() {
     return blockBloom_;
   }
 
@@ -400,7 +405,7 @@ class IntegerColumnStatistics : public virtual ColumnStatistics {
   std::optional<int64_t> min_;
   std::optional<int64_t> max_;
   std::optional<int64_t> sum_;
-  std::unique_ptr<BlockSplitBloomFilter> blockBloom_;
+  std::unique_ptr<MetaBloomFilter> blockBloom_;
 };
 
 /**
@@ -416,7 +421,7 @@ class StringColumnStatistics : public virtual ColumnStatistics {
       std::optional<std::string> min,
       std::optional<std::string> max,
       std::optional<int64_t> length,
-      std::unique_ptr<BlockSplitBloomFilter>&& blockBloom,
+      std::unique_ptr<MetaBloomFilter>&& blockBloom,
       std::vector<std::pair<
           std::unique_ptr<struct NgramTokenExtractor>,
           std::unique_ptr<NGramBloomFilter>>> token_bloom_filters)
@@ -431,8 +436,13 @@ class StringColumnStatistics : public virtual ColumnStatistics {
       const ColumnStatistics& colStats,
       std::optional<std::string> min,
       std::optional<std::string> max,
-      std::optional<int64_t> length)
-      : ColumnStatistics(colStats), min_(min), max_(max), length_(length) {}
+      std::optional<int64_t> length,
+      std::unique_ptr<MetaBloomFilter>&& blockBloom = nullptr)
+      : ColumnStatistics(colStats),
+        min_(min),
+        max_(max),
+        length_(length),
+        blockBloom_(std::move(blockBloom)) {}
 
   ~StringColumnStatistics() override = default;
 
@@ -457,7 +467,7 @@ class StringColumnStatistics : public virtual ColumnStatistics {
     return length_;
   }
 
-  const std::unique_ptr<BlockSplitBloomFilter>& getBlockBloomFilter() {
+  const std::unique_ptr<MetaBloomFilter>& getBlockBloomFilter() {
     return blockBloom_;
   }
 
@@ -486,7 +496,7 @@ class StringColumnStatistics : public virtual ColumnStatistics {
   std::optional<std::string> min_;
   std::optional<std::string> max_;
   std::optional<uint64_t> length_;
-  std::unique_ptr<BlockSplitBloomFilter> blockBloom_;
+  std::unique_ptr<MetaBloomFilter> blockBloom_;
 
   std::vector<std::pair<
       std::unique_ptr<struct NgramTokenExtractor>,
@@ -590,6 +600,12 @@ struct RuntimeStatistics {
   // Number of strides (row groups) processed based on statitics.
   int64_t processedStrides{0};
 
+  // Number of stripes (row groups) fetched ahead of the one being read.
+  int64_t prefetchedStripes{0};
+
+  // Number of strides (row groups) answered from statistics instead of read.
+  int64_t aggregatedStrides{0};
+
   uint64_t decompressDataTimeNs{0};
 
   uint64_t decodeTimeNs{0};
@@ -603,6 +619,8 @@ struct RuntimeStatistics {
     totalStrides += other.totalStrides;
     skippedStrides += other.skippedStrides;
     processedStrides += other.processedStrides;
+    prefetchedStripes += other.prefetchedStripes;
+    aggregatedStrides += other.aggregatedStrides;
     decompressDataTimeNs += other.decompressDataTimeNs;
     decodeTimeNs += other.decodeTimeNs;
     columnReaderStatistics.flattenStringDictionaryValues =
@@ -622,6 +640,8 @@ struct RuntimeStatistics {
         {"flattenStringDictionaryValues",
          RuntimeCounter(columnReaderStatistics.flattenStringDictionaryValues)},
         {"processedStrides", RuntimeCounter(processedStrides)},
+        {"prefetchedStripes", RuntimeCounter(prefetchedStripes)},
+        {"aggregatedStrides", RuntimeCounter(aggregatedStrides)},
         {"processedSplits", RuntimeCounter(processedSplits)}};
   }
 };
@@ -222,4 +222,21 @@ Config::Entry<uint64_t> Config::RAW_DATA_SIZE_PER_BATCH(
     50UL * 1024 * 1024);
 
 Config::Entry<bool> Config::MAP_STATISTICS("orc.map.statistics", false);
+
+Config::Entry<dwio::common::FileFormat> Config::FILE_FORMAT(
+    "orc.file.format",
+    dwio::common::FileFormat::DWRF,
+    [](const dwio::common::FileFormat& val) {
+      return dwio::common::toString(val);
+    },
+    [](const std::string& key, const std::string& val) {
+      const auto format = dwio::common::toFileFormat(val);
+      BOLT_CHECK(
+          format == dwio::common::FileFormat::DWRF ||
+              format == dwio::common::FileFormat::ORC,
+          "Invalid format for {}: {}",
+          key,
+          val);
+      return format;
+    });
 } // namespace bytedance::bolt::dwrf
@@ -87,6 +87,10 @@ class Config : public config::ConfigBase {
   /// stripes.
   static Entry<uint64_t> RAW_DATA_SIZE_PER_BATCH;
   static Entry<bool> MAP_STATISTICS;
+  /// Format of the written file. With ORC, the writer emits ORC footers and
+  /// stream kinds and turns off the DWRF-only features: flat maps, integer
+  /// dictionaries, stride dictionaries, the stripe cache and checksums.
+  static Entry<dwio::common::FileFormat> FILE_FORMAT;
 
   static std::shared_ptr<Config> fromMap(
       const std::map<std::string, std::string>& map) {
@@ -457,6 +457,12 @@ class FooterWrapper : public ProtoWrapperBase {
     return dwrfPtr()->statistics(index);
   }
 
+  const ::bytedance::bolt::dwrf::proto::orc::ColumnStatistics& orcStatistics(
+      int index) const {
+    BOLT_CHECK_EQ(format_, DwrfFormat::kOrc);
+    return orcPtr()->statistics(index);
+  }
+
   // TODO: ORC has not supported encryption yet
   bool hasEncryption() const {
     return format_ == DwrfFormat::kDwrf ? dwrfPtr()->has_encryption()
@@ -35,7 +35,8 @@ using namespace dwio::common;
 
 std::unique_ptr<ColumnStatistics> buildColumnStatisticsFromProto(
     const proto::ColumnStatistics& s,
-    const StatsContext& statsContext) {
+    const StatsContext& statsContext,
+    std::unique_ptr<MetaBloomFilter> bloomFilter) {
   ColumnStatistics colStats(
       s.has_numberofvalues() ? std::optional(s.numberofvalues()) : std::nullopt,
       s.has_hasnull() ? std::optional(s.hasnull()) : std::nullopt,
@@ -52,7 +53,8 @@ std::unique_ptr<ColumnStatistics> buildColumnStatisticsFromProto(
                                  : std::nullopt,
           intStats.has_maximum() ? std::optional(intStats.maximum())
                                  : std::nullopt,
-          intStats.has_sum() ? std::optional(intStats.sum()) : std::nullopt);
+          intStats.has_sum() ? std::optional(intStats.sum()) : std::nullopt,
+          std::move(bloomFilter));
     } else if (s.has_doublestatistics()) {
       const auto& dStats = s.doublestatistics();
       // Comparing against NaN doesn't make sense, and to prevent downstream
@@ -87,7 +89,8 @@ std::unique_ptr<ColumnStatistics> buildColumnStatisticsFromProto(
             // length is not negative
             (strStats.has_sum() && strStats.sum() >= 0)
                 ? std::optional(strStats.sum())
-                : std::nullopt);
+                : std::nullopt,
+            std::move(bloomFilter));
       }
     } else if (s.has_bucketstatistics()) {
       const auto& bucketStats = s.bucketstatistics();
@@ -51,8 +51,10 @@ struct StatsContext : public dwio::common::StatsContext {
   ~StatsContext() override = default;
 };
 
+/// 'bloomFilter', if given, is attached to integer and string statistics.
 std::unique_ptr<dwio::common::ColumnStatistics> buildColumnStatisticsFromProto(
     const proto::ColumnStatistics& stats,
-    const StatsContext& statsContext);
+    const StatsContext& statsContext,
+    std::unique_ptr<MetaBloomFilter> bloomFilter = nullptr);
 
 } // namespace bytedance::bolt::dwrf
@@ -31,16 +31,41 @@
 #include "bolt/dwio/dwrf/reader/DwrfData.h"
 
 #include "bolt/dwio/common/BufferUtil.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 namespace bytedance::bolt::dwrf {
+namespace {
+
+// Returns true if row groups are tested against the bloom filters of the
+// column for 'filter', see testFilter().
+bool usesBloomFilter(const common::Filter* filter) {
+  if (filter == nullptr) {
+    return false;
+  }
+  switch (filter->kind()) {
+    case common::FilterKind::kBigintValuesUsingHashTable:
+    case common::FilterKind::kBytesValues:
+      return true;
+    case common::FilterKind::kBigintRange:
+      return static_cast<const common::BigintRange*>(filter)->isSingleValue();
+    case common::FilterKind::kBytesRange:
+      return static_cast<const common::BytesRange*>(filter)->isSingleValue();
+    default:
+      return false;
+  }
+}
+
+} // namespace
 
 DwrfData::DwrfData(
     std::shared_ptr<const dwio::common::TypeWithId> fileType,
     StripeStreams& stripe,
     const StreamLabels& streamLabels,
-    FlatMapContext flatMapContext)
+    FlatMapContext flatMapContext,
+    const common::ScanSpec& scanSpec)
     : memoryPool_(stripe.getMemoryPool()),
       fileType_(std::move(fileType)),
       flatMapContext_(std::move(flatMapContext)),
+      orcFormat_{stripe.format() == DwrfFormat::kOrc},
       stripeRows_{stripe.stripeRows()},
       rowsPerRowGroup_{stripe.rowsPerRowGroup()} {
   EncodingKey encodingKey{fileType_->id(), flatMapContext_.sequence};
@@ -61,6 +86,14 @@ DwrfData::DwrfData(
       encodingKey.forKind(proto::Stream_Kind_ROW_INDEX),
       streamLabels.label(),
       false);
+  // Unlike the index, bloom filters are only read for the filter known at
+  // construct time, as most columns have no filter they could be used for.
+  if (orcFormat_ && usesBloomFilter(scanSpec.filter())) {
+    bloomFilterStream_ = stripe.getStream(
+        encodingKey.forKind(proto::Stream_Kind_BLOOM_FILTER_UTF8),
+        streamLabels.label(),
+        false);
+  }
 }
 
 uint64_t DwrfData::skipNulls(uint64_t numValues, bool /*nullsOnly*/) {
@@ -98,7 +131,15 @@ uint64_t DwrfData::skipNulls(uint64_t numValues, bool /*nullsOnly*/) {
 
 void DwrfData::ensureRowGroupIndex() {
   BOLT_CHECK(index_ || indexStream_, "Reader needs to have an index stream");
-  if (indexStream_) {
+  if (!indexStream_) {
+    return;
+  }
+  if (orcFormat_) {
+    auto orcIndex =
+        ProtoUtils::readProto<proto::orc::RowIndex>(std::move(indexStream_));
+    index_ = std::make_unique<proto::RowIndex>();
+    OrcProtoUtils::fromOrc(*orcIndex, *index_);
+  } else {
     index_ = ProtoUtils::readProto<proto::RowIndex>(std::move(indexStream_));
   }
 }
@@ -150,6 +191,28 @@ void DwrfData::readNulls(
   }
 }
 
+std::unique_ptr<MetaBloomFilter> DwrfData::bloomFilterAt(
+    int32_t rowGroup) const {
+  if (!bloomFilters_ || rowGroup >= bloomFilters_->bloomfilter_size()) {
+    return nullptr;
+  }
+  const auto& bloomFilter = bloomFilters_->bloomfilter(rowGroup);
+  std::vector<uint64_t> bits;
+  if (bloomFilter.has_utf8bitset()) {
+    // Little endian 64-bit words.
+    const auto& bytes = bloomFilter.utf8bitset();
+    bits.resize(bytes.size() / sizeof(uint64_t));
+    memcpy(bits.data(), bytes.data(), bits.size() * sizeof(uint64_t));
+  } else {
+    bits.assign(bloomFilter.bitset().begin(), bloomFilter.bitset().end());
+  }
+  if (bits.empty() || bloomFilter.numhashfunctions() == 0) {
+    return nullptr;
+  }
+  return std::make_unique<OrcBloomFilter>(
+      bloomFilter.numhashfunctions(), std::move(bits));
+}
+
 void DwrfData::filterRowGroups(
     const common::ScanSpec& scanSpec,
     uint64_t rowGroupSize,
@@ -172,10 +235,14 @@ void DwrfData::filterRowGroups(
     result.metadataFilterResults.emplace_back(
         scanSpec.metadataFilterNodeAt(i), std::vector<uint64_t>(nwords));
   }
+  if (bloomFilterStream_) {
+    bloomFilters_ = ProtoUtils::readProto<proto::orc::BloomFilterIndex>(
+        std::move(bloomFilterStream_));
+  }
   for (auto i = 0; i < index_->entry_size(); i++) {
     const auto& entry = index_->entry(i);
-    auto columnStats =
-        buildColumnStatisticsFromProto(entry.statistics(), *dwrfContext);
+    auto columnStats = buildColumnStatisticsFromProto(
+        entry.statistics(), *dwrfContext, bloomFilterAt(i));
     if (filter &&
         !testFilter(
             filter, columnStats.get(), rowGroupSize, fileType_->type())) {
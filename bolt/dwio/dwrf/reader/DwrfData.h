@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "bolt/common/base/BloomFilter.h"
 #include "bolt/common/memory/Memory.h"
 #include "bolt/dwio/common/ColumnSelector.h"
 #include "bolt/dwio/common/FormatData.h"
@@ -38,6 +39,7 @@
 #include "bolt/dwio/dwrf/common/ByteRLE.h"
 #include "bolt/dwio/dwrf/common/RLEv1.h"
 #include "bolt/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
+#include "bolt/dwio/dwrf/common/wrap/orc-proto-wrapper.h"
 #include "bolt/dwio/dwrf/reader/EncodingContext.h"
 #include "bolt/dwio/dwrf/reader/StripeStream.h"
 #include "bolt/vector/BaseVector.h"
@@ -50,7 +52,8 @@ class DwrfData : public dwio::common::FormatData {
       std::shared_ptr<const dwio::common::TypeWithId> fileType,
       StripeStreams& stripe,
       const StreamLabels& streamLabels,
-      FlatMapContext flatMapContext);
+      FlatMapContext flatMapContext,
+      const common::ScanSpec& scanSpec);
 
   void readNulls(
       vector_size_t numValues,
@@ -108,6 +111,9 @@ class DwrfData : public dwio::common::FormatData {
   }
 
  private:
+  // Returns the bloom filter of 'rowGroup', or nullptr if there is none.
+  std::unique_ptr<MetaBloomFilter> bloomFilterAt(int32_t rowGroup) const;
+
   static std::vector<uint64_t> toPositionsInner(
       const proto::RowIndexEntry& entry) {
     return std::vector<uint64_t>(
@@ -118,8 +124,16 @@ class DwrfData : public dwio::common::FormatData {
   const std::shared_ptr<const dwio::common::TypeWithId> fileType_;
   FlatMapContext flatMapContext_;
   std::unique_ptr<ByteRleDecoder> notNullDecoder_;
+  // True if the file is ORC. The row index is then parsed with the ORC
+  // schema and converted.
+  const bool orcFormat_;
   std::unique_ptr<dwio::common::SeekableInputStream> indexStream_;
   std::unique_ptr<proto::RowIndex> index_;
+  // Bloom filters of the row groups of an ORC file, if written and the
+  // filter of the column can use them. Decoded on the first
+  // filterRowGroups().
+  std::unique_ptr<dwio::common::SeekableInputStream> bloomFilterStream_;
+  std::unique_ptr<proto::orc::BloomFilterIndex> bloomFilters_;
   int64_t stripeRows_;
   // Number of rows in a row group. Last row group may have fewer rows.
   uint32_t rowsPerRowGroup_;
@@ -147,9 +161,9 @@ class DwrfParams : public dwio::common::FormatParams {
 
   std::unique_ptr<dwio::common::FormatData> toFormatData(
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
-      const common::ScanSpec& /*scanSpec*/) override {
+      const common::ScanSpec& scanSpec) override {
     return std::make_unique<DwrfData>(
-        type, stripeStreams_, streamLabels_, flatMapContext_);
+        type, stripeStreams_, streamLabels_, flatMapContext_, scanSpec);
   }
 
   StripeStreams& stripeStreams() {
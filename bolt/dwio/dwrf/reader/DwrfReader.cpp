@@ -29,6 +29,8 @@
  */
 
 #include "bolt/dwio/dwrf/reader/DwrfReader.h"
+#include "bolt/common/testutil/TestValue.h"
+#include "bolt/common/time/Timer.h"
 #include "bolt/dwio/common/Options.h"
 #include "bolt/dwio/common/TypeUtils.h"
 #include "bolt/dwio/common/exception/Exception.h"
@@ -46,11 +48,14 @@ using dwio::common::RowReaderOptions;
 DwrfRowReader::DwrfRowReader(
     const std::shared_ptr<ReaderBase>& reader,
     const RowReaderOptions& opts,
-    const dwio::common::ColumnReaderOptions& columnReaderOptions)
+    const dwio::common::ColumnReaderOptions& columnReaderOptions,
+    int32_t maxPrefetchStripes)
     : StripeReaderBase(reader),
       options_(opts),
       executor_{options_.getDecodingExecutor()},
       columnReaderOptions_(columnReaderOptions),
+      maxPrefetchStripes_(std::max(maxPrefetchStripes, 0)),
+      stripePrefetchDepth_(std::min(maxPrefetchStripes_, 1)),
       columnSelector_{std::make_shared<ColumnSelector>(ColumnSelector::apply(
           opts.getSelector(),
           reader->getSchema(),
@@ -126,6 +131,13 @@ DwrfRowReader::DwrfRowReader(
       std::vector<FetchStatus>(numberOfStripes, FetchStatus::NOT_STARTED));
 }
 
+DwrfRowReader::~DwrfRowReader() {
+  // The fetches reference 'this'.
+  for (auto& prefetch : stripePrefetches_) {
+    prefetch.wait();
+  }
+}
+
 uint64_t DwrfRowReader::seekToRow(uint64_t rowNumber) {
   // Empty file
   if (isEmptyFile()) {
@@ -135,6 +147,7 @@ uint64_t DwrfRowReader::seekToRow(uint64_t rowNumber) {
   DWIO_ENSURE(
       !prefetchHasOccurred_,
       "Prefetch already called. Currently, seek after prefetch is disallowed in DwrfRowReader");
+  cancelStripePrefetch();
 
   // If we are reading only a portion of the file
   // (bounded by firstStripe_ and stripeCeiling_),
@@ -469,9 +482,11 @@ DwrfRowReader::prefetchUnits() {
 
 DwrfRowReader::FetchResult DwrfRowReader::fetch(uint32_t stripeIndex) {
   FetchStatus prevStatus;
+  bool outOfBounds{false};
   stripeLoadStatuses_.withWLock([&](auto& stripeLoadStatus) {
-    if (stripeIndex < 0 || stripeIndex >= stripeLoadStatus.size()) {
-      prevStatus = FetchStatus::ERROR;
+    if (stripeIndex >= stripeLoadStatus.size()) {
+      outOfBounds = true;
+      return;
     }
 
     prevStatus = stripeLoadStatus[stripeIndex];
@@ -480,8 +495,10 @@ DwrfRowReader::FetchResult DwrfRowReader::fetch(uint32_t stripeIndex) {
     }
   });
 
+  DWIO_ENSURE(!outOfBounds, "Fetch request was out of bounds");
   DWIO_ENSURE(
-      prevStatus != FetchStatus::ERROR, "Fetch request was out of bounds");
+      prevStatus != FetchStatus::ERROR,
+      "Fetch of stripe " + std::to_string(stripeIndex) + " failed before");
 
   if (prevStatus != FetchStatus::NOT_STARTED) {
     bool finishedLoading = prevStatus == FetchStatus::FINISHED;
@@ -497,6 +514,9 @@ DwrfRowReader::FetchResult DwrfRowReader::fetch(uint32_t stripeIndex) {
       "prefetched stripe state already exists for stripeIndex " +
           std::to_string(stripeIndex) + ", LIKELY RACE CONDITION");
 
+  common::testutil::TestValue::adjust(
+      "bytedance::bolt::dwrf::DwrfRowReader::fetch", &stripeIndex);
+
   auto startTime = std::chrono::high_resolution_clock::now();
   bool preload = options_.getPreloadStripe();
 
@@ -598,6 +618,7 @@ DwrfRowReader::FetchResult DwrfRowReader::prefetch(uint32_t stripeToFetch) {
 // Guarantee stripe we are currently on is available and loaded
 void DwrfRowReader::safeFetchNextStripe() {
   auto startTime = std::chrono::high_resolution_clock::now();
+  resetFailedFetch(currentStripe_);
   auto fetchResult = fetch(currentStripe_);
   // If result is fetched by this thread or in progress in another thread,
   // record time spent in this function as time blocked on IO.
@@ -612,6 +633,11 @@ void DwrfRowReader::safeFetchNextStripe() {
     stripeLoadBatons_[currentStripe_]->wait();
     VLOG(1) << "Acquired baton for stripe " << currentStripe_;
   }
+  if (resetFailedFetch(currentStripe_)) {
+    // The fetch on the IO executor failed while this thread waited for it.
+    // Fetch again on this thread to surface the error here.
+    fetch(currentStripe_);
+  }
   auto reportBlockedOnIoMetric = options_.getBlockedOnIoCallback();
   if (reportBlockedOnIoMetric) {
     if (shouldRecordTimeBlocked) {
@@ -628,13 +654,29 @@ void DwrfRowReader::safeFetchNextStripe() {
   DWIO_ENSURE(prefetchedStripeStates_.rlock()->contains(currentStripe_));
 }
 
+bool DwrfRowReader::resetFailedFetch(uint32_t stripeIndex) {
+  return stripeLoadStatuses_.withWLock([&](auto& stripeLoadStatus) {
+    if (stripeLoadStatus[stripeIndex] != FetchStatus::ERROR) {
+      return false;
+    }
+    // Only the reading thread waits on the baton, so it can be replaced here.
+    stripeLoadBatons_[stripeIndex] = std::make_unique<folly::Baton<>>();
+    stripeLoadStatus[stripeIndex] = FetchStatus::NOT_STARTED;
+    return true;
+  });
+}
+
 void DwrfRowReader::startNextStripe() {
   if (newStripeReadyForRead_ || currentStripe_ >= stripeCeiling_) {
     return;
   }
   columnReader_.reset();
   selectiveColumnReader_.reset();
-  safeFetchNextStripe();
+  uint64_t blockedUs{0};
+  {
+    MicrosecondTimer timer(&blockedUs);
+    safeFetchNextStripe();
+  }
   prefetchedStripeStates_.withWLock([&](auto& prefetchedStripeStates) {
     DWIO_ENSURE(prefetchedStripeStates.contains(currentStripe_));
 
@@ -659,6 +701,8 @@ void DwrfRowReader::startNextStripe() {
   DWIO_ENSURE(freeStripeAt(currentStripe_));
 
   newStripeReadyForRead_ = true;
+  updateStripePrefetchDepth(blockedUs);
+  prefetchStripesAhead();
   auto endTime = std::chrono::high_resolution_clock::now();
   VLOG(1) << " time to complete startNextStripe: "
           << std::chrono::duration_cast<std::chrono::microseconds>(
@@ -666,6 +710,121 @@ void DwrfRowReader::startNextStripe() {
                  .count();
 }
 
+void DwrfRowReader::prefetchStripesAhead() {
+  auto* executor = getReader().getBufferedInput().executor();
+  // The decryption keys are per stripe and held by the reader.
+  if (stripePrefetchDepth_ == 0 || executor == nullptr ||
+      getDecryptionHandler().isEncrypted()) {
+    return;
+  }
+  stripePrefetches_.erase(
+      std::remove_if(
+          stripePrefetches_.begin(),
+          stripePrefetches_.end(),
+          [](const auto& prefetch) { return prefetch.isReady(); }),
+      stripePrefetches_.end());
+
+  const auto* root = getReader().getMemoryPool().root();
+  uint64_t budget = std::numeric_limits<uint64_t>::max();
+  if (root->maxCapacity() != memory::kMaxMemory) {
+    budget =
+        std::max<int64_t>(0, root->maxCapacity() - root->reservedBytes()) / 2;
+  }
+
+  const auto& footer = getReader().getFooter();
+  const uint32_t lastStripe = std::min<uint64_t>(
+      stripeCeiling_, currentStripe_ + 1ULL + stripePrefetchDepth_);
+  uint64_t aheadBytes{0};
+  for (auto stripe = currentStripe_ + 1; stripe < lastStripe; ++stripe) {
+    aheadBytes += footer.stripes(stripe).dataLength();
+    if (aheadBytes > budget) {
+      break;
+    }
+    if (stripe < nextPrefetchStripe_ ||
+        stripeLoadStatuses_.rlock()->at(stripe) != FetchStatus::NOT_STARTED) {
+      continue;
+    }
+    stripePrefetches_.push_back(
+        folly::via(executor, [this, stripe]() { fetchAhead(stripe); }));
+    nextPrefetchStripe_ = stripe + 1;
+    ++numPrefetchedStripes_;
+  }
+}
+
+void DwrfRowReader::fetchAhead(uint32_t stripeIndex) {
+  try {
+    fetch(stripeIndex);
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Failed to prefetch stripe " << stripeIndex << " of "
+                 << getReader().getBufferedInput().getName() << ": "
+                 << e.what();
+    prefetchedStripeStates_.wlock()->erase(stripeIndex);
+    freeStripeAt(stripeIndex);
+    // The reading thread resets a stripe in ERROR state and fetches it again
+    // so that the error surfaces there. The baton is posted under the lock so
+    // that the reset cannot replace it in between.
+    stripeLoadStatuses_.withWLock([&](auto& stripeLoadStatus) {
+      stripeLoadStatus[stripeIndex] = FetchStatus::ERROR;
+      stripeLoadBatons_[stripeIndex]->post();
+    });
+  }
+}
+
+void DwrfRowReader::updateStripePrefetchDepth(uint64_t blockedUs) {
+  if (maxPrefetchStripes_ == 0) {
+    return;
+  }
+  const auto nowUs = getCurrentTimeMicro();
+  uint64_t ioWaitUs{0};
+  const auto& stream = getReader().getBufferedInput().getInputStream();
+  if (stream != nullptr && stream->getStats() != nullptr) {
+    ioWaitUs = stream->getStats()->queryThreadIoLatency().sum();
+  }
+  if (stripeStartUs_ != 0) {
+    const auto waitUs = ioWaitUs - stripeStartIoWaitUs_ + blockedUs;
+    const auto stripeUs = nowUs - stripeStartUs_;
+    const auto decodeUs = stripeUs > waitUs ? stripeUs - waitUs : 0;
+    if (waitUs * 4 > decodeUs) {
+      stripePrefetchDepth_ =
+          std::min(stripePrefetchDepth_ + 1, maxPrefetchStripes_);
+    } else if (waitUs * 32 < decodeUs) {
+      stripePrefetchDepth_ = std::max(stripePrefetchDepth_ - 1, 1);
+    }
+  }
+  stripeStartUs_ = nowUs;
+  stripeStartIoWaitUs_ = ioWaitUs;
+}
+
+void DwrfRowReader::cancelStripePrefetch() {
+  for (auto& prefetch : stripePrefetches_) {
+    prefetch.wait();
+  }
+  stripePrefetches_.clear();
+  nextPrefetchStripe_ = 0;
+
+  std::vector<uint32_t> stripes;
+  prefetchedStripeStates_.withWLock([&](auto& states) {
+    for (const auto& [stripe, _] : states) {
+      stripes.push_back(stripe);
+    }
+    states.clear();
+  });
+  stripeLoadStatuses_.withWLock([&](auto& statuses) {
+    for (auto stripe = 0; stripe < statuses.size(); ++stripe) {
+      if (statuses[stripe] == FetchStatus::ERROR) {
+        stripes.push_back(stripe);
+      }
+    }
+    for (auto stripe : stripes) {
+      statuses[stripe] = FetchStatus::NOT_STARTED;
+    }
+  });
+  for (auto stripe : stripes) {
+    freeStripeAt(stripe);
+    stripeLoadBatons_[stripe] = std::make_unique<folly::Baton<>>();
+  }
+}
+
 size_t DwrfRowReader::estimatedReaderMemory() const {
   return 2 * DwrfReader::getMemoryUse(getReader(), -1, *columnSelector_);
 }
@@ -1128,8 +1287,8 @@ std::unique_ptr<dwio::common::RowReader> DwrfReader::createRowReader(
 
 std::unique_ptr<DwrfRowReader> DwrfReader::createDwrfRowReader(
     const RowReaderOptions& opts) const {
-  auto rowReader =
-      std::make_unique<DwrfRowReader>(readerBase_, opts, columnReaderOptions_);
+  auto rowReader = std::make_unique<DwrfRowReader>(
+      readerBase_, opts, columnReaderOptions_, options_.prefetchRowGroups());
   if (opts.getEagerFirstStripeLoad()) {
     // Load the first stripe on construction so that readers created in
     // background have a reader tree and can preload the first
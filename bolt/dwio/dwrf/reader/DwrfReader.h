@@ -33,6 +33,7 @@
 #include "bolt/dwio/common/ReaderFactory.h"
 #include "bolt/dwio/dwrf/reader/SelectiveDwrfReader.h"
 #include "folly/Executor.h"
+#include "folly/futures/Future.h"
 #include "folly/synchronization/Baton.h"
 namespace bytedance::bolt::dwrf {
 
@@ -46,13 +47,16 @@ class DwrfRowReader : public StrideIndexProvider,
    * Constructor that lets the user specify additional options.
    * @param contents of the file
    * @param options options for reading
+   * @param maxPrefetchStripes the most stripes after the current one that
+   * are fetched ahead on the IO executor of the reader's input
    */
   DwrfRowReader(
       const std::shared_ptr<ReaderBase>& reader,
       const dwio::common::RowReaderOptions& options,
-      const dwio::common::ColumnReaderOptions& columnReaderOptions);
+      const dwio::common::ColumnReaderOptions& columnReaderOptions,
+      int32_t maxPrefetchStripes = 0);
 
-  ~DwrfRowReader() override = default;
+  ~DwrfRowReader() override;
 
   // Select the columns from the options object
   const dwio::common::ColumnSelector& getColumnSelector() const {
@@ -108,6 +112,7 @@ class DwrfRowReader : public StrideIndexProvider,
       dwio::common::RuntimeStatistics& stats) const override {
     stats.skippedStrides += skippedStrides_;
     stats.processedStrides += currentStripe_ - skippedStrides_;
+    stats.prefetchedStripes += numPrefetchedStripes_;
     stats.columnReaderStatistics.flattenStringDictionaryValues +=
         columnReaderStatistics_.flattenStringDictionaryValues;
   }
@@ -146,6 +151,28 @@ class DwrfRowReader : public StrideIndexProvider,
   FetchResult fetch(uint32_t stripeIndex);
   FetchResult prefetch(uint32_t stripeToFetch);
 
+  // Schedules fetches of the stripes after the current one on the IO
+  // executor, up to 'stripePrefetchDepth_' stripes ahead and as far as their
+  // size fits in half of the memory the reader's pool may still reserve.
+  void prefetchStripesAhead();
+
+  // Runs on the IO executor. On failure, releases what was fetched and marks
+  // the stripe as failed so that the reading thread fetches it again.
+  void fetchAhead(uint32_t stripeIndex);
+
+  // Returns the stripe to NOT_STARTED with a fresh baton if a fetch on the IO
+  // executor failed. Runs on the reading thread. Returns true if it was reset.
+  bool resetFailedFetch(uint32_t stripeIndex);
+
+  // Grows 'stripePrefetchDepth_' while the reading thread waits for IO for
+  // more than a quarter of the time it spends decoding the previous stripe
+  // and shrinks it when the wait is negligible. 'blockedUs' is the time spent
+  // waiting for the stripe that is started.
+  void updateStripePrefetchDepth(uint64_t blockedUs);
+
+  // Waits for the scheduled fetches and drops the stripes they fetched.
+  void cancelStripePrefetch();
+
   // footer
   std::vector<uint64_t> firstRowOfStripe_;
   mutable std::shared_ptr<const dwio::common::TypeWithId> selectedSchema_;
@@ -193,6 +220,18 @@ class DwrfRowReader : public StrideIndexProvider,
   // is posted, it means the ith stripe has finished loading
   std::vector<std::unique_ptr<folly::Baton<>>> stripeLoadBatons_;
 
+  // Stripe-ahead prefetch state, only accessed by the reading thread.
+  const int32_t maxPrefetchStripes_;
+  int32_t stripePrefetchDepth_;
+  std::vector<folly::Future<folly::Unit>> stripePrefetches_;
+  // First stripe not scheduled for prefetch yet.
+  uint32_t nextPrefetchStripe_{0};
+  // Start time of the current stripe and the IO wait of the reading thread at
+  // that time, as reported by the IoStatistics of the input.
+  uint64_t stripeStartUs_{0};
+  uint64_t stripeStartIoWaitUs_{0};
+  int64_t numPrefetchedStripes_{0};
+
   // column selector
   std::shared_ptr<dwio::common::ColumnSelector> columnSelector_;
 
@@ -33,6 +33,7 @@
 #include <fmt/format.h>
 
 #include "bolt/dwio/common/exception/Exception.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 namespace bytedance::bolt::dwrf {
 
 using dwio::common::ColumnStatistics;
@@ -44,6 +45,21 @@ using dwio::common::encryption::DecrypterFactory;
 using encryption::DecryptionHandler;
 using memory::MemoryPool;
 
+namespace {
+// Returns the file level statistics of column 'index'.
+std::unique_ptr<ColumnStatistics> buildFooterColumnStatistics(
+    const FooterWrapper& footer,
+    int32_t index,
+    const StatsContext& statsContext) {
+  if (footer.format() == DwrfFormat::kOrc) {
+    proto::ColumnStatistics stats;
+    OrcProtoUtils::fromOrc(footer.orcStatistics(index), stats);
+    return buildColumnStatisticsFromProto(stats, statsContext);
+  }
+  return buildColumnStatisticsFromProto(footer.statistics(index), statsContext);
+}
+} // namespace
+
 FooterStatisticsImpl::FooterStatisticsImpl(
     const ReaderBase& reader,
     const StatsContext& statsContext) {
@@ -81,8 +97,7 @@ FooterStatisticsImpl::FooterStatisticsImpl(
   // fill in unencrypted stats if not found in encryption groups
   for (int32_t i = 0; i < footer.statisticsSize(); i++) {
     if (!colStats_[i]) {
-      colStats_[i] =
-          buildColumnStatisticsFromProto(footer.statistics(i), statsContext);
+      colStats_[i] = buildFooterColumnStatistics(footer, i, statsContext);
     }
   }
 }
@@ -258,8 +273,7 @@ std::unique_ptr<ColumnStatistics> ReaderBase::getColumnStatistics(
       "column index out of range");
   StatsContext statsContext(getWriterVersion());
   if (!handler_->isEncrypted(index)) {
-    auto& stats = footer_->statistics(index);
-    return buildColumnStatisticsFromProto(stats, statsContext);
+    return buildFooterColumnStatistics(*footer_, index, statsContext);
   }
 
   auto root = handler_->getEncryptionRoot(index);
@@ -36,6 +36,7 @@
 #include "bolt/dwio/dwrf/common/DecoderUtil.h"
 #include "bolt/dwio/dwrf/common/wrap/coded-stream-wrapper.h"
 #include "bolt/dwio/dwrf/reader/StripeStream.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 namespace bytedance::bolt::dwrf {
 
 using dwio::common::LogType;
@@ -211,8 +212,28 @@ void StripeStreamsImpl::loadStreams() {
   };
 
   uint64_t streamOffset = 0;
-  for (auto& stream : stripeFooter.streams()) {
-    addStream(stream, streamOffset);
+  if (format() == DwrfFormat::kOrc) {
+    // The ORC stripe footer is parsed with the DWRF schema. Translate the
+    // stream kinds, which the two formats number differently, and skip the
+    // streams the reader does not read. Unknown kinds fail to parse and
+    // leave 'kind' unset.
+    for (auto& stream : stripeFooter.streams()) {
+      const auto kind = stream.has_kind()
+          ? OrcProtoUtils::fromOrc(
+                static_cast<proto::orc::Stream_Kind>(stream.kind()))
+          : std::nullopt;
+      if (!kind.has_value()) {
+        streamOffset += stream.length();
+        continue;
+      }
+      proto::Stream dwrfStream{stream};
+      dwrfStream.set_kind(kind.value());
+      addStream(dwrfStream, streamOffset);
+    }
+  } else {
+    for (auto& stream : stripeFooter.streams()) {
+      addStream(stream, streamOffset);
+    }
   }
 
   // update column encoding for each stream
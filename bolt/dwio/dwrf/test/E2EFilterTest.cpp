@@ -113,16 +113,26 @@ class E2EFilterTest : public E2EFilterTestBase {
   std::unique_ptr<dwio::common::Reader> makeReader(
       const dwio::common::ReaderOptions& opts,
       std::unique_ptr<dwio::common::BufferedInput> input) override {
-    return std::make_unique<DwrfReader>(opts, std::move(input));
+    if (!orcFormat_) {
+      return std::make_unique<DwrfReader>(opts, std::move(input));
+    }
+    auto orcOpts = opts;
+    orcOpts.setFileFormat(FileFormat::ORC);
+    return std::make_unique<DwrfReader>(orcOpts, std::move(input));
   }
 
   std::unordered_set<std::string> flatMapColumns_;
+  // Writes and reads ORC instead of DWRF files.
+  bool orcFormat_{false};
 
  private:
   dwrf::WriterOptions createWriterOptions(const TypePtr& type) {
     auto config = std::make_shared<dwrf::Config>();
     config->set(dwrf::Config::COMPRESSION, CompressionKind_NONE);
     config->set(dwrf::Config::USE_VINTS, useVInts_);
+    if (orcFormat_) {
+      config->set(dwrf::Config::FILE_FORMAT, FileFormat::ORC);
+    }
     auto writerSchema = type;
     if (!flatMapColumns_.empty()) {
       auto& rowType = type->asRow();
@@ -188,6 +198,25 @@ TEST_F(E2EFilterTest, integerDirect) {
       true);
 }
 
+TEST_F(E2EFilterTest, orcFormat) {
+  orcFormat_ = true;
+  testWithTypes(
+      "short_val:smallint,"
+      "int_val:int,"
+      "long_val:bigint,"
+      "double_val:double,"
+      "string_val:string,"
+      "long_null:bigint",
+      [&]() {
+        makeAllNulls("long_null");
+        makeStringUnique("string_val");
+      },
+      true,
+      {"short_val", "int_val", "long_val", "double_val", "string_val"},
+      20,
+      true);
+}
+
 TEST_F(E2EFilterTest, integerDictionary) {
   testWithTypes(
       "short_val:smallint,"
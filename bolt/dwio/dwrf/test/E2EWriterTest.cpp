@@ -869,6 +869,91 @@ TEST_F(E2EWriterTest, PartialStride) {
   ASSERT_EQ(true, reader->columnStatistics(1)->hasNull().value());
 }
 
+TEST_F(E2EWriterTest, orcFormat) {
+  auto type = ROW({
+      {"bool_val", BOOLEAN()},
+      {"byte_val", TINYINT()},
+      {"short_val", SMALLINT()},
+      {"int_val", INTEGER()},
+      {"long_val", BIGINT()},
+      {"float_val", REAL()},
+      {"double_val", DOUBLE()},
+      {"string_val", VARCHAR()},
+      {"binary_val", VARBINARY()},
+      {"ts_val", TIMESTAMP()},
+      {"date_val", DATE()},
+      {"array_val", ARRAY(INTEGER())},
+      {"map_val", MAP(VARCHAR(), BIGINT())},
+      {"struct_val", ROW({{"a", INTEGER()}, {"b", VARCHAR()}})},
+  });
+  auto config = std::make_shared<dwrf::Config>();
+  config->set(dwrf::Config::FILE_FORMAT, dwio::common::FileFormat::ORC);
+  config->set(dwrf::Config::ROW_INDEX_STRIDE, static_cast<uint32_t>(1'000));
+  config->set(
+      dwrf::Config::COMPRESSION, common::CompressionKind::CompressionKind_ZSTD);
+
+  auto sink = std::make_unique<MemorySink>(
+      200 * 1024 * 1024,
+      dwio::common::FileSink::Options{.pool = leafPool_.get()});
+  auto sinkPtr = sink.get();
+  dwrf::WriterOptions options;
+  options.config = config;
+  options.schema = type;
+  options.memoryPool = rootPool_.get();
+  dwrf::Writer writer{std::move(sink), options};
+
+  const size_t numStripes = 3;
+  std::vector<VectorPtr> batches;
+  for (size_t i = 0; i < numStripes; ++i) {
+    batches.push_back(
+        BatchMaker::createBatch(type, 2'500, *leafPool_, nullptr, i));
+    writer.write(batches.back());
+    writer.flush();
+  }
+  writer.close();
+
+  dwio::common::ReaderOptions readerOpts{leafPool_.get()};
+  readerOpts.setFileFormat(dwio::common::FileFormat::ORC);
+  auto reader = createReader(*sinkPtr, readerOpts);
+  ASSERT_EQ(*reader->rowType(), *type);
+  ASSERT_EQ(reader->numberOfRows().value(), numStripes * 2'500);
+  ASSERT_EQ(reader->getNumberOfStripes(), numStripes);
+  ASSERT_EQ(
+      reader->getCompression(), common::CompressionKind::CompressionKind_ZSTD);
+
+  RowReaderOptions rowReaderOpts;
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+  auto dwrfRowReader = dynamic_cast<dwrf::DwrfRowReader*>(rowReader.get());
+  for (int32_t i = 0; i < reader->getNumberOfStripes(); ++i) {
+    dwrfRowReader->loadStripe(i, true);
+    // ORC encodings are positional, one for each column id.
+    ASSERT_EQ(
+        dwrfRowReader->getStripeFooter().encoding_size(),
+        dwio::common::TypeWithId::create(type)->maxId() + 1);
+  }
+
+  rowReader = reader->createRowReader(rowReaderOpts);
+  VectorPtr batch;
+  for (const auto& expected : batches) {
+    ASSERT_TRUE(rowReader->next(expected->size(), batch));
+    ASSERT_EQ(batch->size(), expected->size());
+    for (vector_size_t i = 0; i < batch->size(); ++i) {
+      ASSERT_TRUE(expected->equalValueAt(batch.get(), i, i))
+          << "Mismatch at " << i << ": " << expected->toString(i) << " vs "
+          << batch->toString(i);
+    }
+  }
+  ASSERT_FALSE(rowReader->next(1, batch));
+
+  options.schema = ROW({"d"}, {DECIMAL(10, 2)});
+  BOLT_ASSERT_THROW(
+      dwrf::Writer(
+          std::make_unique<MemorySink>(
+              1024, dwio::common::FileSink::Options{.pool = leafPool_.get()}),
+          options),
+      "ORC writer does not support DECIMAL(10, 2)");
+}
+
 TEST_F(E2EWriterTest, OversizeRows) {
   auto pool = bytedance::bolt::memory::memoryManager()->addLeafPool();
 
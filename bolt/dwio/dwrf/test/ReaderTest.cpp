@@ -31,6 +31,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include "bolt/common/base/tests/GTestUtils.h"
+#include "bolt/common/testutil/TestValue.h"
 #include "bolt/dwio/common/ExecutorBarrier.h"
 #include "bolt/dwio/common/FileSink.h"
 #include "bolt/dwio/common/tests/utils/BatchMaker.h"
@@ -134,6 +135,7 @@ class TestRowReaderPrefetch : public testing::Test, public VectorTestBase {
  protected:
   static void SetUpTestCase() {
     memory::MemoryManager::testingSetInstance({});
+    common::testutil::TestValue::enable();
   }
 };
 
@@ -756,6 +758,123 @@ TEST_F(TestRowReaderPrefetch, testParallelPrefetchNoPreload) {
       expectedBatchSize.size());
 }
 
+namespace {
+// Reads like BufferedInput and offers 'executor' for prefetching stripes.
+class ExecutorBufferedInput : public BufferedInput {
+ public:
+  ExecutorBufferedInput(
+      const std::string& path,
+      memory::MemoryPool& pool,
+      folly::Executor* executor)
+      : BufferedInput(std::make_shared<LocalReadFile>(path), pool),
+        executor_(executor) {}
+
+  folly::Executor* executor() const override {
+    return executor_;
+  }
+
+ private:
+  folly::Executor* const executor_;
+};
+} // namespace
+
+TEST_F(TestRowReaderPrefetch, stripeAheadPrefetch) {
+  folly::CPUThreadPoolExecutor executor(2);
+  for (auto seek : {0, 400}) {
+    SCOPED_TRACE(fmt::format("seek {}", seek));
+    // The second batch seeks into the second stripe, dropping the stripes
+    // fetched ahead.
+    std::array<int32_t, 5> seeks{0, seek, 0, 0, 0};
+    const std::array<int32_t, 4> expectedBatchSize{
+        300, seek == 0 ? 300 : 200, 300, 100};
+    dwio::common::ReaderOptions readerOpts{pool()};
+    readerOpts.setFilePreloadThreshold(0);
+    readerOpts.setPrefetchRowGroups(2);
+    RowReaderOptions rowReaderOpts;
+    rowReaderOpts.select(std::make_shared<ColumnSelector>(getFlatmapSchema()));
+    auto reader = DwrfReader::create(
+        std::make_unique<ExecutorBufferedInput>(
+            getFMSmallFile(), readerOpts.getMemoryPool(), &executor),
+        readerOpts);
+    auto rowReaderOwner = reader->createRowReader(rowReaderOpts);
+    auto rowReader = dynamic_cast<DwrfRowReader*>(rowReaderOwner.get());
+
+    verifyFlatMapReading(
+        rowReader,
+        seeks.data(),
+        expectedBatchSize.data(),
+        expectedBatchSize.size());
+
+    RuntimeStatistics stats;
+    rowReader->updateRuntimeStats(stats);
+    if (seek == 0) {
+      // Each stripe after the first is fetched ahead once.
+      EXPECT_EQ(stats.prefetchedStripes, 3);
+    } else {
+      EXPECT_GE(stats.prefetchedStripes, 3);
+    }
+  }
+}
+
+DEBUG_ONLY_TEST_F(TestRowReaderPrefetch, stripeAheadPrefetchError) {
+  folly::CPUThreadPoolExecutor executor(1);
+  std::atomic_int numFailures{0};
+  SCOPED_TESTVALUE_SET(
+      "bytedance::bolt::dwrf::DwrfRowReader::fetch",
+      std::function<void(const uint32_t*)>([&](const uint32_t* stripeIndex) {
+        if (*stripeIndex == 1) {
+          ++numFailures;
+          BOLT_FAIL("Injected fetch failure");
+        }
+      }));
+  dwio::common::ReaderOptions readerOpts{pool()};
+  readerOpts.setFilePreloadThreshold(0);
+  readerOpts.setPrefetchRowGroups(2);
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.select(std::make_shared<ColumnSelector>(getFlatmapSchema()));
+  auto reader = DwrfReader::create(
+      std::make_unique<ExecutorBufferedInput>(
+          getFMSmallFile(), readerOpts.getMemoryPool(), &executor),
+      readerOpts);
+  auto rowReader = reader->createRowReader(rowReaderOpts);
+
+  VectorPtr batch;
+  ASSERT_TRUE(rowReader->next(1000, batch));
+  ASSERT_EQ(batch->size(), 300);
+  // Lets the fetch of the second stripe ahead fail before it is read.
+  executor.join();
+  ASSERT_EQ(numFailures, 1);
+
+  // The reading thread fetches the stripe again and gets the error instead of
+  // a stale failed state.
+  BOLT_ASSERT_THROW(rowReader->next(1000, batch), "Injected fetch failure");
+  ASSERT_EQ(numFailures, 2);
+}
+
+TEST_F(TestRowReaderPrefetch, noStripeAheadPrefetchWithoutExecutor) {
+  dwio::common::ReaderOptions readerOpts{pool()};
+  readerOpts.setPrefetchRowGroups(2);
+  RowReaderOptions rowReaderOpts;
+  rowReaderOpts.select(std::make_shared<ColumnSelector>(getFlatmapSchema()));
+  auto reader = DwrfReader::create(
+      createFileBufferedInput(getFMSmallFile(), readerOpts.getMemoryPool()),
+      readerOpts);
+  auto rowReaderOwner = reader->createRowReader(rowReaderOpts);
+  auto rowReader = dynamic_cast<DwrfRowReader*>(rowReaderOwner.get());
+
+  std::array<int32_t, 5> seeks;
+  seeks.fill(0);
+  const std::array<int32_t, 4> expectedBatchSize{300, 300, 300, 100};
+  verifyFlatMapReading(
+      rowReader,
+      seeks.data(),
+      expectedBatchSize.data(),
+      expectedBatchSize.size());
+  RuntimeStatistics stats;
+  rowReader->updateRuntimeStats(stats);
+  EXPECT_EQ(stats.prefetchedStripes, 0);
+}
+
 TEST_F(TestRowReaderPrefetch, prefetchWithCachedIndexStream) {
   dwio::common::ReaderOptions readerOpts{pool()};
   readerOpts.setFilePreloadThreshold(0);
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
+
+#include "bolt/common/base/Exceptions.h"
+namespace bytedance::bolt::dwrf {
+
+namespace {
+
+proto::orc::Type_Kind toOrcTypeKind(const Type& type) {
+  if (type.isDate()) {
+    return proto::orc::Type_Kind_DATE;
+  }
+  if (type.isDecimal()) {
+    // The integer writer has no ORC decimal encoding.
+    BOLT_UNSUPPORTED("ORC writer does not support {}", type.toString());
+  }
+  switch (type.kind()) {
+    case TypeKind::BOOLEAN:
+      return proto::orc::Type_Kind_BOOLEAN;
+    case TypeKind::TINYINT:
+      return proto::orc::Type_Kind_BYTE;
+    case TypeKind::SMALLINT:
+      return proto::orc::Type_Kind_SHORT;
+    case TypeKind::INTEGER:
+      return proto::orc::Type_Kind_INT;
+    case TypeKind::BIGINT:
+      return proto::orc::Type_Kind_LONG;
+    case TypeKind::REAL:
+      return proto::orc::Type_Kind_FLOAT;
+    case TypeKind::DOUBLE:
+      return proto::orc::Type_Kind_DOUBLE;
+    case TypeKind::VARCHAR:
+      return proto::orc::Type_Kind_STRING;
+    case TypeKind::VARBINARY:
+      return proto::orc::Type_Kind_BINARY;
+    case TypeKind::TIMESTAMP:
+      return proto::orc::Type_Kind_TIMESTAMP;
+    case TypeKind::ARRAY:
+      return proto::orc::Type_Kind_LIST;
+    case TypeKind::MAP:
+      return proto::orc::Type_Kind_MAP;
+    case TypeKind::ROW:
+      return proto::orc::Type_Kind_STRUCT;
+    default:
+      BOLT_UNSUPPORTED("ORC writer does not support {}", type.toString());
+  }
+}
+
+proto::orc::Stream_Kind toOrcStreamKind(proto::Stream_Kind kind) {
+  switch (kind) {
+    case proto::Stream_Kind_PRESENT:
+      return proto::orc::Stream_Kind_PRESENT;
+    case proto::Stream_Kind_DATA:
+      return proto::orc::Stream_Kind_DATA;
+    case proto::Stream_Kind_LENGTH:
+      return proto::orc::Stream_Kind_LENGTH;
+    case proto::Stream_Kind_DICTIONARY_DATA:
+      return proto::orc::Stream_Kind_DICTIONARY_DATA;
+    case proto::Stream_Kind_DICTIONARY_COUNT:
+      return proto::orc::Stream_Kind_DICTIONARY_COUNT;
+    case proto::Stream_Kind_NANO_DATA:
+      return proto::orc::Stream_Kind_SECONDARY;
+    case proto::Stream_Kind_ROW_INDEX:
+      return proto::orc::Stream_Kind_ROW_INDEX;
+    case proto::Stream_Kind_BLOOM_FILTER_UTF8:
+      return proto::orc::Stream_Kind_BLOOM_FILTER_UTF8;
+    default:
+      BOLT_FAIL(
+          "Stream kind {} has no ORC equivalent",
+          proto::Stream_Kind_Name(kind));
+  }
+}
+
+proto::orc::ColumnEncoding_Kind toOrcEncodingKind(
+    proto::ColumnEncoding_Kind kind) {
+  switch (kind) {
+    case proto::ColumnEncoding_Kind_DIRECT:
+      return proto::orc::ColumnEncoding_Kind_DIRECT;
+    case proto::ColumnEncoding_Kind_DICTIONARY:
+      return proto::orc::ColumnEncoding_Kind_DICTIONARY;
+    case proto::ColumnEncoding_Kind_DIRECT_V2:
+      return proto::orc::ColumnEncoding_Kind_DIRECT_V2;
+    case proto::ColumnEncoding_Kind_DICTIONARY_V2:
+      return proto::orc::ColumnEncoding_Kind_DICTIONARY_V2;
+    default:
+      BOLT_FAIL(
+          "Column encoding {} has no ORC equivalent",
+          proto::ColumnEncoding_Kind_Name(kind));
+  }
+}
+
+} // namespace
+
+void OrcProtoUtils::writeType(
+    const Type& type,
+    proto::orc::Footer& footer,
+    proto::orc::Type* parent) {
+  auto* self = footer.add_types();
+  if (parent) {
+    parent->add_subtypes(footer.types_size() - 1);
+  }
+  self->set_kind(toOrcTypeKind(type));
+  switch (type.kind()) {
+    case TypeKind::ROW: {
+      auto& row = type.asRow();
+      for (size_t i = 0; i < row.size(); ++i) {
+        self->add_fieldnames(row.nameOf(i));
+        writeType(*row.childAt(i), footer, self);
+      }
+      break;
+    }
+    case TypeKind::ARRAY:
+      writeType(*type.asArray().elementType(), footer, self);
+      break;
+    case TypeKind::MAP: {
+      auto& map = type.asMap();
+      writeType(*map.keyType(), footer, self);
+      writeType(*map.valueType(), footer, self);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void OrcProtoUtils::toOrc(const proto::Footer& from, proto::orc::Footer& to) {
+  BOLT_CHECK_EQ(to.types_size(), from.statistics_size());
+  to.set_headerlength(from.headerlength());
+  to.set_contentlength(from.contentlength());
+  for (const auto& stripe : from.stripes()) {
+    auto* orcStripe = to.add_stripes();
+    orcStripe->set_offset(stripe.offset());
+    orcStripe->set_indexlength(stripe.indexlength());
+    orcStripe->set_datalength(stripe.datalength());
+    orcStripe->set_footerlength(stripe.footerlength());
+    orcStripe->set_numberofrows(stripe.numberofrows());
+  }
+  for (const auto& item : from.metadata()) {
+    auto* orcItem = to.add_metadata();
+    orcItem->set_name(item.name());
+    orcItem->set_value(item.value());
+  }
+  to.set_numberofrows(from.numberofrows());
+  for (int32_t i = 0; i < from.statistics_size(); ++i) {
+    const auto& stats = from.statistics(i);
+    auto* orcStats = to.add_statistics();
+    toOrc(stats, *orcStats);
+    // DWRF keeps dates in integer statistics.
+    if (to.types(i).kind() == proto::orc::Type_Kind_DATE &&
+        stats.has_intstatistics()) {
+      const auto& intStats = stats.intstatistics();
+      auto* dateStats = orcStats->mutable_datestatistics();
+      if (intStats.has_minimum()) {
+        dateStats->set_minimum(intStats.minimum());
+      }
+      if (intStats.has_maximum()) {
+        dateStats->set_maximum(intStats.maximum());
+      }
+    }
+  }
+  to.set_rowindexstride(from.rowindexstride());
+}
+
+void OrcProtoUtils::toOrc(
+    const proto::StripeFooter& from,
+    uint32_t numColumns,
+    proto::orc::StripeFooter& to) {
+  BOLT_CHECK_EQ(from.encryptiongroups_size(), 0);
+  for (const auto& stream : from.streams()) {
+    auto* orcStream = to.add_streams();
+    orcStream->set_kind(toOrcStreamKind(stream.kind()));
+    orcStream->set_column(stream.node());
+    orcStream->set_length(stream.length());
+  }
+  for (uint32_t i = 0; i < numColumns; ++i) {
+    to.add_columns()->set_kind(proto::orc::ColumnEncoding_Kind_DIRECT);
+  }
+  for (const auto& encoding : from.encoding()) {
+    BOLT_CHECK_EQ(encoding.sequence(), 0);
+    BOLT_CHECK_LT(encoding.node(), numColumns);
+    auto* column = to.mutable_columns(encoding.node());
+    column->set_kind(toOrcEncodingKind(encoding.kind()));
+    if (encoding.has_dictionarysize()) {
+      column->set_dictionarysize(encoding.dictionarysize());
+    }
+  }
+  to.set_writertimezone("UTC");
+}
+
+void OrcProtoUtils::toOrc(
+    const proto::RowIndex& from,
+    proto::orc::RowIndex& to) {
+  for (const auto& entry : from.entry()) {
+    auto* orcEntry = to.add_entry();
+    orcEntry->mutable_positions()->CopyFrom(entry.positions());
+    if (entry.has_statistics()) {
+      toOrc(entry.statistics(), *orcEntry->mutable_statistics());
+    }
+  }
+}
+
+void OrcProtoUtils::toOrc(
+    const proto::ColumnStatistics& from,
+    proto::orc::ColumnStatistics& to) {
+  if (from.has_numberofvalues()) {
+    to.set_numberofvalues(from.numberofvalues());
+  }
+  if (from.has_hasnull()) {
+    to.set_hasnull(from.hasnull());
+  }
+  if (from.has_size()) {
+    to.set_bytesondisk(from.size());
+  }
+  if (from.has_intstatistics()) {
+    const auto& stats = from.intstatistics();
+    auto* orcStats = to.mutable_intstatistics();
+    if (stats.has_minimum()) {
+      orcStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      orcStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      orcStats->set_sum(stats.sum());
+    }
+  }
+  if (from.has_doublestatistics()) {
+    const auto& stats = from.doublestatistics();
+    auto* orcStats = to.mutable_doublestatistics();
+    if (stats.has_minimum()) {
+      orcStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      orcStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      orcStats->set_sum(stats.sum());
+    }
+  }
+  if (from.has_stringstatistics()) {
+    const auto& stats = from.stringstatistics();
+    auto* orcStats = to.mutable_stringstatistics();
+    if (stats.has_minimum()) {
+      orcStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      orcStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      orcStats->set_sum(stats.sum());
+    }
+  }
+  if (from.has_bucketstatistics()) {
+    to.mutable_bucketstatistics()->mutable_count()->CopyFrom(
+        from.bucketstatistics().count());
+  }
+  if (from.has_binarystatistics() && from.binarystatistics().has_sum()) {
+    to.mutable_binarystatistics()->set_sum(from.binarystatistics().sum());
+  }
+}
+
+proto::orc::CompressionKind OrcProtoUtils::toOrc(common::CompressionKind kind) {
+  switch (kind) {
+    case common::CompressionKind_NONE:
+      return proto::orc::CompressionKind::NONE;
+    case common::CompressionKind_ZLIB:
+      return proto::orc::CompressionKind::ZLIB;
+    case common::CompressionKind_SNAPPY:
+      return proto::orc::CompressionKind::SNAPPY;
+    case common::CompressionKind_LZO:
+      return proto::orc::CompressionKind::LZO;
+    case common::CompressionKind_ZSTD:
+      return proto::orc::CompressionKind::ZSTD;
+    case common::CompressionKind_LZ4:
+      return proto::orc::CompressionKind::LZ4;
+    default:
+      BOLT_UNSUPPORTED(
+          "ORC does not support compression {}",
+          common::compressionKindToString(kind));
+  }
+}
+
+std::optional<proto::Stream_Kind> OrcProtoUtils::fromOrc(
+    proto::orc::Stream_Kind kind) {
+  switch (kind) {
+    case proto::orc::Stream_Kind_PRESENT:
+      return proto::Stream_Kind_PRESENT;
+    case proto::orc::Stream_Kind_DATA:
+      return proto::Stream_Kind_DATA;
+    case proto::orc::Stream_Kind_LENGTH:
+      return proto::Stream_Kind_LENGTH;
+    case proto::orc::Stream_Kind_DICTIONARY_DATA:
+      return proto::Stream_Kind_DICTIONARY_DATA;
+    case proto::orc::Stream_Kind_DICTIONARY_COUNT:
+      return proto::Stream_Kind_DICTIONARY_COUNT;
+    case proto::orc::Stream_Kind_SECONDARY:
+      return proto::Stream_Kind_NANO_DATA;
+    case proto::orc::Stream_Kind_ROW_INDEX:
+      return proto::Stream_Kind_ROW_INDEX;
+    case proto::orc::Stream_Kind_BLOOM_FILTER_UTF8:
+      return proto::Stream_Kind_BLOOM_FILTER_UTF8;
+    default:
+      // BLOOM_FILTER hashes strings in the writer's default charset and is
+      // superseded by BLOOM_FILTER_UTF8.
+      return std::nullopt;
+  }
+}
+
+void OrcProtoUtils::fromOrc(
+    const proto::orc::RowIndex& from,
+    proto::RowIndex& to) {
+  for (const auto& entry : from.entry()) {
+    auto* dwrfEntry = to.add_entry();
+    dwrfEntry->mutable_positions()->CopyFrom(entry.positions());
+    if (entry.has_statistics()) {
+      fromOrc(entry.statistics(), *dwrfEntry->mutable_statistics());
+    }
+  }
+}
+
+void OrcProtoUtils::fromOrc(
+    const proto::orc::ColumnStatistics& from,
+    proto::ColumnStatistics& to) {
+  if (from.has_numberofvalues()) {
+    to.set_numberofvalues(from.numberofvalues());
+  }
+  if (from.has_hasnull()) {
+    to.set_hasnull(from.hasnull());
+  }
+  if (from.has_bytesondisk()) {
+    to.set_size(from.bytesondisk());
+  }
+  if (from.has_intstatistics()) {
+    const auto& stats = from.intstatistics();
+    auto* dwrfStats = to.mutable_intstatistics();
+    if (stats.has_minimum()) {
+      dwrfStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      dwrfStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      dwrfStats->set_sum(stats.sum());
+    }
+  } else if (from.has_datestatistics()) {
+    const auto& stats = from.datestatistics();
+    auto* dwrfStats = to.mutable_intstatistics();
+    if (stats.has_minimum()) {
+      dwrfStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      dwrfStats->set_maximum(stats.maximum());
+    }
+  }
+  if (from.has_doublestatistics()) {
+    const auto& stats = from.doublestatistics();
+    auto* dwrfStats = to.mutable_doublestatistics();
+    if (stats.has_minimum()) {
+      dwrfStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      dwrfStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      dwrfStats->set_sum(stats.sum());
+    }
+  }
+  if (from.has_stringstatistics()) {
+    const auto& stats = from.stringstatistics();
+    auto* dwrfStats = to.mutable_stringstatistics();
+    // The truncated lowerBound and upperBound are not exact and are left
+    // out, since the DWRF statistics have no way to mark them.
+    if (stats.has_minimum()) {
+      dwrfStats->set_minimum(stats.minimum());
+    }
+    if (stats.has_maximum()) {
+      dwrfStats->set_maximum(stats.maximum());
+    }
+    if (stats.has_sum()) {
+      dwrfStats->set_sum(stats.sum());
+    }
+  }
+  if (from.has_bucketstatistics()) {
+    to.mutable_bucketstatistics()->mutable_count()->CopyFrom(
+        from.bucketstatistics().count());
+  }
+  if (from.has_binarystatistics() && from.binarystatistics().has_sum()) {
+    to.mutable_binarystatistics()->set_sum(from.binarystatistics().sum());
+  }
+}
+
+} // namespace bytedance::bolt::dwrf
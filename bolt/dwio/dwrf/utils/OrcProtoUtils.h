@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <optional>
+
+#include "bolt/common/compression/Compression.h"
+#include "bolt/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
+#include "bolt/dwio/dwrf/common/wrap/orc-proto-wrapper.h"
+#include "bolt/type/Type.h"
+namespace bytedance::bolt::dwrf {
+
+/// Converts the metadata built by the DWRF writer to its ORC counterpart. The
+/// two schemas share most messages but assign different field numbers and
+/// enum values to several of them, e.g. ColumnStatistics.hasNull, the stripe
+/// raw data size and the LZ4/ZSTD compression kinds, so the messages are
+/// copied field by field rather than reinterpreted.
+class OrcProtoUtils final {
+ public:
+  /// Appends the ORC types of 'type' to 'footer' in pre-order, the same
+  /// column ids as ProtoUtils::writeType assigns. DATE is written as the ORC
+  /// DATE kind. Throws for types the writer has no ORC encoding for.
+  static void writeType(
+      const Type& type,
+      proto::orc::Footer& footer,
+      proto::orc::Type* parent = nullptr);
+
+  /// Copies everything but the types from 'from' to 'to'. 'to' must already
+  /// hold the types, which are used to fill the date statistics.
+  static void toOrc(const proto::Footer& from, proto::orc::Footer& to);
+
+  /// Copies the streams and encodings of a stripe. ORC identifies encodings
+  /// by position, so 'to' gets one encoding for each of the 'numColumns'
+  /// column ids, in order. Throws on stream kinds that only exist in DWRF.
+  static void toOrc(
+      const proto::StripeFooter& from,
+      uint32_t numColumns,
+      proto::orc::StripeFooter& to);
+
+  static void toOrc(const proto::RowIndex& from, proto::orc::RowIndex& to);
+
+  static void toOrc(
+      const proto::ColumnStatistics& from,
+      proto::orc::ColumnStatistics& to);
+
+  static proto::orc::CompressionKind toOrc(common::CompressionKind kind);
+
+  /// Returns the DWRF stream kind the reader uses for an ORC stream kind, or
+  /// std::nullopt for streams the reader does not read. Streams are looked up
+  /// by kind, and ORC numbers its bloom filter streams like the DWRF stride
+  /// dictionary streams.
+  static std::optional<proto::Stream_Kind> fromOrc(
+      proto::orc::Stream_Kind kind);
+
+  /// Copies a row index of an ORC file to the DWRF row index the column
+  /// readers use. Positions are copied as is, statistics as by the overload
+  /// below.
+  static void fromOrc(const proto::orc::RowIndex& from, proto::RowIndex& to);
+
+  /// Copies the statistics the DWRF statistics can express. Date statistics
+  /// become integer statistics; decimal, timestamp and collection statistics
+  /// are dropped.
+  static void fromOrc(
+      const proto::orc::ColumnStatistics& from,
+      proto::ColumnStatistics& to);
+};
+
+} // namespace bytedance::bolt::dwrf
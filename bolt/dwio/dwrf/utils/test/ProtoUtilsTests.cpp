@@ -29,6 +29,7 @@
  */
 
 #include <gtest/gtest.h>
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 #include "bolt/dwio/dwrf/utils/ProtoUtils.h"
 #include "bolt/type/fbhive/HiveTypeParser.h"
 #include "bolt/type/fbhive/HiveTypeSerializer.h"
@@ -66,3 +67,36 @@ TEST(ProtoUtilsTests, Projection) {
 
   EXPECT_EQ("struct<a:boolean,c:smallint,d:struct<b:int,c:int>>", res);
 }
+
+TEST(ProtoUtilsTests, FromOrc) {
+  EXPECT_EQ(
+      OrcProtoUtils::fromOrc(proto::orc::Stream_Kind_SECONDARY),
+      proto::Stream_Kind_NANO_DATA);
+  EXPECT_EQ(
+      OrcProtoUtils::fromOrc(proto::orc::Stream_Kind_BLOOM_FILTER_UTF8),
+      proto::Stream_Kind_BLOOM_FILTER_UTF8);
+  EXPECT_FALSE(
+      OrcProtoUtils::fromOrc(proto::orc::Stream_Kind_BLOOM_FILTER).has_value());
+
+  proto::orc::RowIndex orcIndex;
+  auto* entry = orcIndex.add_entry();
+  entry->add_positions(3);
+  entry->add_positions(7);
+  auto* orcStats = entry->mutable_statistics();
+  orcStats->set_numberofvalues(10);
+  orcStats->set_hasnull(true);
+  orcStats->mutable_datestatistics()->set_minimum(-5);
+  orcStats->mutable_datestatistics()->set_maximum(20);
+
+  proto::RowIndex index;
+  OrcProtoUtils::fromOrc(orcIndex, index);
+  ASSERT_EQ(index.entry_size(), 1);
+  EXPECT_EQ(index.entry(0).positions_size(), 2);
+  EXPECT_EQ(index.entry(0).positions(1), 7);
+  const auto& stats = index.entry(0).statistics();
+  EXPECT_EQ(stats.numberofvalues(), 10);
+  EXPECT_TRUE(stats.hasnull());
+  EXPECT_EQ(stats.intstatistics().minimum(), -5);
+  EXPECT_EQ(stats.intstatistics().maximum(), 20);
+  EXPECT_FALSE(stats.intstatistics().has_sum());
+}
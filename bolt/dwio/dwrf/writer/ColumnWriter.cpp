@@ -373,6 +373,13 @@ class IntegerColumnWriter : public BaseColumnWriter {
     return true;
   }
 
+ protected:
+  // ORC has no dictionary encoding for integers.
+  bool useDictionaryEncoding() const override {
+    return BaseColumnWriter::useDictionaryEncoding() &&
+        !context_.isOrcFormat();
+  }
+
  private:
   uint64_t writeDict(
       DecodedVector& decodedVector,
@@ -1220,7 +1227,9 @@ void StringColumnWriter::populateDictionaryEncodingStreams() {
       pool,
       sort_,
       DictionaryEncodingUtils::frequencyOrdering,
-      true,
+      // ORC has no stride dictionaries, so infrequent keys stay in the
+      // stripe dictionary.
+      !context_.isOrcFormat(),
       lookupTable,
       inDict,
       strideDictCounts,
@@ -32,6 +32,7 @@
 
 #include "bolt/dwio/common/OutputStream.h"
 #include "bolt/dwio/dwrf/common/wrap/dwrf-proto-wrapper.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 #include "bolt/dwio/dwrf/writer/StatisticsBuilder.h"
 namespace bytedance::bolt::dwrf {
 
@@ -48,8 +49,11 @@ constexpr int32_t PRESENT_STREAM_INDEX_ENTRIES_PAGED =
 
 class IndexBuilder : public PositionRecorder {
  public:
-  IndexBuilder(std::unique_ptr<BufferedOutputStream> out)
-      : out_{std::move(out)} {}
+  /// With 'orcFormat', the index is serialized as an ORC RowIndex.
+  IndexBuilder(
+      std::unique_ptr<BufferedOutputStream> out,
+      bool orcFormat = false)
+      : out_{std::move(out)}, orcFormat_{orcFormat} {}
 
   virtual ~IndexBuilder() = default;
 
@@ -72,7 +76,13 @@ class IndexBuilder : public PositionRecorder {
 
   virtual void flush() {
     // remove isPresent positions if none is null
-    index_.SerializeToZeroCopyStream(out_.get());
+    if (orcFormat_) {
+      proto::orc::RowIndex index;
+      OrcProtoUtils::toOrc(index_, index);
+      index.SerializeToZeroCopyStream(out_.get());
+    } else {
+      index_.SerializeToZeroCopyStream(out_.get());
+    }
     out_->flush();
     index_.Clear();
     entry_.Clear();
@@ -111,6 +121,7 @@ class IndexBuilder : public PositionRecorder {
   }
 
   const std::unique_ptr<BufferedOutputStream> out_;
+  const bool orcFormat_;
   proto::RowIndex index_;
   proto::RowIndexEntry entry_;
   std::optional<int32_t> presentStreamOffset_;
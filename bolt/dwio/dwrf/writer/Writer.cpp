@@ -38,6 +38,7 @@
 #include "bolt/common/testutil/TestValue.h"
 #include "bolt/common/time/CpuWallTimer.h"
 #include "bolt/dwio/dwrf/common/Common.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 #include "bolt/dwio/dwrf/utils/ProtoUtils.h"
 #include "bolt/dwio/dwrf/writer/FlushPolicy.h"
 #include "bolt/dwio/dwrf/writer/LayoutPlanner.h"
@@ -62,6 +63,31 @@ dwio::common::StripeProgress getStripeProgress(const WriterContext& context) {
                                      : 0)};
 }
 
+// Returns the config to write with. ORC output turns off the DWRF-only
+// features whose defaults are on and fails early on columns ORC output does
+// not support.
+std::shared_ptr<const Config> writerConfig(const WriterOptions& options) {
+  if (options.config->get(Config::FILE_FORMAT) !=
+      dwio::common::FileFormat::ORC) {
+    return options.config;
+  }
+  BOLT_USER_CHECK(
+      options.encryptionSpec == nullptr,
+      "ORC writer does not support encryption");
+  proto::orc::Footer footer;
+  OrcProtoUtils::writeType(*options.schema, footer);
+
+  auto config = std::make_shared<Config>();
+  for (const auto& [key, value] : options.config->rawConfigsCopy()) {
+    config->set(key, value);
+  }
+  config->set(Config::FLATTEN_MAP, false);
+  config->set(Config::USE_VINTS, true);
+  config->set(Config::STRIPE_CACHE_MODE, StripeCacheMode::NA);
+  config->set(Config::CHECKSUM_ALGORITHM, proto::ChecksumAlgorithm::NULL_);
+  return config;
+}
+
 #define NON_RECLAIMABLE_SECTION_CHECK() \
   BOLT_CHECK(nonReclaimableSection_ == nullptr || *nonReclaimableSection_);
 } // namespace
@@ -83,7 +109,7 @@ Writer::Writer(
                                     *options.encryptionSpec,
                                     options.encrypterFactory.get())
                               : nullptr);
-  writerBase_->initContext(options.config, pool, std::move(handler));
+  writerBase_->initContext(writerConfig(options), pool, std::move(handler));
 
   auto& context = writerBase_->getContext();
   BOLT_CHECK_EQ(
@@ -519,7 +545,14 @@ void Writer::flushStripe(bool close) {
   DWIO_ENSURE_EQ(footerOffset, stripeOffset + dataLength + indexLength);
 
   sink.setMode(WriterSink::Mode::Footer);
-  writerBase_->writeProto(encodingManager.getFooter());
+  if (context.isOrcFormat()) {
+    proto::orc::StripeFooter footer;
+    OrcProtoUtils::toOrc(
+        encodingManager.getFooter(), schema_->maxId() + 1, footer);
+    writerBase_->writeProto(footer);
+  } else {
+    writerBase_->writeProto(encodingManager.getFooter());
+  }
   sink.setMode(WriterSink::Mode::None);
 
   auto& stripe = writerBase_->addStripeInfo();
@@ -780,8 +813,13 @@ uint64_t Writer::MemoryReclaimer::reclaim(
   return reclaimBytes;
 }
 
-dwrf::WriterOptions getDwrfOptions(const dwio::common::WriterOptions& options) {
+dwrf::WriterOptions getDwrfOptions(
+    const dwio::common::WriterOptions& options,
+    dwio::common::FileFormat format) {
   std::map<std::string, std::string> configs;
+  if (format != dwio::common::FileFormat::DWRF) {
+    configs.emplace(Config::FILE_FORMAT.key, dwio::common::toString(format));
+  }
   if (options.compressionKind.has_value()) {
     configs.emplace(
         Config::COMPRESSION.key,
@@ -809,7 +847,7 @@ dwrf::WriterOptions getDwrfOptions(const dwio::common::WriterOptions& options) {
 std::unique_ptr<dwio::common::Writer> DwrfWriterFactory::createWriter(
     std::unique_ptr<dwio::common::FileSink> sink,
     const dwio::common::WriterOptions& options) {
-  auto dwrfOptions = getDwrfOptions(options);
+  auto dwrfOptions = getDwrfOptions(options, fileFormat());
   return std::make_unique<Writer>(std::move(sink), dwrfOptions);
 }
 
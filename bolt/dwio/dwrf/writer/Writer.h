@@ -228,7 +228,10 @@ class Writer : public dwio::common::Writer {
 
 class DwrfWriterFactory : public dwio::common::WriterFactory {
  public:
-  DwrfWriterFactory() : WriterFactory(dwio::common::FileFormat::DWRF) {}
+  /// With FileFormat::ORC the factory creates writers that emit ORC files.
+  explicit DwrfWriterFactory(
+      dwio::common::FileFormat format = dwio::common::FileFormat::DWRF)
+      : WriterFactory(format) {}
 
   std::unique_ptr<dwio::common::Writer> createWriter(
       std::unique_ptr<dwio::common::FileSink> sink,
@@ -30,10 +30,21 @@
 
 #include "bolt/dwio/dwrf/writer/WriterBase.h"
 #include "bolt/common/process/ProcessBase.h"
+#include "bolt/dwio/dwrf/utils/OrcProtoUtils.h"
 #include "bolt/dwio/dwrf/utils/ProtoUtils.h"
 namespace bytedance::bolt::dwrf {
 
+namespace {
+// Writer version 6 is the first one ORC leaves to writers other than the Java
+// one.
+constexpr uint32_t kOrcWriterVersion = 6;
+} // namespace
+
 void WriterBase::writeFooter(const Type& type) {
+  if (context_->isOrcFormat()) {
+    writeOrcFooter(type);
+    return;
+  }
   auto pos = writerSink_->size();
   footer_.set_headerlength(ORC_MAGIC_LEN);
   footer_.set_contentlength(pos - ORC_MAGIC_LEN);
@@ -83,12 +94,41 @@ void WriterBase::writeFooter(const Type& type) {
   ps.set_cachemode(
       static_cast<proto::StripeCacheMode>(writerSink_->getCacheMode()));
   ps.set_cachesize(cacheSize);
-  writeProto(ps, common::CompressionKind::CompressionKind_NONE);
-  auto psLength = writerSink_->size() - pos;
-  DWIO_ENSURE_LE(psLength, 0xff, "PostScript is too large: ", psLength);
-  auto psLen = static_cast<char>(psLength);
-  writerSink_->addBuffer(
-      context_->getMemoryPool(MemoryUsageCategory::OUTPUT_STREAM), &psLen, 1);
+  writePostScript(ps);
+}
+
+void WriterBase::writeOrcFooter(const Type& type) {
+  auto pos = writerSink_->size();
+  footer_.set_headerlength(ORC_MAGIC_LEN);
+  footer_.set_contentlength(pos - ORC_MAGIC_LEN);
+  writerSink_->setMode(WriterSink::Mode::None);
+  DWIO_ENSURE_EQ(writerSink_->getCacheSize(), 0);
+
+  writeUserMetadata(
+      static_cast<uint32_t>(context_->getConfig(Config::WRITER_VERSION)));
+  footer_.set_numberofrows(context_->fileRowCount());
+  footer_.set_rowindexstride(context_->indexStride());
+
+  proto::orc::Footer footer;
+  OrcProtoUtils::writeType(type, footer);
+  OrcProtoUtils::toOrc(footer_, footer);
+  writeProto(footer);
+  const auto footerLength = writerSink_->size() - pos;
+
+  // No stripe statistics are written, so the metadata section is empty.
+  proto::orc::PostScript ps;
+  ps.set_footerlength(footerLength);
+  ps.set_compression(OrcProtoUtils::toOrc(context_->compression()));
+  if (context_->compression() !=
+      common::CompressionKind::CompressionKind_NONE) {
+    ps.set_compressionblocksize(context_->compressionBlockSize());
+  }
+  ps.add_version(0);
+  ps.add_version(12);
+  ps.set_metadatalength(0);
+  ps.set_writerversion(kOrcWriterVersion);
+  ps.set_magic(std::string{ORC_MAGIC.begin(), ORC_MAGIC.end()});
+  writePostScript(ps);
 }
 
 void WriterBase::writeUserMetadata(uint32_t writerVersion) {
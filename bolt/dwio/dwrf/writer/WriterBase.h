@@ -173,6 +173,24 @@ class WriterBase {
  private:
   void writeUserMetadata(uint32_t writerVersion);
 
+  // Writes the footer and postscript of an ORC file. Stripe statistics are
+  // not written.
+  void writeOrcFooter(const Type& type);
+
+  // Writes the uncompressed postscript followed by its length byte.
+  template <typename T>
+  void writePostScript(const T& ps) {
+    const auto pos = writerSink_->size();
+    writeProto(ps, common::CompressionKind::CompressionKind_NONE);
+    const auto psLength = writerSink_->size() - pos;
+    DWIO_ENSURE_LE(psLength, 0xff, "PostScript is too large: ", psLength);
+    const auto psLen = static_cast<char>(psLength);
+    writerSink_->addBuffer(
+        context_->getMemoryPool(MemoryUsageCategory::OUTPUT_STREAM),
+        &psLen,
+        1);
+  }
+
   std::unique_ptr<WriterContext> context_;
   std::unique_ptr<dwio::common::FileSink> sink_;
   std::unique_ptr<WriterSink> writerSink_;
@@ -54,6 +54,8 @@ WriterContext::WriterContext(
       compression_{getConfig(Config::COMPRESSION)},
       compressionBlockSize_{getConfig(Config::COMPRESSION_BLOCK_SIZE)},
       shareFlatMapDictionaries_{getConfig(Config::MAP_FLAT_DICT_SHARE)},
+      orcFormat_{
+          getConfig(Config::FILE_FORMAT) == dwio::common::FileFormat::ORC},
       stripeSizeFlushThreshold_{getConfig(Config::STRIPE_SIZE)},
       dictionarySizeFlushThreshold_{getConfig(Config::MAX_DICTIONARY_SIZE)},
       streamSizeAboveThresholdCheckEnabled_{
@@ -99,6 +101,19 @@ void WriterContext::validateConfigs() const {
   BOLT_CHECK_GE(
       getConfig(Config::COMPRESSION_BLOCK_SIZE_EXTEND_RATIO),
       dwio::common::MIN_PAGE_GROW_RATIO);
+  if (orcFormat_) {
+    BOLT_CHECK(!getConfig(Config::FLATTEN_MAP), "ORC has no flat maps");
+    BOLT_CHECK(getConfig(Config::USE_VINTS), "ORC requires varint encoding");
+    BOLT_CHECK(
+        getConfig(Config::STRIPE_CACHE_MODE) == StripeCacheMode::NA,
+        "ORC has no stripe cache");
+    BOLT_CHECK(
+        getConfig(Config::CHECKSUM_ALGORITHM) ==
+            proto::ChecksumAlgorithm::NULL_,
+        "ORC has no stripe checksums");
+    BOLT_CHECK(
+        !handler_->isEncrypted(), "ORC writer does not support encryption");
+  }
 }
 
 void WriterContext::initBuffer() {
@@ -152,7 +152,7 @@ class WriterContext : public CompressionBufferPool {
       std::unique_ptr<BufferedOutputStream> stream) const {
     return indexBuilderFactory_
         ? indexBuilderFactory_(std::move(stream))
-        : std::make_unique<IndexBuilder>(std::move(stream));
+        : std::make_unique<IndexBuilder>(std::move(stream), orcFormat_);
   }
 
   void suppressStream(const DwrfStreamIdentifier& stream) {
@@ -392,6 +392,11 @@ class WriterContext : public CompressionBufferPool {
     return shareFlatMapDictionaries_;
   }
 
+  /// True if the file is written in ORC rather than DWRF format.
+  bool isOrcFormat() const {
+    return orcFormat_;
+  }
+
   uint64_t stripeSizeFlushThreshold() const {
     return stripeSizeFlushThreshold_;
   }
@@ -614,6 +619,7 @@ class WriterContext : public CompressionBufferPool {
   const common::CompressionKind compression_;
   const uint64_t compressionBlockSize_;
   const bool shareFlatMapDictionaries_;
+  const bool orcFormat_;
   const uint64_t stripeSizeFlushThreshold_;
   const uint64_t dictionarySizeFlushThreshold_;
   const bool streamSizeAboveThresholdCheckEnabled_;
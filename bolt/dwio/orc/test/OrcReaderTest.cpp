@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include "bolt/dwio/common/ScanSpec.h"
 #include "bolt/dwio/dwrf/common/Common.h"
 #include "bolt/dwio/dwrf/reader/DwrfReader.h"
 #include "bolt/dwio/dwrf/test/OrcTest.h"
@@ -151,6 +152,89 @@ TEST_F(OrcReaderTest, testOrcReaderDate) {
   }
 }
 
+// Written by the Apache ORC writer with a row index stride of 1000 and bloom
+// filters on both columns:
+//    id bigint: a permutation of 0 to 3999, i * 7919 % 4000 in row i
+//    name varchar: 'name' followed by id padded to 5 digits
+// The min and max of every row group span almost all the values, so that
+// only the bloom filters can skip a row group for an equality filter.
+TEST_F(OrcReaderTest, testOrcReaderBloomFilter) {
+  dwio::common::ReaderOptions readerOpts{pool()};
+  readerOpts.setFileFormat(dwio::common::FileFormat::ORC);
+  auto reader = DwrfReader::create(
+      createFileBufferedInput(
+          getExamplesFilePath("orc_bloom_filter.orc"),
+          readerOpts.getMemoryPool()),
+      readerOpts);
+  auto rowType = reader->rowType();
+
+  using Row = std::pair<int64_t, std::string>;
+  auto scan = [&](const std::string& column,
+                  std::unique_ptr<common::Filter> filter,
+                  std::vector<Row>& rows) {
+    auto spec = std::make_shared<common::ScanSpec>("<root>");
+    spec->addAllChildFields(*rowType);
+    if (filter) {
+      spec->childByName(column)->setFilter(std::move(filter));
+    }
+    RowReaderOptions rowReaderOpts;
+    rowReaderOpts.setScanSpec(spec);
+    auto rowReader = reader->createRowReader(rowReaderOpts);
+    auto batch = BaseVector::create(rowType, 0, pool());
+    while (rowReader->next(1000, batch)) {
+      auto rowVector = batch->as<RowVector>();
+      auto ids = rowVector->childAt(0)->loadedVector();
+      auto names = rowVector->childAt(1)->loadedVector();
+      for (vector_size_t i = 0; i < rowVector->size(); ++i) {
+        rows.emplace_back(
+            ids->as<SimpleVector<int64_t>>()->valueAt(i),
+            names->as<SimpleVector<StringView>>()->valueAt(i).str());
+      }
+    }
+    dwio::common::RuntimeStatistics stats;
+    rowReader->updateRuntimeStats(stats);
+    return stats.skippedStrides;
+  };
+
+  std::vector<Row> allRows;
+  ASSERT_EQ(scan("id", nullptr, allRows), 0);
+  ASSERT_EQ(allRows.size(), 4000);
+  std::vector<Row> expected;
+  for (const auto& row : allRows) {
+    if (row.first == 1234) {
+      expected.push_back(row);
+    }
+  }
+  ASSERT_EQ(expected, (std::vector<Row>{{1234, "name01234"}}));
+
+  // 1234 is in the last row group. The bloom filters of the other three
+  // reject it.
+  std::vector<Row> rows;
+  ASSERT_EQ(
+      scan(
+          "id", std::make_unique<common::BigintRange>(1234, 1234, false), rows),
+      3);
+  ASSERT_EQ(rows, expected);
+
+  rows.clear();
+  ASSERT_EQ(
+      scan(
+          "name",
+          std::make_unique<common::BytesValues>(
+              std::vector<std::string>{"name01234"}, false),
+          rows),
+      3);
+  ASSERT_EQ(rows, expected);
+
+  // A range is not tested against the bloom filters.
+  rows.clear();
+  ASSERT_EQ(
+      scan(
+          "id", std::make_unique<common::BigintRange>(1234, 1235, false), rows),
+      0);
+  ASSERT_EQ(rows.size(), 2);
+}
+
 // create table orc_types_test (
 //    "a" integer,
 //    "b" bigint,
@@ -18,19 +18,23 @@
 #ifdef BOLT_ENABLE_ORC
 #include "bolt/dwio/orc/writer/OrcWriter.h"
 using bytedance::bolt::orc::writer::OrcWriterFactory;
+#else
+#include "bolt/dwio/dwrf/writer/Writer.h"
 #endif
 namespace bytedance::bolt::orc {
 
 void registerOrcWriterFactory() {
 #ifdef BOLT_ENABLE_ORC
   dwio::common::registerWriterFactory(std::make_shared<OrcWriterFactory>());
+#else
+  // Without Arrow, ORC files are written by the native DWRF writer.
+  dwio::common::registerWriterFactory(
+      std::make_shared<dwrf::DwrfWriterFactory>(dwio::common::FileFormat::ORC));
 #endif
 }
 
 void unregisterOrcWriterFactory() {
-#ifdef BOLT_ENABLE_ORC
   dwio::common::unregisterWriterFactory(dwio::common::FileFormat::ORC);
-#endif
 }
 
 } // namespace bytedance::bolt::orc
@@ -64,6 +64,7 @@
 #include "bolt/dwio/parquet/arrow/FileEncryptorInternal.h"
 #include "bolt/dwio/parquet/arrow/LevelConversion.h"
 #include "bolt/dwio/parquet/arrow/Metadata.h"
+#include "bolt/dwio/parquet/arrow/NGramBloomFilterBuilder.h"
 #include "bolt/dwio/parquet/arrow/PageIndex.h"
 #include "bolt/dwio/parquet/arrow/Platform.h"
 #include "bolt/dwio/parquet/arrow/Properties.h"
@@ -402,6 +403,7 @@ class SerializedPageWriter : public PageWriter {
 
     // Serialized page writer does not need to adjust page offsets.
     FinishPageIndexes(/*final_position=*/0);
+    WriteTokenBloomFilters();
 
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(
@@ -573,6 +575,21 @@ class SerializedPageWriter : public PageWriter {
     page_header.__set_data_page_header_v2(data_page_header);
   }
 
+  void AddTokenBloomFilter(std::shared_ptr<Buffer> filter) override {
+    token_bloom_filters_.push_back(std::move(filter));
+  }
+
+  /// \brief Write the token bloom filters after the pages of the column chunk
+  /// and record their locations in its metadata.
+  void WriteTokenBloomFilters() {
+    for (const auto& filter : token_bloom_filters_) {
+      PARQUET_ASSIGN_OR_THROW(int64_t offset, sink_->Tell());
+      PARQUET_THROW_NOT_OK(sink_->Write(filter));
+      metadata_->AddTokenBloomFilter(offset, filter->size());
+    }
+    token_bloom_filters_.clear();
+  }
+
   /// \brief Finish page index builders and update the stream offset to adjust
   /// page offsets.
   void FinishPageIndexes(int64_t final_position) {
@@ -721,6 +738,8 @@ class SerializedPageWriter : public PageWriter {
 
   ColumnIndexBuilder* column_index_builder_;
   OffsetIndexBuilder* offset_index_builder_;
+
+  std::vector<std::shared_ptr<Buffer>> token_bloom_filters_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -782,6 +801,7 @@ class BufferedPageWriter : public PageWriter {
     if (pager_->meta_encryptor_ != nullptr) {
       pager_->UpdateEncryption(encryption::kColumnMetaData);
     }
+    pager_->WriteTokenBloomFilters();
     // index_page_offset = -1 since they are not supported
     // dictionary page offset should be 0 iff there are no dictionary pages
     auto dictionary_page_offset =
@@ -819,6 +839,10 @@ class BufferedPageWriter : public PageWriter {
     pager_->Compress(src_buffer, dest_buffer);
   }
 
+  void AddTokenBloomFilter(std::shared_ptr<Buffer> filter) override {
+    pager_->AddTokenBloomFilter(std::move(filter));
+  }
+
   bool has_compressor() override {
     return pager_->has_compressor();
   }
@@ -961,6 +985,16 @@ class ColumnWriterImpl {
       compressor_temp_buffer_ = std::static_pointer_cast<ResizableBuffer>(
           AllocateBuffer(allocator_, 0));
     }
+
+    const auto& ngram_options =
+        properties->ngram_bloom_filter_options(descr_->path());
+    if (ngram_options.has_value() &&
+        descr_->physical_type() == Type::BYTE_ARRAY &&
+        properties->column_encryption_properties(
+            descr_->path()->ToDotString()) == nullptr) {
+      ngram_bloom_filter_ = std::make_unique<NGramBloomFilterBuilder>(
+          ngram_options.value(), allocator_);
+    }
   }
 
   virtual ~ColumnWriterImpl() = default;
@@ -1092,6 +1126,9 @@ class ColumnWriterImpl {
 
   std::vector<std::unique_ptr<DataPage>> data_pages_;
 
+  // Set if an n-gram bloom filter is written for the column chunk.
+  std::unique_ptr<NGramBloomFilterBuilder> ngram_bloom_filter_;
+
  private:
   void InitSinks() {
     definition_levels_sink_.Rewind(0);
@@ -1371,6 +1408,11 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+    if (ngram_bloom_filter_ != nullptr) {
+      if (auto filter = ngram_bloom_filter_->Finish()) {
+        pager_->AddTokenBloomFilter(std::move(filter));
+      }
+    }
     total_bytes_written_ = pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -2005,6 +2047,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if constexpr (std::is_same_v<DType, ByteArrayType>) {
+      if (ngram_bloom_filter_ != nullptr) {
+        ngram_bloom_filter_->Insert(values, num_values);
+      }
+    }
   }
 
   /// \brief Write values with spaces and update page statistics accordingly.
@@ -2050,6 +2097,14 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
           num_values,
           num_nulls);
     }
+    if constexpr (std::is_same_v<DType, ByteArrayType>) {
+      if (ngram_bloom_filter_ != nullptr && num_values != num_spaced_values) {
+        ngram_bloom_filter_->InsertSpaced(
+            values, num_spaced_values, valid_bits, valid_bits_offset);
+      } else if (ngram_bloom_filter_ != nullptr) {
+        ngram_bloom_filter_->Insert(values, num_values);
+      }
+    }
   }
 };
 
@@ -2192,6 +2247,10 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     }
 
     preserved_dictionary_ = dictionary;
+    // The whole dictionary is a superset of the values of the chunk.
+    if (ngram_bloom_filter_ != nullptr) {
+      ngram_bloom_filter_->Insert(*dictionary);
+    }
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
     PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
@@ -2784,6 +2843,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
       page_statistics_->IncrementNullCount(batch_size - non_null);
       page_statistics_->IncrementNumValues(non_null);
     }
+    if (ngram_bloom_filter_ != nullptr) {
+      ngram_bloom_filter_->Insert(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(
         batch_size, batch_num_values, batch_size - non_null, check_page);
     CheckDictionarySizeLimit();
@@ -173,6 +173,11 @@ class PARQUET_EXPORT PageWriter {
   virtual void Compress(
       const ::arrow::Buffer& src_buffer,
       ::arrow::ResizableBuffer* dest_buffer) = 0;
+
+  /// \brief Add a serialized token bloom filter of the column chunk. Close()
+  /// writes it after the pages and records its location in the column chunk
+  /// metadata.
+  virtual void AddTokenBloomFilter(std::shared_ptr<::arrow::Buffer> filter) = 0;
 };
 
 class PARQUET_EXPORT ColumnWriter {
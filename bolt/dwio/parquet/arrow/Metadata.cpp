@@ -1709,6 +1709,14 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void AddTokenBloomFilter(int64_t offset, int64_t length) {
+    auto& meta_data = column_chunk_->meta_data;
+    meta_data.token_bloom_filter_offset.push_back(offset);
+    meta_data.token_bloom_filter_length.push_back(length);
+    meta_data.__isset.token_bloom_filter_offset = true;
+    meta_data.__isset.token_bloom_filter_length = true;
+  }
+
   void Finish(
       int64_t num_values,
       int64_t dictionary_page_offset,
@@ -1948,6 +1956,12 @@ void ColumnChunkMetaDataBuilder::SetStatistics(
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::AddTokenBloomFilter(
+    int64_t offset,
+    int64_t length) {
+  impl_->AddTokenBloomFilter(offset, length);
+}
+
 int64_t ColumnChunkMetaDataBuilder::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
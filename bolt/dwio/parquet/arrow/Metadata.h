@@ -491,6 +491,9 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // Records a token bloom filter of 'length' bytes at 'offset' in the file.
+  // Must be called before Finish().
+  void AddTokenBloomFilter(int64_t offset, int64_t length);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
 
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/dwio/parquet/arrow/NGramBloomFilterBuilder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "bolt/common/base/BloomFilter.h"
+#include "bolt/dwio/parquet/arrow/ThriftInternal.h"
+namespace bytedance::bolt::parquet::arrow {
+namespace {
+
+constexpr int32_t kSeed = 0;
+
+// Size of the bit set for 'expected_ngrams' distinct n-grams at 'fpp',
+// -n * ln(p) / ln(2)^2 bits, rounded up to whole words.
+int64_t NumBytes(const NGramBloomFilterOptions& options) {
+  const double bits = -static_cast<double>(options.expected_ngrams) *
+      std::log(options.fpp) / (std::log(2.0) * std::log(2.0));
+  const int64_t bytes =
+      static_cast<int64_t>(std::ceil(bits / 64)) * sizeof(uint64_t);
+  return std::clamp<int64_t>(
+      bytes, sizeof(uint64_t), NGramBloomFilter::MAX_BLOOM_FILTER_SIZE);
+}
+
+// The number of hashes minimizing false positives, m / n * ln(2).
+int32_t NumHashes(const NGramBloomFilterOptions& options, int64_t num_bytes) {
+  const double hashes =
+      8.0 * num_bytes / options.expected_ngrams * std::log(2.0);
+  return std::max<int32_t>(1, static_cast<int32_t>(std::lround(hashes)));
+}
+
+} // namespace
+
+NGramBloomFilterBuilder::NGramBloomFilterBuilder(
+    const NGramBloomFilterOptions& options,
+    MemoryPool* pool)
+    : extractor_(options.ngram),
+      pool_(pool),
+      num_bytes_(NumBytes(options)),
+      num_hashes_(NumHashes(options, num_bytes_)),
+      bits_(AllocateBuffer(pool, num_bytes_)) {
+  std::memset(bits_->mutable_data(), 0, num_bytes_);
+}
+
+void NGramBloomFilterBuilder::InsertValue(const char* data, uint32_t length) {
+  ngrams_.clear();
+  extractor_.ngrams(data, length, ngrams_);
+  if (ngrams_.empty()) {
+    return;
+  }
+  auto* words = reinterpret_cast<uint64_t*>(bits_->mutable_data());
+  for (const auto& ngram : ngrams_) {
+    NGramBloomFilter::insert(
+        words, num_bytes_, num_hashes_, kSeed, ngram.data(), ngram.size());
+  }
+  empty_ = false;
+}
+
+void NGramBloomFilterBuilder::Insert(
+    const ByteArray* values,
+    int64_t num_values) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    InsertValue(reinterpret_cast<const char*>(values[i].ptr), values[i].len);
+  }
+}
+
+void NGramBloomFilterBuilder::InsertSpaced(
+    const ByteArray* values,
+    int64_t num_values,
+    const uint8_t* valid_bits,
+    int64_t valid_bits_offset) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    if (::arrow::bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+      InsertValue(
+          reinterpret_cast<const char*>(values[i].ptr), values[i].len);
+    }
+  }
+}
+
+template <typename ArrayType>
+void NGramBloomFilterBuilder::InsertBinary(const ArrayType& array) {
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsValid(i)) {
+      const auto value = array.GetView(i);
+      InsertValue(value.data(), static_cast<uint32_t>(value.size()));
+    }
+  }
+}
+
+void NGramBloomFilterBuilder::Insert(const ::arrow::Array& values) {
+  using ::arrow::internal::checked_cast;
+  if (::arrow::is_large_binary_like(values.type_id())) {
+    InsertBinary(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+  } else if (::arrow::is_binary_like(values.type_id())) {
+    InsertBinary(checked_cast<const ::arrow::BinaryArray&>(values));
+  } else {
+    throw ParquetException(
+        "N-gram bloom filters need binary values, got ",
+        values.type()->ToString());
+  }
+}
+
+std::shared_ptr<Buffer> NGramBloomFilterBuilder::Finish() {
+  if (empty_) {
+    return nullptr;
+  }
+  format::NGramAlgorithm algorithm;
+  algorithm.__set_nGram(static_cast<int32_t>(extractor_.getN()));
+  algorithm.__set_hashes(num_hashes_);
+  algorithm.__set_seed(kSeed);
+
+  format::TokenBloomFilterHeader header;
+  header.__set_numBits(num_bytes_ * 8);
+  header.algorithm.__set_NGRAM(algorithm);
+  header.hash.__set_CITYHASH(format::CityHash());
+  header.compression.__set_UNCOMPRESSED(format::Uncompressed());
+  ThriftSerializer serializer;
+  uint8_t* header_data;
+  uint32_t header_length;
+  serializer.SerializeToBuffer(&header, &header_length, &header_data);
+
+  auto filter = AllocateBuffer(pool_, header_length + num_bytes_);
+  std::memcpy(filter->mutable_data(), header_data, header_length);
+  std::memcpy(
+      filter->mutable_data() + header_length, bits_->data(), num_bytes_);
+
+  std::memset(bits_->mutable_data(), 0, num_bytes_);
+  empty_ = true;
+  return filter;
+}
+
+} // namespace bytedance::bolt::parquet::arrow
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "arrow/array.h"
+#include "bolt/common/token/ITokenExtractor.h"
+#include "bolt/dwio/parquet/arrow/Platform.h"
+#include "bolt/dwio/parquet/arrow/Properties.h"
+#include "bolt/dwio/parquet/arrow/Types.h"
+namespace bytedance::bolt::parquet::arrow {
+
+/// Builds the n-gram bloom filter of a BYTE_ARRAY column chunk. The filter is
+/// serialized as a TokenBloomFilterHeader followed by its bit set and is
+/// referenced from ColumnMetaData.token_bloom_filter_offset and
+/// token_bloom_filter_length, which is where the reader looks for the filters
+/// it tests LIKE patterns against. The bit set is allocated from 'pool'.
+class PARQUET_EXPORT NGramBloomFilterBuilder {
+ public:
+  NGramBloomFilterBuilder(
+      const NGramBloomFilterOptions& options,
+      MemoryPool* pool);
+
+  /// Inserts the n-grams of 'num_values' values.
+  void Insert(const ByteArray* values, int64_t num_values);
+
+  /// Inserts the n-grams of the values of 'values' whose bit in 'valid_bits'
+  /// is set.
+  void InsertSpaced(
+      const ByteArray* values,
+      int64_t num_values,
+      const uint8_t* valid_bits,
+      int64_t valid_bits_offset);
+
+  /// Inserts the n-grams of the non-null values of a binary or string array.
+  void Insert(const ::arrow::Array& values);
+
+  /// Returns the serialized filter, or nullptr if no value had an n-gram, and
+  /// clears the filter for the next column chunk.
+  std::shared_ptr<Buffer> Finish();
+
+  /// Size of the bit set in bytes.
+  int64_t num_bytes() const {
+    return num_bytes_;
+  }
+
+  int32_t num_hashes() const {
+    return num_hashes_;
+  }
+
+ private:
+  void InsertValue(const char* data, uint32_t length);
+
+  template <typename ArrayType>
+  void InsertBinary(const ArrayType& array);
+
+  const NgramTokenExtractor extractor_;
+  MemoryPool* const pool_;
+  const int64_t num_bytes_;
+  const int32_t num_hashes_;
+  std::shared_ptr<ResizableBuffer> bits_;
+  // Reused for the n-grams of each value.
+  std::vector<std::string_view> ngrams_;
+  bool empty_{true};
+};
+
+} // namespace bytedance::bolt::parquet::arrow
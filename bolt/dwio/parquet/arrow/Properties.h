@@ -33,6 +33,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -244,6 +245,21 @@ static constexpr Compression::type DEFAULT_COMPRESSION_TYPE =
     Compression::UNCOMPRESSED;
 static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 
+/// Options of the n-gram bloom filter written for each chunk of a BYTE_ARRAY
+/// column. Readers test the n-grams of LIKE patterns against the filter to
+/// skip row groups.
+struct PARQUET_EXPORT NGramBloomFilterOptions {
+  /// Number of code points per n-gram.
+  int32_t ngram = 3;
+
+  /// False positive probability when a column chunk has 'expected_ngrams'
+  /// distinct n-grams.
+  double fpp = 0.01;
+
+  /// Expected number of distinct n-grams per column chunk. Sizes the filter.
+  int64_t expected_ngrams = 64 * 1024;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(
@@ -307,6 +323,11 @@ class PARQUET_EXPORT ColumnProperties {
     pagesize_ = size;
   }
 
+  void set_ngram_bloom_filter_options(
+      const std::optional<NGramBloomFilterOptions>& options) {
+    ngram_bloom_filter_options_ = options;
+  }
+
   Encoding::type encoding() const {
     return encoding_;
   }
@@ -347,6 +368,11 @@ class PARQUET_EXPORT ColumnProperties {
     return pagesize_;
   }
 
+  const std::optional<NGramBloomFilterOptions>& ngram_bloom_filter_options()
+      const {
+    return ngram_bloom_filter_options_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -357,6 +383,7 @@ class PARQUET_EXPORT ColumnProperties {
   bool page_index_enabled_;
   int64_t dictionary_pagesize_limit_;
   int64_t pagesize_;
+  std::optional<NGramBloomFilterOptions> ngram_bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -809,6 +836,27 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_write_page_index(path->ToDotString());
     }
 
+    /// Enable writing an n-gram bloom filter for each chunk of the BYTE_ARRAY
+    /// column specified by `path`. Default disabled. Not written for
+    /// encrypted columns.
+    Builder* enable_ngram_bloom_filter(
+        const std::string& path,
+        const NGramBloomFilterOptions& options = {}) {
+      if (options.ngram <= 0 || options.expected_ngrams <= 0 ||
+          !(options.fpp > 0 && options.fpp < 1)) {
+        throw ParquetException(
+            "Invalid n-gram bloom filter options for column ", path);
+      }
+      ngram_bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    /// Disable writing n-gram bloom filters for column specified by `path`.
+    Builder* disable_ngram_bloom_filter(const std::string& path) {
+      ngram_bloom_filter_options_[path] = std::nullopt;
+      return this;
+    }
+
     /// Target size of the RowGroup
     Builder* set_parquet_block_size(int64_t size) {
       parquet_block_size_ = size;
@@ -843,6 +891,8 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_pagesize_limit(item.second);
       for (const auto& item : pagesize_)
         get(item.first).set_pagesize(item.second);
+      for (const auto& item : ngram_bloom_filter_options_)
+        get(item.first).set_ngram_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_,
@@ -887,6 +937,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> page_index_enabled_;
     std::unordered_map<std::string, int64_t> dictionary_pagesize_limit_;
     std::unordered_map<std::string, int64_t> pagesize_;
+    std::unordered_map<std::string, std::optional<NGramBloomFilterOptions>>
+        ngram_bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const {
@@ -1017,6 +1069,11 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).data_pagesize();
   }
 
+  const std::optional<NGramBloomFilterOptions>& ngram_bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).ngram_bloom_filter_options();
+  }
+
   int64_t data_pagesize() const {
     return default_column_properties_.data_pagesize();
   }
@@ -58,7 +58,7 @@
 
 #include "bolt/dwio/parquet/arrow/Properties.h"
 #include "bolt/dwio/parquet/arrow/Types.h"
-#include "bolt/dwio/parquet/arrow/generated/parquet_types.h"
+#include "bolt/dwio/parquet/arrow/generated/codegen/parquet_types.h"
 namespace bytedance::bolt::parquet::arrow {
 
 // ----------------------------------------------------------------------
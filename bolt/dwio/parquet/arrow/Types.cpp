@@ -40,7 +40,7 @@
 #include "arrow/util/logging.h"
 #include "bolt/dwio/parquet/arrow/Exception.h"
 #include "bolt/dwio/parquet/arrow/Types.h"
-#include "bolt/dwio/parquet/arrow/generated/parquet_types.h"
+#include "bolt/dwio/parquet/arrow/generated/codegen/parquet_types.h"
 
 using arrow::internal::checked_cast;
 namespace bytedance::bolt::parquet::arrow {
@@ -576,6 +576,10 @@ class FileWriterImpl : public FileWriter {
     return 0;
   }
 
+  RowGroupWriter* currentRowGroupWriter() const override {
+    return row_group_writer_;
+  }
+
  private:
   friend class FileWriter;
 
@@ -51,6 +51,7 @@ namespace bytedance::bolt::parquet::arrow {
 
 class FileMetaData;
 class ParquetFileWriter;
+class RowGroupWriter;
 
 namespace arrow {
 
@@ -176,6 +177,11 @@ class PARQUET_EXPORT FileWriter {
   virtual const int64_t getWrittenBytesPerRow() const = 0;
 
   virtual const int64_t totalCompressedBytesAll() const = 0;
+
+  /// \brief Return the row group started by the last NewRowGroup() or
+  /// NewBufferedRowGroup() call, or nullptr if there is none. Lets callers
+  /// that do not hold Arrow data write the column chunks themselves.
+  virtual RowGroupWriter* currentRowGroupWriter() const = 0;
 };
 
 /// \brief Write Parquet file metadata only to indicated Arrow OutputStream
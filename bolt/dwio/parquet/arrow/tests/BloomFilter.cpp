@@ -40,7 +40,7 @@
 
 #include "bolt/dwio/parquet/arrow/Exception.h"
 #include "bolt/dwio/parquet/arrow/ThriftInternal.h"
-#include "bolt/dwio/parquet/arrow/generated/parquet_types.h"
+#include "bolt/dwio/parquet/arrow/generated/codegen/parquet_types.h"
 #include "bolt/dwio/parquet/arrow/tests/BloomFilter.h"
 #include "bolt/dwio/parquet/arrow/tests/XxHasher.h"
 namespace bytedance::bolt::parquet::arrow {
@@ -64,6 +64,13 @@ ColumnChunkMetaDataPtr::pageEncodingStats() const {
   return thriftColumnChunkPtr(ptr_)->meta_data.encoding_stats;
 }
 
+size_t ColumnChunkMetaDataPtr::numTokenBloomFilters() const {
+  const auto& metaData = thriftColumnChunkPtr(ptr_)->meta_data;
+  return metaData.__isset.token_bloom_filter_offset
+      ? metaData.token_bloom_filter_offset.size()
+      : 0;
+}
+
 std::string ColumnChunkMetaDataPtr::toString() const {
   std::stringstream ss;
   thriftColumnChunkPtr(ptr_)->printTo(ss);
@@ -53,6 +53,9 @@ class ColumnChunkMetaDataPtr {
 
   const std::vector<thrift::PageEncodingStats>& pageEncodingStats() const;
 
+  /// Number of n-gram bloom filters written for the column chunk.
+  size_t numTokenBloomFilters() const;
+
   std::string toString() const;
 
  private:
@@ -38,6 +38,7 @@
 #include "bolt/dwio/parquet/reader/ParquetColumnReader.h"
 #include "bolt/dwio/parquet/reader/ParquetFooterCache.h"
 #include "bolt/dwio/parquet/reader/SchemaHelper.h"
+#include "bolt/dwio/parquet/reader/Statistics.h"
 #include "bolt/dwio/parquet/reader/StructColumnReader.h"
 #include "bolt/dwio/parquet/thrift/FmtParquetFormatters.h"
 #include "bolt/dwio/parquet/thrift/ThriftTransport.h"
@@ -1092,6 +1093,10 @@ class ParquetRowReader::Impl {
       metadataFilter->eval(res.metadataFilterResults, res.filterResult);
     }
 
+    // Rows skipped by position cannot be told apart in the statistics.
+    auto* metadataAggregation = options_.getSkipRows() == 0
+        ? options_.getMetadataAggregation().get()
+        : nullptr;
     uint64_t rowNumber = 0;
     for (auto i = 0; i < rowGroups_.size(); i++) {
       BOLT_CHECK_GT(rowGroups_[i].columns.size(), 0);
@@ -1110,6 +1115,20 @@ class ParquetRowReader::Impl {
           (i < res.totalCount && bits::isBitSet(res.filterResult.data(), i));
       auto isEmpty = rowGroups_[i].num_rows == 0;
 
+      // A row group whose rows all pass the filters may be answered from its
+      // statistics instead of being read.
+      if (rowGroupInRange && !isExcluded && !isEmpty && metadataAggregation &&
+          metadataAggregation->addRowGroup(
+              *options_.getScanSpec(),
+              rowGroups_[i].num_rows,
+              [&](const std::string& column) {
+                return columnStats(i, column);
+              })) {
+        ++numAggregatedRowGroups_;
+        rowNumber += rowGroups_[i].num_rows;
+        continue;
+      }
+
       // Add a row group to read if it is within range and not empty and not in
       // the excluded list.
       if (rowGroupInRange && !isExcluded && !isEmpty) {
@@ -1181,8 +1200,10 @@ class ParquetRowReader::Impl {
   }
 
   void updateRuntimeStats(dwio::common::RuntimeStatistics& stats) const {
-    stats.skippedStrides += rowGroups_.size() - rowGroupIds_.size();
+    stats.skippedStrides +=
+        rowGroups_.size() - rowGroupIds_.size() - numAggregatedRowGroups_;
     stats.processedStrides += rowGroupIds_.size();
+    stats.aggregatedStrides += numAggregatedRowGroups_;
   }
 
   void resetFilterCaches() {
@@ -1212,6 +1233,72 @@ class ParquetRowReader::Impl {
     return true;
   }
 
+  // Returns the statistics of top-level column 'name' in row group
+  // 'rowGroup'. Integer bounds are only set if they are exact in the signed
+  // order of the column.
+  dwio::common::MetadataAggregation::ColumnStats columnStats(
+      uint32_t rowGroup,
+      const std::string& name) const {
+    const auto& schema = *readerBase_->schemaWithId();
+    if (!schema.containsChild(name)) {
+      return {};
+    }
+    const auto& column =
+        static_cast<const ParquetTypeWithId&>(*schema.childByName(name));
+    if (!column.isLeaf() || column.maxRepeat_ > 0) {
+      return {};
+    }
+    const auto& chunk = rowGroups_[rowGroup].columns[column.column()];
+    if (!chunk.__isset.meta_data || !chunk.meta_data.__isset.statistics ||
+        !chunk.meta_data.statistics.__isset.null_count) {
+      return {};
+    }
+    const auto& stats = chunk.meta_data.statistics;
+    const uint64_t numValues = rowGroups_[rowGroup].num_rows - stats.null_count;
+    std::optional<int64_t> min;
+    std::optional<int64_t> max;
+    if (isSignedInteger(column)) {
+      if (column.parquetType_ == thrift::Type::INT32) {
+        min = getMin<int32_t>(stats);
+        max = getMax<int32_t>(stats);
+      } else {
+        min = getMin<int64_t>(stats);
+        max = getMax<int64_t>(stats);
+      }
+    }
+    return {
+        std::make_unique<dwio::common::IntegerColumnStatistics>(
+            numValues,
+            stats.null_count > 0,
+            std::nullopt,
+            std::nullopt,
+            min,
+            max,
+            std::nullopt),
+        column.type()};
+  }
+
+  static bool isSignedInteger(const ParquetTypeWithId& column) {
+    if (column.type()->isDecimal() ||
+        (column.parquetType_ != thrift::Type::INT32 &&
+         column.parquetType_ != thrift::Type::INT64)) {
+      return false;
+    }
+    if (column.logicalType_.has_value() &&
+        column.logicalType_->__isset.INTEGER) {
+      return column.logicalType_->INTEGER.isSigned;
+    }
+    switch (column.convertedType_.value_or(thrift::ConvertedType::INT_64)) {
+      case thrift::ConvertedType::UINT_8:
+      case thrift::ConvertedType::UINT_16:
+      case thrift::ConvertedType::UINT_32:
+      case thrift::ConvertedType::UINT_64:
+        return false;
+      default:
+        return true;
+    }
+  }
+
   memory::MemoryPool& pool_;
   const std::shared_ptr<ReaderBase> readerBase_;
   const dwio::common::RowReaderOptions options_;
@@ -1221,6 +1308,8 @@ class ParquetRowReader::Impl {
   // Indices of row groups where stats match filters.
   std::vector<uint32_t> rowGroupIds_;
   std::vector<uint64_t> firstRowOfRowGroup_;
+  // Number of row groups answered from statistics and not read.
+  uint64_t numAggregatedRowGroups_{0};
   uint32_t nextRowGroupIdsIdx_;
   const thrift::RowGroup* FOLLY_NULLABLE currentRowGroupPtr_{nullptr};
   uint64_t rowsInCurrentRowGroup_;
@@ -35,6 +35,7 @@
 #include "bolt/dwio/common/tests/utils/DataFiles.h"
 #include "bolt/dwio/parquet/RegisterParquetReader.h"
 #include "bolt/dwio/parquet/reader/ParquetReader.h"
+#include "bolt/exec/PlanNodeStats.h"
 #include "bolt/exec/tests/utils/AssertQueryBuilder.h"
 #include "bolt/exec/tests/utils/HiveConnectorTestBase.h"
 #include "bolt/exec/tests/utils/PlanBuilder.h"
@@ -997,6 +998,61 @@ TEST_F(ParquetTableScanTest, testColumnNotExists) {
       "SELECT a, b, NULL, NULL, NULL FROM tmp");
 }
 
+TEST_F(ParquetTableScanTest, metadataAggregation) {
+  // 10 row groups of 100 rows. Rows 550 to 559 have a null 'a'.
+  constexpr int kSize = 1'000;
+  auto vector = makeRowVector(
+      {"a", "b"},
+      {
+          makeFlatVector<int64_t>(
+              kSize,
+              [](auto row) { return row; },
+              [](auto row) { return row >= 550 && row < 560; }),
+          makeFlatVector<double>(kSize, [](auto row) { return row * 0.5; }),
+      });
+  auto rowType = asRowType(vector->type());
+  auto file = TempFilePath::create();
+  WriterOptions options;
+  options.flushPolicyFactory = []() {
+    return std::make_unique<LambdaFlushPolicy>(
+        100, 1L << 30, []() { return false; });
+  };
+  writeToParquetFile(file->getPath(), {vector}, options);
+  createDuckDbTable({vector});
+
+  const auto assertAggregation = [&](const std::string& filter,
+                                     const std::string& sql,
+                                     int64_t expectedAggregated) {
+    core::PlanNodeId scanNodeId;
+    auto plan = PlanBuilder()
+                    .tableScan(rowType, {filter})
+                    .capturePlanNodeId(scanNodeId)
+                    .partialAggregation(
+                        {}, {"count(1)", "count(a)", "min(a)", "max(a)"})
+                    .finalAggregation()
+                    .planNode();
+    auto task = AssertQueryBuilder(plan, duckDbQueryRunner_)
+                    .config(core::QueryConfig::kAggregationMetadataPushdown,
+                            "true")
+                    .split(makeSplit(file->getPath()))
+                    .assertResults(sql);
+    auto stats = toPlanStats(task->taskStats()).at(scanNodeId).customStats;
+    ASSERT_EQ(stats.at("aggregatedStrides").sum, expectedAggregated);
+  };
+
+  // Row groups 0 and 1 are skipped, 2 is partially selected and 5 has nulls
+  // that fail the filter. The other 6 are answered from the statistics.
+  assertAggregation(
+      "a >= 250",
+      "SELECT count(1), count(a), min(a), max(a) FROM tmp WHERE a >= 250",
+      6);
+  // A filter on a double column is not proven by the statistics.
+  assertAggregation(
+      "b < 1000.0",
+      "SELECT count(1), count(a), min(a), max(a) FROM tmp WHERE b < 1000.0",
+      0);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   // todo: use folly::Init init after upgrade folly lib
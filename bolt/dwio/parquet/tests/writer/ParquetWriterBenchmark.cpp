@@ -24,8 +24,11 @@
 #include "bolt/dwio/parquet/writer/Writer.h"
 #include "bolt/exec/tests/utils/TempDirectoryPath.h"
 
+#include <arrow/memory_pool.h>
 #include <folly/Benchmark.h>
 #include <folly/init/Init.h>
+#include <iostream>
+#include <map>
 using namespace bytedance::bolt;
 using namespace bytedance::bolt::dwio;
 using namespace bytedance::bolt::dwio::common;
@@ -35,12 +38,24 @@ using namespace bytedance::bolt::test;
 const uint32_t kNumBatches = 50;
 const uint32_t kNumRowsPerRowGroup = 10000;
 
+struct PeakMemory {
+  int64_t boltBytes{0};
+  int64_t arrowBytes{0};
+};
+
+// Highest memory use of each benchmark across its iterations, reported after
+// the timings. Bolt memory covers the output buffer and the Arrow export,
+// Arrow memory the column writers.
+std::map<std::string, PeakMemory> peakMemory;
+
 class ParquetWriterBenchmark {
  public:
   explicit ParquetWriterBenchmark(
       bool disableDictionary,
+      bool vectorColumnWriter,
       const RowTypePtr& rowType)
-      : disableDictionary_(disableDictionary) {
+      : disableDictionary_(disableDictionary),
+        arrowPool_(::arrow::default_memory_pool()) {
     rootPool_ = memory::memoryManager()->addRootPool("ParquetWriterBenchmark");
     leafPool_ = rootPool_->addLeafChild("ParquetWriterBenchmark");
     dataSetBuilder_ = std::make_unique<DataSetBuilder>(*leafPool_, 0);
@@ -58,9 +73,11 @@ class ParquetWriterBenchmark {
       // The parquet file is in plain encoding format.
       options.enableDictionary = false;
     }
+    options.enableVectorColumnWriter = vectorColumnWriter;
     options.memoryPool = rootPool_.get();
+    writerPool_ = rootPool_->addAggregateChild("ParquetWriter");
     writer_ = std::make_unique<bytedance::bolt::parquet::Writer>(
-        std::move(sink), options, rowType);
+        std::move(sink), options, writerPool_, &arrowPool_, rowType);
   }
 
   ~ParquetWriterBenchmark() {}
@@ -92,6 +109,10 @@ class ParquetWriterBenchmark {
     writeToFile(*batches, true);
   }
 
+  PeakMemory peakMemory() const {
+    return {writerPool_->peakBytes(), arrowPool_.max_memory()};
+  }
+
  private:
   const std::string fileName_ = "test.parquet";
   const std::shared_ptr<bytedance::bolt::exec::test::TempDirectoryPath>
@@ -101,6 +122,8 @@ class ParquetWriterBenchmark {
   std::unique_ptr<test::DataSetBuilder> dataSetBuilder_;
   std::shared_ptr<memory::MemoryPool> rootPool_;
   std::shared_ptr<memory::MemoryPool> leafPool_;
+  std::shared_ptr<memory::MemoryPool> writerPool_;
+  ::arrow::ProxyMemoryPool arrowPool_;
   std::unique_ptr<bytedance::bolt::parquet::Writer> writer_;
 };
 
@@ -110,11 +133,23 @@ void run(
     const TypePtr& type,
     uint8_t nullsRateX100,
     uint32_t batchSize,
-    bool disableDictionary) {
+    bool disableDictionary,
+    bool vectorColumnWriter = false) {
   RowTypePtr rowType = ROW({columnName}, {type});
-  ParquetWriterBenchmark benchmark(disableDictionary, rowType);
+  ParquetWriterBenchmark benchmark(
+      disableDictionary, vectorColumnWriter, rowType);
   BIGINT()->toString();
   benchmark.writeSingleColumn(columnName, type, nullsRateX100, batchSize);
+
+  folly::BenchmarkSuspender suspender;
+  auto peak = benchmark.peakMemory();
+  auto& maxPeak = peakMemory[fmt::format(
+      "{}_batch_{}{}",
+      columnName,
+      batchSize,
+      vectorColumnWriter ? "_vector" : "")];
+  maxPeak.boltBytes = std::max(maxPeak.boltBytes, peak.boltBytes);
+  maxPeak.arrowBytes = std::max(maxPeak.arrowBytes, peak.arrowBytes);
 }
 
 #define PARQUET_BENCHMARKS_NULLS(_type_, _name_, _null_)                      \
@@ -131,9 +166,38 @@ void run(
 #define PARQUET_BENCHMARKS(_type_, _name_) \
   PARQUET_BENCHMARKS_NULLS(_type_, _name_, 20)
 
+// Arrow export vs. encoding directly from the vectors.
+#define PARQUET_VECTOR_BENCHMARKS(_type_, _name_)                   \
+  BENCHMARK_NAMED_PARAM(                                            \
+      run, _name_##_batch_32k, #_name_, _type_, 20, 32768, false);  \
+  BENCHMARK_RELATIVE_NAMED_PARAM(                                   \
+      run,                                                          \
+      _name_##_batch_32k_vector,                                    \
+      #_name_,                                                      \
+      _type_,                                                       \
+      20,                                                           \
+      32768,                                                        \
+      false,                                                        \
+      true);                                                        \
+  BENCHMARK_NAMED_PARAM(                                            \
+      run, _name_##_batch_1M, #_name_, _type_, 20, 1048576, false); \
+  BENCHMARK_RELATIVE_NAMED_PARAM(                                   \
+      run,                                                          \
+      _name_##_batch_1M_vector,                                     \
+      #_name_,                                                      \
+      _type_,                                                       \
+      20,                                                           \
+      1048576,                                                      \
+      false,                                                        \
+      true);                                                        \
+  BENCHMARK_DRAW_LINE();
+
 PARQUET_BENCHMARKS(VARCHAR(), Varchar);
 PARQUET_BENCHMARKS(BIGINT(), BigInt);
 PARQUET_BENCHMARKS(DOUBLE(), Double);
+PARQUET_VECTOR_BENCHMARKS(VARCHAR(), Varchar);
+PARQUET_VECTOR_BENCHMARKS(BIGINT(), BigInt);
+PARQUET_VECTOR_BENCHMARKS(DOUBLE(), Double);
 PARQUET_BENCHMARKS(DECIMAL(18, 3), ShortDecimalType);
 PARQUET_BENCHMARKS(DECIMAL(38, 3), LongDecimalType);
 PARQUET_BENCHMARKS(MAP(BIGINT(), BIGINT()), Map);
@@ -146,5 +210,11 @@ int main(int argc, char** argv) {
   folly::init(&argc, &argv);
   memory::MemoryManager::initialize({});
   folly::runBenchmarks();
+
+  std::cout << "Peak memory (bolt / arrow bytes):" << std::endl;
+  for (const auto& [name, peak] : peakMemory) {
+    std::cout << "  " << name << ": " << peak.boltBytes << " / "
+              << peak.arrowBytes << std::endl;
+  }
   return 0;
 }
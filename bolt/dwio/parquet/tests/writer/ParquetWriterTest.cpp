@@ -577,3 +577,200 @@ TEST_F(ParquetWriterTest, columnPageSize) {
   ASSERT_EQ(1, chunk2PageEncodingStats.size());
   ASSERT_EQ(4, chunk2PageEncodingStats[0].count); // data page num
 }
+
+TEST_F(ParquetWriterTest, vectorColumnWriter) {
+  const vector_size_t kRows = 3'000;
+  auto schema =
+      ROW({"c0", "c1", "c2", "c3", "c4", "c5", "c6", "c7", "c8", "c9"},
+          {BOOLEAN(),
+           TINYINT(),
+           SMALLINT(),
+           INTEGER(),
+           BIGINT(),
+           REAL(),
+           DOUBLE(),
+           VARCHAR(),
+           VARBINARY(),
+           DATE()});
+  auto data = bytedance::bolt::test::BatchMaker::createBatch(
+      schema, kRows, *leafPool_, [](auto row) { return row % 7 == 0; });
+  // Flat, dictionary and constant columns of every type.
+  auto& children = std::dynamic_pointer_cast<RowVector>(data)->children();
+  for (int i = 0; i < children.size(); ++i) {
+    if (i % 3 == 1) {
+      children[i] = BaseVector::wrapInDictionary(
+          makeNulls(kRows, [](auto row) { return row % 11 == 0; }),
+          makeIndicesInReverse(kRows),
+          kRows,
+          children[i]);
+    } else if (i % 3 == 2) {
+      children[i] = BaseVector::wrapInConstant(kRows, i, children[i]);
+    }
+  }
+
+  vp::WriterOptions writerOptions{};
+  writerOptions.enableVectorColumnWriter = true;
+  assertWrite(
+      tempPath_->path + "/vectorColumnWriterBuffered.parquet",
+      kRows,
+      schema,
+      data,
+      writerOptions);
+
+  // Staged writes are split into row groups of 1'000 rows on flush.
+  std::string parquetPath = tempPath_->path + "/vectorColumnWriter.parquet";
+  writerOptions.memoryPool = leafPool_.get();
+  writerOptions.flushPolicyFactory = []() {
+    return std::make_unique<DefaultFlushPolicy>(1'000, 1L << 30);
+  };
+  auto writer = std::make_unique<vp::Writer>(
+      dwio::common::FileSink::create(parquetPath, {.pool = pool_.get()}),
+      writerOptions,
+      rootPool_,
+      ::arrow::default_memory_pool(),
+      schema);
+  EXPECT_TRUE(writer->testingUsesVectorColumnWriter());
+  writer->write(data);
+  writer->write(data);
+  writer->close();
+
+  auto expected = BaseVector::create(schema, 2 * kRows, pool_.get());
+  expected->copy(data.get(), 0, 0, kRows);
+  expected->copy(data.get(), kRows, 0, kRows);
+  assertRead(parquetPath, 2 * kRows, schema, expected);
+  EXPECT_EQ(
+      createLocalParquetReader(parquetPath)->fileMetaData().numRowGroups(), 6);
+
+  // Types without a direct encoding fall back to the Arrow path.
+  auto fallbackSchema = ROW({"c0", "c1"}, {BIGINT(), TIMESTAMP()});
+  auto fallbackData = bytedance::bolt::test::BatchMaker::createBatch(
+      fallbackSchema, kRows, *leafPool_, [](auto row) { return row % 7 == 0; });
+  const auto fallbackPath =
+      tempPath_->path + "/vectorColumnWriterFallback.parquet";
+  writer = createLocalWriter(fallbackPath, fallbackSchema, writerOptions);
+  EXPECT_FALSE(writer->testingUsesVectorColumnWriter());
+  writer->write(fallbackData);
+  writer->close();
+  assertRead(fallbackPath, kRows, fallbackSchema, fallbackData);
+}
+
+TEST_F(ParquetWriterTest, ngramBloomFilter) {
+  const vector_size_t kRows = 1'000;
+  auto schema = ROW({"c0", "c1", "c2"}, {VARCHAR(), VARCHAR(), BIGINT()});
+  auto data = makeRowVector({
+      makeFlatVector<std::string>(
+          kRows,
+          [](auto row) { return fmt::format("user_{} clicked", row % 97); },
+          nullEvery(5)),
+      makeFlatVector<std::string>(
+          kRows, [](auto row) { return std::to_string(row); }),
+      makeFlatVector<int64_t>(kRows, [](auto row) { return row; }),
+  });
+
+  std::string parquetPath = tempPath_->path + "/ngramBloomFilter.parquet";
+  vp::WriterOptions writerOptions{};
+  vp::arrow::NGramBloomFilterOptions ngramOptions;
+  ngramOptions.ngram = 4;
+  ngramOptions.expected_ngrams = 1'000;
+  writerOptions.columnNGramBloomFilterMap["c0"] = ngramOptions;
+  // Filters are only written for BYTE_ARRAY columns.
+  writerOptions.columnNGramBloomFilterMap["c2"] = ngramOptions;
+  assertWrite(parquetPath, kRows, schema, data, writerOptions);
+
+  auto reader = createLocalParquetReader(parquetPath);
+  for (auto i = 0; i < reader->fileMetaData().numRowGroups(); ++i) {
+    auto rowGroup = reader->fileMetaData().rowGroup(i);
+    EXPECT_EQ(rowGroup.columnChunk(0).numTokenBloomFilters(), 1);
+    EXPECT_EQ(rowGroup.columnChunk(1).numTokenBloomFilters(), 0);
+    EXPECT_EQ(rowGroup.columnChunk(2).numTokenBloomFilters(), 0);
+  }
+
+  // Options are validated when the writer properties are built.
+  ngramOptions.ngram = 0;
+  writerOptions.columnNGramBloomFilterMap["c0"] = ngramOptions;
+  EXPECT_THROW(
+      createLocalWriter(
+          tempPath_->path + "/ngramBloomFilterInvalid.parquet",
+          schema,
+          writerOptions),
+      vp::arrow::ParquetException);
+}
+
+TEST_F(ParquetWriterTest, ngramBloomFilterScan) {
+  const vector_size_t kRowsInRowGroup = 250;
+  const std::vector<std::string> kFruits = {
+      "apple", "banana", "cherry", "durian"};
+  const vector_size_t kRowGroups = kFruits.size();
+  const vector_size_t kRows = kRowsInRowGroup * kRowGroups;
+  auto schema = ROW({"c0", "c1"}, {VARCHAR(), BIGINT()});
+  const auto value = [&](auto row) {
+    return fmt::format("{} order {}", kFruits[row / kRowsInRowGroup], row);
+  };
+  const auto isNull = [](auto row) { return row % 5 == 0; };
+
+  std::string parquetPath = tempPath_->path + "/ngramBloomFilterScan.parquet";
+  vp::WriterOptions writerOptions;
+  writerOptions.memoryPool = rootPool_.get();
+  writerOptions.enableDictionary = false;
+  writerOptions.flushPolicyFactory = [&]() {
+    return std::make_unique<LambdaFlushPolicy>(
+        kRowsInRowGroup, 1L << 30, []() { return false; });
+  };
+  vp::arrow::NGramBloomFilterOptions ngramOptions;
+  ngramOptions.ngram = 4;
+  ngramOptions.expected_ngrams = 1'000;
+  writerOptions.columnNGramBloomFilterMap["c0"] = ngramOptions;
+  auto writer = std::make_unique<vp::Writer>(
+      createSink(parquetPath), writerOptions, schema);
+  for (auto i = 0; i < kRowGroups; ++i) {
+    const auto offset = i * kRowsInRowGroup;
+    writer->write(makeRowVector({
+        makeFlatVector<std::string>(
+            kRowsInRowGroup,
+            [&](auto row) { return value(offset + row); },
+            [&](auto row) { return isNull(offset + row); }),
+        makeFlatVector<int64_t>(
+            kRowsInRowGroup, [&](auto row) { return offset + row; }),
+    }));
+  }
+  writer->close();
+  ASSERT_EQ(
+      createLocalParquetReader(parquetPath)->fileMetaData().numRowGroups(),
+      kRowGroups);
+
+  // Returns the number of skipped row groups. The rows read must be the rows
+  // of an unfiltered scan that contain 'token'.
+  const auto scan = [&](const std::string& pattern, const std::string& token) {
+    std::vector<vector_size_t> rows;
+    for (auto row = 0; row < kRows; ++row) {
+      if (!isNull(row) && value(row).find(token) != std::string::npos) {
+        rows.push_back(row);
+      }
+    }
+    auto expected = makeRowVector({
+        makeFlatVector<std::string>(
+            rows.size(), [&](auto i) { return value(rows[i]); }),
+        makeFlatVector<int64_t>(rows.size(), [&](auto i) { return rows[i]; }),
+    });
+
+    auto scanSpec = makeScanSpec(schema);
+    scanSpec->getOrCreateChild("c0")->setFilter(
+        std::make_unique<common::Like>(pattern, false));
+    auto rowReaderOpts = getReaderOpts(schema);
+    rowReaderOpts.setScanSpec(scanSpec);
+    auto rowReader =
+        createLocalParquetReader(parquetPath)->createRowReader(rowReaderOpts);
+    assertReadWithReaderAndExpected(schema, *rowReader, expected, *leafPool_);
+    RuntimeStatistics stats;
+    rowReader->updateRuntimeStats(stats);
+    return stats.skippedStrides;
+  };
+
+  EXPECT_EQ(scan("%order%", "order"), 0);
+  EXPECT_EQ(scan("%cherry%", "cherry"), kRowGroups - 1);
+  EXPECT_EQ(scan("%cherry order 6%", "cherry order 6"), kRowGroups - 1);
+  EXPECT_EQ(scan("%mangosteen%", "mangosteen"), kRowGroups);
+  // Tokens shorter than the n-grams cannot skip row groups.
+  EXPECT_EQ(scan("%ban%", "ban"), 0);
+  EXPECT_EQ(scan("%y o%", "y o"), 0);
+}
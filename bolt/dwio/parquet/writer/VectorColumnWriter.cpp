@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/dwio/parquet/writer/VectorColumnWriter.h"
+
+#include <arrow/type.h>
+#include <algorithm>
+
+#include "bolt/dwio/parquet/arrow/ColumnWriter.h"
+#include "bolt/dwio/parquet/arrow/Schema.h"
+namespace bytedance::bolt::parquet {
+namespace {
+
+// Rows gathered per WriteBatch call. Bounds the scratch buffers independently
+// of the batch size.
+constexpr vector_size_t kRowsPerChunk = 4'096;
+
+template <typename ParquetType, typename T>
+inline ParquetType toParquet(const T& value) {
+  if constexpr (std::is_same_v<T, StringView>) {
+    return ParquetType(
+        value.size(), reinterpret_cast<const uint8_t*>(value.data()));
+  } else {
+    return static_cast<ParquetType>(value);
+  }
+}
+
+} // namespace
+
+bool VectorColumnWriter::supports(
+    const Type& type,
+    const ::arrow::DataType& arrowType) {
+  // Matching the Arrow type as well excludes the logical types that share a
+  // physical kind but are converted on export, e.g. short decimals and
+  // intervals.
+  switch (type.kind()) {
+    case TypeKind::BOOLEAN:
+      return arrowType.id() == ::arrow::Type::BOOL;
+    case TypeKind::TINYINT:
+      return arrowType.id() == ::arrow::Type::INT8;
+    case TypeKind::SMALLINT:
+      return arrowType.id() == ::arrow::Type::INT16;
+    case TypeKind::INTEGER:
+      return arrowType.id() == ::arrow::Type::INT32 ||
+          arrowType.id() == ::arrow::Type::DATE32;
+    case TypeKind::BIGINT:
+      return arrowType.id() == ::arrow::Type::INT64;
+    case TypeKind::REAL:
+      return arrowType.id() == ::arrow::Type::FLOAT;
+    case TypeKind::DOUBLE:
+      return arrowType.id() == ::arrow::Type::DOUBLE;
+    case TypeKind::VARCHAR:
+      return arrowType.id() == ::arrow::Type::STRING ||
+          arrowType.id() == ::arrow::Type::LARGE_STRING;
+    case TypeKind::VARBINARY:
+      return arrowType.id() == ::arrow::Type::BINARY ||
+          arrowType.id() == ::arrow::Type::LARGE_BINARY;
+    default:
+      return false;
+  }
+}
+
+void VectorColumnWriter::write(
+    const std::vector<RowVectorPtr>& batches,
+    column_index_t channel,
+    int64_t offset,
+    int64_t numRows,
+    arrow::ColumnWriter& writer) {
+  for (const auto& batch : batches) {
+    if (numRows == 0) {
+      break;
+    }
+    const int64_t size = batch->size();
+    if (offset >= size) {
+      offset -= size;
+      continue;
+    }
+    const auto& column = batch->childAt(channel);
+    decoded_.decode(*column);
+    const auto end = std::min<int64_t>(size, offset + numRows);
+    for (auto begin = offset; begin < end; begin += kRowsPerChunk) {
+      writeRows(
+          column->typeKind(),
+          begin,
+          std::min<int64_t>(end, begin + kRowsPerChunk),
+          writer);
+    }
+    numRows -= end - offset;
+    offset = 0;
+  }
+  BOLT_CHECK_EQ(numRows, 0, "Not enough rows staged for Parquet column");
+}
+
+void VectorColumnWriter::writeRows(
+    TypeKind kind,
+    vector_size_t begin,
+    vector_size_t end,
+    arrow::ColumnWriter& writer) {
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+      writeValues<arrow::BooleanType, bool>(begin, end, writer);
+      break;
+    case TypeKind::TINYINT:
+      writeValues<arrow::Int32Type, int8_t>(begin, end, writer);
+      break;
+    case TypeKind::SMALLINT:
+      writeValues<arrow::Int32Type, int16_t>(begin, end, writer);
+      break;
+    case TypeKind::INTEGER:
+      writeValues<arrow::Int32Type, int32_t>(begin, end, writer);
+      break;
+    case TypeKind::BIGINT:
+      writeValues<arrow::Int64Type, int64_t>(begin, end, writer);
+      break;
+    case TypeKind::REAL:
+      writeValues<arrow::FloatType, float>(begin, end, writer);
+      break;
+    case TypeKind::DOUBLE:
+      writeValues<arrow::DoubleType, double>(begin, end, writer);
+      break;
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      writeValues<arrow::ByteArrayType, StringView>(begin, end, writer);
+      break;
+    default:
+      BOLT_UNSUPPORTED("Unsupported type for Parquet vector writer: {}", kind);
+  }
+}
+
+template <typename DType, typename T>
+void VectorColumnWriter::writeValues(
+    vector_size_t begin,
+    vector_size_t end,
+    arrow::ColumnWriter& writer) {
+  using ParquetType = typename DType::c_type;
+  BOLT_CHECK_EQ(writer.type(), DType::type_num);
+  auto& typedWriter = static_cast<arrow::TypedColumnWriter<DType>&>(writer);
+  const auto maxDefinitionLevel = writer.descr()->max_definition_level();
+  const auto numRows = end - begin;
+
+  int64_t numValues;
+  const auto* defLevels =
+      definitionLevels(begin, end, maxDefinitionLevel, numValues);
+
+  // Flat values of the physical width are written in place. The null bits of
+  // the vector are the Parquet validity bitmap.
+  if constexpr (std::is_same_v<ParquetType, T> && !std::is_same_v<T, bool>) {
+    if (decoded_.isIdentityMapping()) {
+      const auto* values = decoded_.data<T>() + begin;
+      if (numValues == numRows) {
+        typedWriter.WriteBatch(numRows, defLevels, nullptr, values);
+      } else {
+        typedWriter.WriteBatchSpaced(
+            numRows,
+            defLevels,
+            nullptr,
+            reinterpret_cast<const uint8_t*>(decoded_.nulls()),
+            begin,
+            values);
+      }
+      return;
+    }
+  }
+
+  // Dictionary and constant vectors and values that need widening are
+  // gathered densely. The base vector is never flattened.
+  auto* values = valuesScratch<ParquetType>(numValues);
+  if (decoded_.isConstantMapping()) {
+    if (numValues > 0) {
+      std::fill_n(
+          values, numValues, toParquet<ParquetType>(decoded_.valueAt<T>(0)));
+    }
+  } else if (numValues == numRows) {
+    for (auto row = begin; row < end; ++row) {
+      values[row - begin] = toParquet<ParquetType>(decoded_.valueAt<T>(row));
+    }
+  } else {
+    int64_t numGathered = 0;
+    for (auto row = begin; row < end; ++row) {
+      if (!decoded_.isNullAt(row)) {
+        values[numGathered++] =
+            toParquet<ParquetType>(decoded_.valueAt<T>(row));
+      }
+    }
+  }
+  typedWriter.WriteBatch(numRows, defLevels, nullptr, values);
+}
+
+const int16_t* VectorColumnWriter::definitionLevels(
+    vector_size_t begin,
+    vector_size_t end,
+    int16_t maxDefinitionLevel,
+    int64_t& numValues) {
+  const auto numRows = end - begin;
+  if (!decoded_.mayHaveNulls()) {
+    numValues = numRows;
+    if (maxDefinitionLevel == 0) {
+      return nullptr;
+    }
+    defLevels_.assign(numRows, maxDefinitionLevel);
+    return defLevels_.data();
+  }
+
+  defLevels_.resize(numRows);
+  const int16_t nullLevel = maxDefinitionLevel - 1;
+  if (decoded_.isIdentityMapping()) {
+    const auto* nulls = decoded_.nulls();
+    for (auto row = begin; row < end; ++row) {
+      defLevels_[row - begin] =
+          bits::isBitSet(nulls, row) ? maxDefinitionLevel : nullLevel;
+    }
+  } else {
+    for (auto row = begin; row < end; ++row) {
+      defLevels_[row - begin] =
+          decoded_.isNullAt(row) ? nullLevel : maxDefinitionLevel;
+    }
+  }
+  numValues =
+      numRows - std::count(defLevels_.begin(), defLevels_.end(), nullLevel);
+  if (maxDefinitionLevel == 0) {
+    BOLT_USER_CHECK_EQ(
+        numValues, numRows, "Null value in a required Parquet column");
+    return nullptr;
+  }
+  return defLevels_.data();
+}
+
+} // namespace bytedance::bolt::parquet
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "bolt/vector/ComplexVector.h"
+#include "bolt/vector/DecodedVector.h"
+namespace arrow {
+class DataType;
+} // namespace arrow
+
+namespace bytedance::bolt::parquet {
+
+namespace arrow {
+class ColumnWriter;
+} // namespace arrow
+
+/// Encodes top-level primitive columns of Bolt vectors straight into Parquet
+/// column chunks, skipping the export to Arrow. Flat, dictionary and constant
+/// vectors are read in place: null bits become definition levels, flat values
+/// that already have the Parquet physical width are handed to the column
+/// writer without a copy, and everything else is gathered a chunk of rows at a
+/// time into a small scratch buffer. Strings are passed by reference to the
+/// vector's own buffers.
+class VectorColumnWriter {
+ public:
+  /// Returns true if a top-level column of 'type', described in the file
+  /// schema by 'arrowType', can be written by this class.
+  static bool supports(const Type& type, const ::arrow::DataType& arrowType);
+
+  /// Writes 'numRows' rows of column 'channel', starting at row 'offset' of
+  /// the concatenation of 'batches', to 'writer'. 'writer' must belong to the
+  /// leaf column of the file schema that 'channel' maps to.
+  void write(
+      const std::vector<RowVectorPtr>& batches,
+      column_index_t channel,
+      int64_t offset,
+      int64_t numRows,
+      arrow::ColumnWriter& writer);
+
+ private:
+  // Writes rows [begin, end) of 'decoded_'.
+  void writeRows(
+      TypeKind kind,
+      vector_size_t begin,
+      vector_size_t end,
+      arrow::ColumnWriter& writer);
+
+  // Writes rows [begin, end) of 'decoded_', whose values are of type 'T', to
+  // a Parquet column of physical type 'DType'.
+  template <typename DType, typename T>
+  void writeValues(
+      vector_size_t begin,
+      vector_size_t end,
+      arrow::ColumnWriter& writer);
+
+  // Fills 'defLevels_' for rows [begin, end) of 'decoded_' and returns it, or
+  // nullptr if the column is required. Returns the number of non-null rows in
+  // 'numValues'.
+  const int16_t* definitionLevels(
+      vector_size_t begin,
+      vector_size_t end,
+      int16_t maxDefinitionLevel,
+      int64_t& numValues);
+
+  template <typename T>
+  T* valuesScratch(vector_size_t size) {
+    valuesScratch_.resize(size * sizeof(T));
+    return reinterpret_cast<T*>(valuesScratch_.data());
+  }
+
+  DecodedVector decoded_;
+  std::vector<int16_t> defLevels_;
+  std::vector<uint8_t> valuesScratch_;
+};
+
+} // namespace bytedance::bolt::parquet
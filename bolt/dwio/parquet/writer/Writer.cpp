@@ -39,10 +39,12 @@
 #include <parquet/properties.h>
 #include "bolt/common/config/Config.h"
 #include "bolt/core/QueryConfig.h"
+#include "bolt/dwio/parquet/arrow/FileWriter.h"
 #include "bolt/dwio/parquet/arrow/Properties.h"
 #include "bolt/dwio/parquet/arrow/Types.h"
 #include "bolt/dwio/parquet/arrow/Writer.h"
 #include "bolt/dwio/parquet/writer/ArrowDataBufferSink.h"
+#include "bolt/dwio/parquet/writer/VectorColumnWriter.h"
 #include "bolt/exec/MemoryReclaimer.h"
 #include "bolt/vector/arrow/Bridge.h"
 
@@ -66,6 +68,8 @@ struct ArrowContext {
   int64_t stagingBytes = 0;
   // columns, Arrays
   std::vector<std::vector<std::shared_ptr<::arrow::Array>>> stagingChunks;
+  // Input batches staged for VectorColumnWriter.
+  std::vector<RowVectorPtr> stagingVectors;
 };
 
 Compression::type getArrowParquetCompression(
@@ -180,6 +184,9 @@ std::shared_ptr<WriterProperties::Builder> getArrowParquetWriterOptionsBuilder(
   for (const auto& [path, dataPageSize] : options.columnDataPageSizeMap) {
     properties = properties->data_pagesize(path, dataPageSize);
   }
+  for (const auto& [path, ngramOptions] : options.columnNGramBloomFilterMap) {
+    properties = properties->enable_ngram_bloom_filter(path, ngramOptions);
+  }
   if (options.enableFlushBasedOnBlockSize) {
     auto size = options.parquet_block_size > 0 ? options.parquet_block_size
                                                : DEFAULT_PARQUET_BLOCK_SIZE;
@@ -234,6 +241,12 @@ std::string WriterOptionsToString(const WriterOptions& options) {
     oss << key << ": " << value << ", ";
   }
   oss << "}" << std::endl;
+  oss << "  columnNGramBloomFilterMap: {";
+  for (const auto& [key, value] : options.columnNGramBloomFilterMap) {
+    oss << key << ": {ngram: " << value.ngram << ", fpp: " << value.fpp
+        << ", expectedNgrams: " << value.expected_ngrams << "}, ";
+  }
+  oss << "}" << std::endl;
   oss << "  dictionaryPageSizeLimit: " << options.dictionaryPageSizeLimit
       << std::endl;
   oss << "  columnDictionaryPageSizeLimitMap: {";
@@ -471,6 +484,10 @@ Writer::Writer(
       getArrowParquetWriterOptionsBuilder(options, flushPolicy_)->build();
   arrowContext_->arrowWriterProperties =
       options.getArrowWriterPropertiesBuilder()->build();
+  if (options.enableVectorColumnWriter && !enableRowGroupAlignedWrite_ &&
+      supportsVectorColumnWriter()) {
+    vectorColumnWriter_ = std::make_unique<VectorColumnWriter>();
+  }
   setMemoryReclaimers();
 
   VLOG(1) << "WriteOption values of ParquetWriter: "
@@ -490,6 +507,8 @@ Writer::Writer(
           ::arrow::default_memory_pool(),
           std::move(schema)} {}
 
+Writer::~Writer() = default;
+
 void Writer::flush() {
   if (enableRowGroupAlignedWrite_) {
     BOLT_CHECK(
@@ -509,28 +528,33 @@ void Writer::flush(int64_t rowsInCurrentRowGroup) {
   if (arrowContext_->stagingRows > 0) {
     createFileWriterIfNotExist();
 
-    auto fields = arrowContext_->schema->fields();
-    std::vector<std::shared_ptr<::arrow::ChunkedArray>> chunks;
-    for (int colIdx = 0; colIdx < fields.size(); colIdx++) {
-      auto dataType = fields.at(colIdx)->type();
-      auto chunk =
-          ::arrow::ChunkedArray::Make(
-              std::move(arrowContext_->stagingChunks.at(colIdx)), dataType)
-              .ValueOrDie();
-      chunks.push_back(chunk);
+    if (vectorColumnWriter_) {
+      flushVectors(rowsInCurrentRowGroup);
+    } else {
+      auto fields = arrowContext_->schema->fields();
+      std::vector<std::shared_ptr<::arrow::ChunkedArray>> chunks;
+      for (int colIdx = 0; colIdx < fields.size(); colIdx++) {
+        auto dataType = fields.at(colIdx)->type();
+        auto chunk =
+            ::arrow::ChunkedArray::Make(
+                std::move(arrowContext_->stagingChunks.at(colIdx)), dataType)
+                .ValueOrDie();
+        chunks.push_back(chunk);
+      }
+      auto table = ::arrow::Table::Make(
+          arrowContext_->schema,
+          std::move(chunks),
+          static_cast<int64_t>(arrowContext_->stagingRows));
+      PARQUET_THROW_NOT_OK(
+          arrowContext_->writer->WriteTable(*table, rowsInCurrentRowGroup));
     }
-    auto table = ::arrow::Table::Make(
-        arrowContext_->schema,
-        std::move(chunks),
-        static_cast<int64_t>(arrowContext_->stagingRows));
-    PARQUET_THROW_NOT_OK(
-        arrowContext_->writer->WriteTable(*table, rowsInCurrentRowGroup));
     flushPolicy_->setBytesPerRow(
         arrowContext_->writer->getWrittenBytesPerRow());
     PARQUET_THROW_NOT_OK(stream_->Flush());
     for (auto& chunk : arrowContext_->stagingChunks) {
       chunk.clear();
     }
+    arrowContext_->stagingVectors.clear();
     arrowContext_->stagingRows = 0;
     arrowContext_->stagingBytes = 0;
   }
@@ -618,6 +642,95 @@ void Writer::splitWriteRecordBatch(
   }
 }
 
+void Writer::flushVectors(int64_t rowsInRowGroup) {
+  BOLT_CHECK_GT(rowsInRowGroup, 0, "Row group size must be positive");
+  rowsInRowGroup = std::min(
+      rowsInRowGroup, arrowContext_->properties->max_row_group_length());
+  auto& writer = *arrowContext_->writer;
+  const int64_t numRows = arrowContext_->stagingRows;
+  for (int64_t offset = 0; offset < numRows; offset += rowsInRowGroup) {
+    const auto size = std::min(rowsInRowGroup, numRows - offset);
+    PARQUET_THROW_NOT_OK(writer.NewRowGroup(size));
+    auto* rowGroup = writer.currentRowGroupWriter();
+    for (auto i = 0; i < schema_->size(); ++i) {
+      vectorColumnWriter_->write(
+          arrowContext_->stagingVectors,
+          i,
+          offset,
+          size,
+          *rowGroup->NextColumn());
+    }
+  }
+}
+
+void Writer::writeVectors(const RowVectorPtr& data) {
+  const int64_t numRows = data->size();
+  if (!enableFlushBasedOnBlockSize_) {
+    if (flushPolicy_->shouldFlush(getStripeProgress(
+            arrowContext_->stagingRows, arrowContext_->stagingBytes))) {
+      flush();
+    }
+    arrowContext_->stagingVectors.push_back(data);
+    arrowContext_->stagingRows += numRows;
+    arrowContext_->stagingBytes += data->estimateFlatSize();
+    return;
+  }
+
+  // Same row group policy as FileWriter::WriteRecordBatch(): keep appending to
+  // the buffered row group until it reaches the maximum number of rows or the
+  // Parquet block size.
+  createFileWriterIfNotExist();
+  auto& writer = *arrowContext_->writer;
+  const auto maxRows = arrowContext_->properties->max_row_group_length();
+  const auto blockSize = arrowContext_->properties->parquet_block_size();
+  auto* rowGroup = writer.currentRowGroupWriter();
+  if (rowGroup == nullptr || !rowGroup->buffered()) {
+    PARQUET_THROW_NOT_OK(writer.NewBufferedRowGroup());
+    rowGroup = writer.currentRowGroupWriter();
+  }
+  const std::vector<RowVectorPtr> batches{data};
+  int64_t offset = 0;
+  while (offset < numRows) {
+    const auto numRowsWritten = rowGroup->num_rows();
+    auto size = std::min(maxRows - numRowsWritten, numRows - offset);
+    if (numRowsWritten > 0) {
+      const auto bytesWritten = rowGroup->total_compressed_bytes_all();
+      const auto bytesPerRow = bytesWritten / numRowsWritten;
+      if (size == 0 ||
+          (blockSize > 0 && bytesWritten + size * bytesPerRow > blockSize)) {
+        PARQUET_THROW_NOT_OK(writer.NewBufferedRowGroup());
+        rowGroup = writer.currentRowGroupWriter();
+        size = std::min(maxRows, numRows - offset);
+      }
+    }
+    for (auto i = 0; i < schema_->size(); ++i) {
+      vectorColumnWriter_->write(
+          batches, i, offset, size, *rowGroup->column(i));
+    }
+    offset += size;
+  }
+  PARQUET_THROW_NOT_OK(stream_->Flush());
+}
+
+bool Writer::supportsVectorColumnWriter() const {
+  ArrowSchema arrowSchema;
+  exportToArrow(
+      BaseVector::create(
+          std::static_pointer_cast<const Type>(schema_), 0, exportPool_.get()),
+      arrowSchema,
+      options_,
+      {},
+      exportPool_.get());
+  auto fileSchema = ::arrow::ImportSchema(&arrowSchema).ValueOrDie();
+  for (auto i = 0; i < schema_->size(); ++i) {
+    if (!VectorColumnWriter::supports(
+            *schema_->childAt(i), *fileSchema->field(i)->type())) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * When enableFlushBasedOnBlockSize_ is enabled, current rowgroup will be
  * flushed after the written compressed size exceeds parquetBlockSize. This
@@ -650,6 +763,16 @@ void Writer::write(const VectorPtr& data) {
         schema_->nameOf(i)));
   }
 
+  if (vectorColumnWriter_) {
+    if (data->size() > 0) {
+      if (!arrowContext_->schema) {
+        arrowContext_->schema = ::arrow::schema(newFields);
+      }
+      writeVectors(std::static_pointer_cast<RowVector>(data));
+    }
+    return;
+  }
+
   if (!enableRowGroupAlignedWrite_ && enableFlushBasedOnBlockSize_) {
     splitWriteRecordBatch(data, ::arrow::schema(newFields));
     return;
@@ -57,6 +57,8 @@ class ArrowDataBufferSink;
 
 struct ArrowContext;
 
+class VectorColumnWriter;
+
 class DefaultFlushPolicy : public dwio::common::FlushPolicy {
  public:
   DefaultFlushPolicy()
@@ -186,6 +188,11 @@ struct WriterOptions {
   std::unordered_map<std::string, int64_t> columnDictionaryPageSizeLimitMap;
   // columnPath to dataPageSize
   std::unordered_map<std::string, int64_t> columnDataPageSizeMap;
+  // columnPath to the options of the n-gram bloom filters written for the
+  // column chunks of a VARCHAR or VARBINARY column. LIKE filters on the
+  // column skip row groups whose filter lacks an n-gram of the pattern.
+  std::unordered_map<std::string, arrow::NGramBloomFilterOptions>
+      columnNGramBloomFilterMap;
   /// Timestamp unit for Parquet write through Arrow bridge.
   /// Default if not specified: TimestampUnit::kNano (9).
   std::optional<TimestampUnit> parquetWriteTimestampUnit;
@@ -204,6 +211,11 @@ struct WriterOptions {
   // and a global static thread pool with this number of threads is created.
   // If 0 or less, threading is disabled (`set_use_threads` is set to false).
   int32_t threadPoolSize = 0;
+  // Encodes the columns straight from the Bolt vectors instead of exporting
+  // them to Arrow first. Only applies when every top-level column is a
+  // supported primitive type and row group aligned writes are disabled;
+  // otherwise the writer falls back to the Arrow path.
+  bool enableVectorColumnWriter = false;
 
   std::shared_ptr<arrow::WriterProperties::Builder> getWriterPropertiesBuilder()
       const;
@@ -232,7 +244,7 @@ class Writer : public dwio::common::Writer {
       const WriterOptions& options,
       RowTypePtr schema);
 
-  ~Writer() override = default;
+  ~Writer() override;
 
   static bool isCodecAvailable(common::CompressionKind compression);
 
@@ -254,6 +266,12 @@ class Writer : public dwio::common::Writer {
 
   void abort() override;
 
+  // True if the columns are written by VectorColumnWriter rather than through
+  // Arrow record batches.
+  bool testingUsesVectorColumnWriter() const {
+    return vectorColumnWriter_ != nullptr;
+  }
+
   // Used in data retention scenario. Write parquet with specific row numbers in
   // each row group.
   void rowGroupAlignedFlush(
@@ -271,6 +289,18 @@ class Writer : public dwio::common::Writer {
 
   void writeRecordBatch(std::shared_ptr<::arrow::RecordBatch>& recordBatch);
 
+  // Returns true if every top-level column of 'schema_' can be written by
+  // VectorColumnWriter.
+  bool supportsVectorColumnWriter() const;
+
+  // Stages 'data' for the next flush, or writes it to the buffered row group
+  // when flushing based on block size. Used instead of the Arrow path when
+  // 'vectorColumnWriter_' is set.
+  void writeVectors(const RowVectorPtr& data);
+
+  // Writes the staged vectors in row groups of at most 'rowsInRowGroup' rows.
+  void flushVectors(int64_t rowsInRowGroup);
+
   void createFileWriterIfNotExist();
 
   void createEmptyFile();
@@ -290,6 +320,9 @@ class Writer : public dwio::common::Writer {
 
   std::shared_ptr<ArrowContext> arrowContext_;
 
+  // Set if the columns are encoded directly from the Bolt vectors.
+  std::unique_ptr<VectorColumnWriter> vectorColumnWriter_;
+
   std::unique_ptr<DefaultFlushPolicy> flushPolicy_;
 
   const RowTypePtr schema_;
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/exec/BatchSizeController.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "bolt/common/base/Exceptions.h"
+#include "bolt/common/memory/Memory.h"
+#include "bolt/common/time/Timer.h"
+namespace bytedance::bolt::exec {
+namespace {
+
+uint32_t toRows(double rows) {
+  constexpr double kMaxRows = std::numeric_limits<vector_size_t>::max();
+  return std::clamp(rows, 1.0, kMaxRows);
+}
+
+} // namespace
+
+// static
+std::unique_ptr<BatchSizeController> BatchSizeController::create(
+    const core::QueryCtx& queryCtx) {
+  const auto& config = queryCtx.queryConfig();
+  if (!config.adaptiveOutputBatchSizing()) {
+    return nullptr;
+  }
+  Options options;
+  options.preferredBatchBytes = config.preferredOutputBatchBytes();
+  options.preferredBatchRows = config.preferredOutputBatchRows();
+  options.maxBatchRows = config.maxOutputBatchRows();
+  options.maxScale = config.adaptiveOutputBatchMaxScale();
+  options.minScale = 1 / options.maxScale;
+  return std::make_unique<BatchSizeController>(
+      options, queryCtx.pool(), memory::memoryManager()->arbitrator());
+}
+
+BatchSizeController::BatchSizeController(
+    const Options& options,
+    memory::MemoryPool* pool,
+    memory::MemoryArbitrator* arbitrator)
+    : options_(options),
+      root_(pool->root()),
+      arbitrator_(arbitrator),
+      maxBatchBytes_(std::numeric_limits<uint64_t>::max()) {
+  BOLT_CHECK_GT(options_.minScale, 0);
+  BOLT_CHECK_LE(options_.minScale, 1);
+  BOLT_CHECK_GE(options_.maxScale, 1);
+  BOLT_CHECK_LT(options_.growUsage, options_.shrinkUsage);
+}
+
+uint32_t BatchSizeController::outputBatchRows(
+    std::optional<uint64_t> rowSize) {
+  maybeUpdate();
+  const double scale = scale_;
+  if (!rowSize.has_value()) {
+    return toRows(options_.preferredBatchRows * scale);
+  }
+  const auto maxRows = toRows(options_.maxBatchRows * scale);
+  if (rowSize.value() == 0) {
+    return maxRows;
+  }
+  const auto batchBytes = std::min<double>(
+      options_.preferredBatchBytes * scale, maxBatchBytes_.load());
+  return std::min(maxRows, toRows(batchBytes / rowSize.value()));
+}
+
+void BatchSizeController::maybeUpdate() {
+  if (getCurrentTimeMs() < nextUpdateMs_) {
+    return;
+  }
+  // Drivers that find an update in progress go on with the current scale.
+  std::unique_lock<std::mutex> l(mutex_, std::try_to_lock);
+  if (l.owns_lock()) {
+    updateLocked();
+  }
+}
+
+void BatchSizeController::update() {
+  std::lock_guard<std::mutex> l(mutex_);
+  updateLocked();
+}
+
+int64_t BatchSizeController::memoryLimit() const {
+  const int64_t capacity = root_->capacity();
+  if (arbitrator_ == nullptr) {
+    return capacity;
+  }
+  // The query can grow up to its max capacity as far as the arbitrator has
+  // free capacity left.
+  const int64_t maxCapacity = root_->maxCapacity();
+  const uint64_t freeCapacity = arbitrator_->stats().freeCapacityBytes;
+  if (freeCapacity < maxCapacity - capacity) {
+    return capacity + freeCapacity;
+  }
+  return maxCapacity;
+}
+
+double BatchSizeController::memoryUsage() const {
+  const auto limit = memoryLimit();
+  if (limit <= 0) {
+    return 1;
+  }
+  return std::min(1.0, static_cast<double>(root_->reservedBytes()) / limit);
+}
+
+BatchSizeController::Stats BatchSizeController::stats() const {
+  std::lock_guard<std::mutex> l(mutex_);
+  return stats_;
+}
+
+void BatchSizeController::updateLocked() {
+  nextUpdateMs_ = getCurrentTimeMs() + options_.updateIntervalMs;
+  const auto limit = memoryLimit();
+  const auto reserved = root_->reservedBytes();
+  const double usage =
+      limit <= 0 ? 1 : std::min(1.0, static_cast<double>(reserved) / limit);
+  double scale = scale_;
+  if (usage > options_.shrinkUsage && scale > options_.minScale) {
+    scale = std::max(options_.minScale, scale / 2);
+    ++stats_.numShrinks;
+  } else if (usage < options_.growUsage && scale < options_.maxScale) {
+    scale = std::min(options_.maxScale, scale * 2);
+    ++stats_.numGrows;
+  }
+  scale_ = scale;
+
+  if (limit == memory::kMaxMemory) {
+    maxBatchBytes_ = std::numeric_limits<uint64_t>::max();
+  } else {
+    const auto headroom = std::max<int64_t>(0, limit - reserved);
+    maxBatchBytes_ = headroom * options_.maxHeadroomFraction;
+  }
+}
+
+} // namespace bytedance::bolt::exec
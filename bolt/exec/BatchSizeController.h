@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "bolt/common/memory/MemoryArbitrator.h"
+#include "bolt/common/memory/MemoryPool.h"
+#include "bolt/core/QueryCtx.h"
+#include "bolt/vector/TypeAliases.h"
+namespace bytedance::bolt::exec {
+
+/// Scales the output batch sizes of the operators of a task with the memory
+/// headroom of the query. Batches grow past the configured preferred sizes
+/// while the query uses little of the memory it may get, and shrink while it
+/// is close to its limit, so that large intermediate batches do not push the
+/// query into spilling. Thread-safe; shared by all drivers of a task.
+class BatchSizeController {
+ public:
+  struct Options {
+    /// The configured sizes the scale factor is applied to.
+    uint64_t preferredBatchBytes{10UL << 20};
+    uint32_t preferredBatchRows{1'024};
+    uint32_t maxBatchRows{10'000};
+
+    /// Bounds of the scale factor.
+    double minScale{1.0 / 8};
+    double maxScale{4};
+
+    /// The scale factor halves when the query uses more than 'shrinkUsage' of
+    /// the memory available to it and doubles when it uses less than
+    /// 'growUsage'.
+    double shrinkUsage{0.8};
+    double growUsage{0.5};
+
+    /// A batch never takes more than this fraction of the free memory of the
+    /// query.
+    double maxHeadroomFraction{1.0 / 16};
+
+    /// Minimum time between two adjustments of the scale factor.
+    uint64_t updateIntervalMs{100};
+  };
+
+  struct Stats {
+    uint64_t numGrows{0};
+    uint64_t numShrinks{0};
+  };
+
+  /// Returns a controller for a task of 'queryCtx', or nullptr if
+  /// 'adaptive_output_batch_sizing' is not set.
+  static std::unique_ptr<BatchSizeController> create(
+      const core::QueryCtx& queryCtx);
+
+  /// 'pool' is any pool of the query; the headroom is taken from its root.
+  /// 'arbitrator' may be null, in which case the query cannot grow beyond
+  /// its current capacity.
+  BatchSizeController(
+      const Options& options,
+      memory::MemoryPool* pool,
+      memory::MemoryArbitrator* arbitrator);
+
+  /// Returns the number of rows per output batch for rows of 'rowSize'
+  /// bytes, or the scaled preferred number of rows if 'rowSize' is not
+  /// known. Re-evaluates the headroom at most once per update interval.
+  uint32_t outputBatchRows(std::optional<uint64_t> rowSize);
+
+  /// Re-evaluates the headroom and adjusts the scale factor immediately.
+  void update();
+
+  double scale() const {
+    return scale_;
+  }
+
+  /// Returns the fraction of the memory available to the query that it has
+  /// reserved.
+  double memoryUsage() const;
+
+  Stats stats() const;
+
+ private:
+  void maybeUpdate();
+
+  void updateLocked();
+
+  // Returns the most memory the query can reserve now: its capacity plus
+  // what the arbitrator could still grant it.
+  int64_t memoryLimit() const;
+
+  const Options options_;
+  memory::MemoryPool* const root_;
+  memory::MemoryArbitrator* const arbitrator_;
+
+  std::atomic<double> scale_{1};
+  // Largest batch in bytes given the free memory of the query.
+  std::atomic<uint64_t> maxBatchBytes_;
+  std::atomic<uint64_t> nextUpdateMs_{0};
+
+  // Serializes updates. Readers of the atomics above never wait for it.
+  mutable std::mutex mutex_;
+  Stats stats_;
+};
+
+} // namespace bytedance::bolt::exec
@@ -36,6 +36,7 @@
 #include "bolt/common/base/Counters.h"
 #include "bolt/common/base/StatsReporter.h"
 #include "bolt/common/base/logging.h"
+#include "bolt/common/memory/NumaTopology.h"
 #include "bolt/common/process/ThreadNameHolder.h"
 #include "bolt/common/process/TraceContext.h"
 #include "bolt/common/testutil/TestValue.h"
@@ -310,6 +311,7 @@ void Driver::init(
   operators_ = std::move(operators);
   curOperatorId_ = operators_.size() - 1;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  trackOperatorPerfCounters_ = ctx_->queryConfig().operatorTrackPerfCounters();
 }
 
 void Driver::initializeOperators() {
@@ -685,11 +687,14 @@ StopReason Driver::runInternal(
             withDeltaCpuWallTimer(op, &OperatorStats::getOutputTiming, [&]() {
               TestValue::adjust(
                   "bytedance::bolt::exec::Driver::runInternal::getOutput", op);
-              CALL_OPERATOR(
-                  intermediateResult = op->getOutput(),
-                  op,
-                  curOperatorId_,
-                  kOpMethodGetOutput);
+              {
+                auto perfCounter = createDeltaPerfEventCounter(op);
+                CALL_OPERATOR(
+                    intermediateResult = op->getOutput(),
+                    op,
+                    curOperatorId_,
+                    kOpMethodGetOutput);
+              }
               if (intermediateResult) {
                 BOLT_CHECK(
                     intermediateResult->size() > 0,
@@ -725,6 +730,7 @@ StopReason Driver::runInternal(
                   "bytedance::bolt::exec::Driver::runInternal::addInput",
                   nextOp);
 
+              auto perfCounter = createDeltaPerfEventCounter(nextOp);
               CALL_OPERATOR(
                   nextOp->addInput(intermediateResult),
                   nextOp,
@@ -780,6 +786,7 @@ StopReason Driver::runInternal(
                 TestValue::adjust(
                     "bytedance::bolt::exec::Driver::runInternal::noMoreInput",
                     nextOp);
+                auto perfCounter = createDeltaPerfEventCounter(nextOp);
                 CALL_OPERATOR(
                     nextOp->noMoreInput(),
                     nextOp,
@@ -802,6 +809,7 @@ StopReason Driver::runInternal(
                   auto selfDelta = processLazyTiming(*op, timing);
                   op->stats().wlock()->getOutputTiming.add(selfDelta);
                 });
+            auto perfCounter = createDeltaPerfEventCounter(op);
             CALL_OPERATOR(
                 result = op->getOutput(),
                 op,
@@ -872,7 +880,19 @@ void Driver::recordYieldCount() {
   RECORD_METRIC_VALUE(kMetricDriverYieldCount);
 }
 
-// static
+void Driver::pinToNumaNode() {
+  const auto& topology = memory::NumaTopology::get();
+  if (!ctx_->queryConfig().numaDriverPinning() || topology->numNodes() < 2) {
+    memory::NumaThreadPin::unpin();
+    return;
+  }
+  if (numaNode_ < 0) {
+    numaNode_ = std::hash<std::string>{}(ctx_->task->taskId()) %
+        topology->numNodes();
+  }
+  memory::NumaThreadPin::pin(*topology, numaNode_);
+}
+
 void Driver::run(std::shared_ptr<Driver> self) {
 #ifndef SPARK_COMPATIBLE
   process::ThreadNameHolder holder(self->driverCtx()->task->taskId());
@@ -883,6 +903,7 @@ void Driver::run(std::shared_ptr<Driver> self) {
   ScopedDriverThreadContext scopedDriverThreadContext(self->driverCtx());
   std::shared_ptr<BlockingState> blockingState;
   RowVectorPtr nullResult;
+  self->pinToNumaNode();
   auto reason = self->runInternal(self, blockingState, nullResult);
 
   // When Driver runs on an executor, the last operator (sink) must not produce
@@ -1135,6 +1156,21 @@ folly::dynamic Driver::toJson() const {
   return obj;
 }
 
+// static
+void Driver::addPerfEventCounts(
+    Operator& op,
+    const process::PerfEventCounts& counts) {
+  auto lockedStats = op.stats().wlock();
+  for (auto i = 0; i < process::kNumPerfEvents; ++i) {
+    const auto event = static_cast<process::PerfEvent>(i);
+    if (counts.counted(event)) {
+      lockedStats->addRuntimeStat(
+          std::string(process::perfEventMetricName(event)),
+          RuntimeCounter(static_cast<int64_t>(counts.count(event))));
+    }
+  }
+}
+
 template <typename Func>
 void Driver::withDeltaCpuWallTimer(
     Operator* op,
@@ -36,6 +36,7 @@
 
 #include <folly/Random.h>
 #include "bolt/common/future/BoltPromise.h"
+#include "bolt/common/process/PerfCounters.h"
 #include "bolt/common/process/ThreadDebugInfo.h"
 #include "bolt/common/time/CpuWallTimer.h"
 #include "bolt/connectors/Connector.h"
@@ -532,6 +533,30 @@ class Driver : public std::enable_shared_from_this<Driver> {
         : nullptr;
   }
 
+  // If 'trackOperatorPerfCounters_' is true, returns an object that adds the
+  // hardware events counted on this thread until its destruction to the
+  // runtime stats of 'op'. Returns null otherwise.
+  auto createDeltaPerfEventCounter(Operator* op) {
+    auto addCounts = [op](const process::PerfEventCounts& counts) {
+      addPerfEventCounts(*op, counts);
+    };
+    using Counter = process::DeltaPerfEventCounter<decltype(addCounts)>;
+    return trackOperatorPerfCounters_
+        ? std::make_unique<Counter>(std::move(addCounts))
+        : nullptr;
+  }
+
+  static void addPerfEventCounts(
+      Operator& op,
+      const process::PerfEventCounts& counts);
+
+  // Pins the calling thread to the NUMA node of the task of 'this' if
+  // numa_driver_pinning is set and otherwise gives the thread back the CPUs
+  // it had before it was pinned. The pinning stays after the driver goes off
+  // thread, so a thread that keeps running drivers of one node is pinned
+  // once.
+  void pinToNumaNode();
+
   std::unique_ptr<DriverCtx> ctx_;
 
   // If not zero, specifies the driver cpu time slice.
@@ -560,6 +585,13 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   bool trackOperatorCpuUsage_;
 
+  bool trackOperatorPerfCounters_{false};
+
+  // NUMA node the driver runs on with numa_driver_pinning. Picked by task id
+  // on the first run, so all drivers of a task share a node. -1 if not
+  // assigned.
+  int32_t numaNode_{-1};
+
   // Indicates that a DriverAdapter can rearrange Operators. Set to false at end
   // of DriverFactory::createDriver().
   bool isAdaptable_{true};
@@ -378,6 +378,22 @@ RowVectorPtr GeneratorJsonTuple::getOutput() {
   initializeResults(keyOffset);
   decodedKeyColumn();
 
+  // Paths of constant keys are built once per batch. Column keys are copied
+  // into 'colKeys' since a decoded StringView may inline its data.
+  std::vector<int32_t> offsets;
+  std::vector<folly::Optional<folly::StringPiece>> paths;
+  offsets.reserve(constKeyMap_.size() + colKeyMap_.size());
+  paths.reserve(constKeyMap_.size() + colKeyMap_.size());
+  for (auto i = 0; i < constKeyMap_.size(); ++i) {
+    paths.emplace_back(jsonKeys_[constKeyMap_[i]]);
+    offsets.emplace_back(constKeyMap_[i]);
+  }
+  for (auto i = 0; i < colKeyMap_.size(); ++i) {
+    paths.emplace_back(folly::none);
+    offsets.emplace_back(colKeyMap_[i]);
+  }
+  std::vector<std::string> colKeys(colKeyMap_.size());
+
   for (auto row = 0; row < size; ++row) {
     if (currentDecoded.isNullAt(row)) { // json str is null
       // constant keys
@@ -390,19 +406,14 @@ RowVectorPtr GeneratorJsonTuple::getOutput() {
     } else {
       auto jsonStr = currentDecoded.valueAt<StringView>(row);
 
-      std::vector<int32_t> offsets;
-      std::vector<folly::Optional<folly::StringPiece>> paths;
-      for (auto i = 0; i < constKeyMap_.size(); ++i) {
-        paths.emplace_back(jsonKeys_[constKeyMap_[i]]);
-        offsets.emplace_back(constKeyMap_[i]);
-      }
       for (auto i = 0; i < colKeyMap_.size(); ++i) {
-        offsets.emplace_back(colKeyMap_[i]);
+        auto& path = paths[constKeyMap_.size() + i];
         if (keyDecoded_[i].isNullAt(row)) {
-          paths.emplace_back(folly::none);
+          path = folly::none;
         } else {
           auto key = keyDecoded_[i].valueAt<StringView>(row);
-          paths.emplace_back(key.getString());
+          colKeys[i].assign(key.data(), key.size());
+          path = folly::StringPiece(colKeys[i]);
         }
       }
       auto vals = bytedance::bolt::functions::jsonExtractTuple(
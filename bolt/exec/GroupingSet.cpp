@@ -606,6 +606,24 @@ void GroupingSet::addGlobalAggregationInput(
   }
 }
 
+void GroupingSet::addGlobalIntermediateResults(
+    const std::vector<VectorPtr>& intermediates) {
+  BOLT_CHECK(isGlobal_);
+  BOLT_CHECK_EQ(intermediates.size(), aggregates_.size());
+  initializeGlobalAggregation();
+
+  auto* group = lookup_->hits[0];
+  const SelectivityVector rows(1);
+  for (auto i = 0; i < aggregates_.size(); ++i) {
+    BOLT_CHECK(
+        !aggregates_[i].distinct && aggregates_[i].sortingKeys.empty(),
+        "Intermediate results of distinct or sorted aggregates are not supported");
+    BOLT_CHECK_EQ(intermediates[i]->size(), 1);
+    aggregates_[i].function->addSingleGroupIntermediateResults(
+        group, rows, {intermediates[i]}, false);
+  }
+}
+
 bool GroupingSet::getGlobalAggregationOutput(
     RowContainerIterator& iterator,
     RowVectorPtr& result) {
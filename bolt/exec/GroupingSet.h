@@ -68,6 +68,12 @@ class GroupingSet {
 
   void addInput(const RowVectorPtr& input, bool mayPushdown);
 
+  /// Adds partial results computed outside of 'this', e.g. from file
+  /// metadata, to a global aggregation. 'intermediates[i]' is a single row
+  /// vector of the intermediate type of aggregate i.
+  void addGlobalIntermediateResults(
+      const std::vector<VectorPtr>& intermediates);
+
   void noMoreInput();
 
   void putDistinctNewGroupsIndices(int64_t offset) {
@@ -39,9 +39,53 @@
 #include "bolt/exec/Operator.h"
 #include "bolt/exec/OperatorUtils.h"
 #include "bolt/exec/SortedAggregations.h"
+#include "bolt/exec/TableScan.h"
 #include "bolt/exec/Task.h"
 #include "bolt/expression/Expr.h"
 namespace bytedance::bolt::exec {
+namespace {
+
+// Returns how a table scan can answer 'aggregate' named 'name' from file
+// metadata, or std::nullopt if it cannot.
+std::optional<connector::MetadataAggregate> toMetadataAggregate(
+    const std::string& name,
+    const AggregateInfo& aggregate,
+    const RowTypePtr& inputType) {
+  using Kind = connector::MetadataAggregate::Kind;
+  if (aggregate.mask.has_value() || aggregate.distinct ||
+      !aggregate.sortingKeys.empty()) {
+    return std::nullopt;
+  }
+  if (name == "count") {
+    if (aggregate.intermediateType->kind() != TypeKind::BIGINT ||
+        aggregate.inputs.size() > 1) {
+      return std::nullopt;
+    }
+    if (aggregate.inputs.empty()) {
+      return connector::MetadataAggregate{Kind::kCount, std::nullopt};
+    }
+    if (const auto& constant = aggregate.constantInputs[0]) {
+      // count(<constant>) counts all rows unless the constant is null.
+      if (constant->isNullAt(0)) {
+        return std::nullopt;
+      }
+      return connector::MetadataAggregate{Kind::kCount, std::nullopt};
+    }
+    return connector::MetadataAggregate{Kind::kCount, aggregate.inputs[0]};
+  }
+  if (name == "min" || name == "max") {
+    if (aggregate.inputs.size() != 1 || aggregate.constantInputs[0] ||
+        !aggregate.intermediateType->equivalent(
+            *inputType->childAt(aggregate.inputs[0]))) {
+      return std::nullopt;
+    }
+    return connector::MetadataAggregate{
+        name == "min" ? Kind::kMin : Kind::kMax, aggregate.inputs[0]};
+  }
+  return std::nullopt;
+}
+
+} // namespace
 
 HashAggregation::HashAggregation(
     int32_t operatorId,
@@ -186,6 +230,63 @@ void HashAggregation::initialize() {
   addRuntimeStat(
       "aggregationOutputCompositeVector",
       RuntimeCounter(supportRowBasedOutput_));
+
+  const auto radixPartitionBits = queryConf.hashAggregationRadixPartitionBits();
+  if (radixPartitionBits > 0 && !isPartialOutput_ && !isGlobal_ &&
+      !isDistinct_ && preGroupedChannels.empty() &&
+      aggregationNode_->globalGroupingSets().empty() &&
+      !acceptCompositeVectorInput_) {
+    std::vector<column_index_t> keyChannels;
+    keyChannels.reserve(numHashers);
+    for (const auto& hasher : hashers) {
+      keyChannels.push_back(hasher->channel());
+    }
+    const uint8_t startBit = spillConfig_.has_value()
+        ? spillConfig_->startPartitionBit
+        : queryConf.spillStartPartitionBit();
+    const uint8_t endBit = std::min<int32_t>(startBit + radixPartitionBits, 64);
+    if (endBit > startBit) {
+      radixGroupingSet_ = std::make_unique<RadixPartitionedGroupingSet>(
+          inputType,
+          keyChannels,
+          HashBitRange(startBit, endBit),
+          spillConfig_.has_value() ? &spillConfig_.value() : nullptr,
+          [&](const common::SpillConfig* partitionSpillConfig) {
+            std::shared_ptr<core::ExpressionEvaluator> evaluator;
+            auto groupingSet = std::make_unique<GroupingSet>(
+                inputType,
+                createVectorHashers(
+                    inputType, aggregationNode_->groupingKeys()),
+                std::vector<column_index_t>{},
+                toAggregateInfo(
+                    *aggregationNode_, *operatorCtx_, numHashers, evaluator),
+                aggregationNode_->ignoreNullKeys(),
+                isPartialOutput_,
+                isRawInput(aggregationNode_->step()),
+                aggregationNode_->globalGroupingSets(),
+                groupIdChannel,
+                partitionSpillConfig,
+                &nonReclaimableSection_,
+                operatorCtx_.get());
+            groupingSet->setSupportUniqueRowOptimization(
+                queryConf.isUniqueRowOptimizationEnabled());
+            return groupingSet;
+          },
+          pool());
+      addRuntimeStat(
+          "radixPartitions",
+          RuntimeCounter(radixGroupingSet_->numPartitions()));
+      LOG(INFO) << name() << " initialized with "
+                << radixGroupingSet_->numPartitions()
+                << " radix partitions, outputType_ = "
+                << outputType_->toString();
+      aggregationNode_.reset();
+      return;
+    }
+  }
+
+  maybePushdownMetadataAggregates(aggregateInfos);
+
   groupingSet_ = std::make_unique<GroupingSet>(
       inputType,
       std::move(hashers),
@@ -229,6 +330,62 @@ void HashAggregation::initialize() {
   aggregationNode_.reset();
 }
 
+void HashAggregation::maybePushdownMetadataAggregates(
+    const std::vector<AggregateInfo>& aggregateInfos) {
+  if (!isGlobal_ || !isRawInput(aggregationNode_->step()) ||
+      aggregateInfos.empty() ||
+      !operatorCtx_->driverCtx()
+           ->queryConfig()
+           .aggregationMetadataPushdown()) {
+    return;
+  }
+  // Only a scan that feeds 'this' directly sees the same rows.
+  auto* driver = operatorCtx_->driver();
+  if (driver->findOperatorNoThrow(1) != this) {
+    return;
+  }
+  auto* tableScan = dynamic_cast<TableScan*>(driver->findOperator(0));
+  if (tableScan == nullptr) {
+    return;
+  }
+
+  const auto& inputType = aggregationNode_->sources()[0]->outputType();
+  std::vector<connector::MetadataAggregate> aggregates;
+  std::vector<TypePtr> intermediateTypes;
+  for (auto i = 0; i < aggregateInfos.size(); ++i) {
+    // Strip the prefix the function is registered with, if any.
+    const auto& name = aggregationNode_->aggregates()[i].call->name();
+    auto aggregate = toMetadataAggregate(
+        name.substr(name.rfind('.') + 1), aggregateInfos[i], inputType);
+    if (!aggregate.has_value()) {
+      return;
+    }
+    aggregates.push_back(aggregate.value());
+    intermediateTypes.push_back(aggregateInfos[i].intermediateType);
+  }
+  tableScan->pushdownMetadataAggregates(std::move(aggregates));
+  metadataAggregationSource_ = tableScan;
+  metadataIntermediateTypes_ = std::move(intermediateTypes);
+}
+
+void HashAggregation::addMetadataAggregates() {
+  if (metadataAggregationSource_ == nullptr) {
+    return;
+  }
+  const auto values = metadataAggregationSource_->takeMetadataAggregates();
+  if (values.empty()) {
+    return;
+  }
+  BOLT_CHECK_EQ(values.size(), metadataIntermediateTypes_.size());
+  std::vector<VectorPtr> intermediates;
+  intermediates.reserve(values.size());
+  for (auto i = 0; i < values.size(); ++i) {
+    intermediates.push_back(BaseVector::createConstant(
+        metadataIntermediateTypes_[i], values[i], 1, pool()));
+  }
+  groupingSet_->addGlobalIntermediateResults(intermediates);
+}
+
 bool HashAggregation::abandonPartialAggregationEarly(int64_t numOutput) const {
   BOLT_CHECK(isPartialOutput_ && !isGlobal_);
   if (groupingSet_->hasSpilled()) {
@@ -293,6 +450,12 @@ void HashAggregation::addInput(RowVectorPtr input) {
       input = convertedInput_;
     }
   }
+  if (radixGroupingSet_ != nullptr) {
+    radixGroupingSet_->addInput(input, mayPushdown_);
+    numInputRows_ += input->size();
+    updateRuntimeStats();
+    return;
+  }
   // Reset tracking between batches to prevent memory buildup
   groupingSet_->resetDistinctNewGroups();
   if (input->size() > maxInputBatchCount_) {
@@ -353,22 +516,30 @@ void HashAggregation::addInput(RowVectorPtr input) {
 }
 
 void HashAggregation::updateRuntimeStats() {
-  // Report range sizes and number of distinct values for the group-by keys.
-  const auto& hashers = groupingSet_->hashLookup().hashers;
-  uint64_t asRange;
-  uint64_t asDistinct;
-  const auto hashTableStats = groupingSet_->hashTableStats();
+  const auto hashTableStats = radixGroupingSet_ != nullptr
+      ? radixGroupingSet_->hashTableStats()
+      : groupingSet_->hashTableStats();
 
   auto lockedStats = stats_.wlock();
   auto& runtimeStats = lockedStats->runtimeStats;
 
-  for (auto i = 0; i < hashers.size(); i++) {
-    hashers[i]->cardinality(0, asRange, asDistinct);
-    if (asRange != VectorHasher::kRangeTooLarge) {
-      runtimeStats[fmt::format("rangeKey{}", i)] = RuntimeMetric(asRange);
-    }
-    if (asDistinct != VectorHasher::kRangeTooLarge) {
-      runtimeStats[fmt::format("distinctKey{}", i)] = RuntimeMetric(asDistinct);
+  if (radixGroupingSet_ != nullptr) {
+    runtimeStats["radixSpilledPartitions"] =
+        RuntimeMetric(radixGroupingSet_->numSpilledPartitions());
+  } else {
+    // Report range sizes and number of distinct values for the group-by keys.
+    const auto& hashers = groupingSet_->hashLookup().hashers;
+    uint64_t asRange;
+    uint64_t asDistinct;
+    for (auto i = 0; i < hashers.size(); i++) {
+      hashers[i]->cardinality(0, asRange, asDistinct);
+      if (asRange != VectorHasher::kRangeTooLarge) {
+        runtimeStats[fmt::format("rangeKey{}", i)] = RuntimeMetric(asRange);
+      }
+      if (asDistinct != VectorHasher::kRangeTooLarge) {
+        runtimeStats[fmt::format("distinctKey{}", i)] =
+            RuntimeMetric(asDistinct);
+      }
     }
   }
 
@@ -382,20 +553,42 @@ void HashAggregation::updateRuntimeStats() {
 }
 
 void HashAggregation::recordSpillStats() {
-  auto spillStatsOr = groupingSet_->spilledStats();
+  auto spillStatsOr = radixGroupingSet_ != nullptr
+      ? radixGroupingSet_->newSpilledStats()
+      : groupingSet_->spilledStats();
   if (spillStatsOr.has_value()) {
     Operator::recordSpillStats(spillStatsOr.value());
   }
 }
 
 void HashAggregation::recordSpillReadStats() {
-  auto spillReadStatsOr = groupingSet_->spillReadStats();
+  auto spillReadStatsOr = radixGroupingSet_ != nullptr
+      ? radixGroupingSet_->spillReadStats()
+      : groupingSet_->spillReadStats();
   if (spillReadStatsOr.has_value()) {
     Operator::recordSpillReadStats(spillReadStatsOr.value());
   }
 }
 
 void HashAggregation::recordRuntimeMetrics() {
+  if (radixGroupingSet_ != nullptr) {
+    if (radixGroupingSet_->hasSpilled()) {
+      this->setRuntimeMetric(
+          OperatorMetricKey::kTotalRowCount,
+          folly::to<std::string>(radixGroupingSet_->totalSpillRowCount()));
+      this->setRuntimeMetric(
+          OperatorMetricKey::kHasBeenProcessedRowCount,
+          folly::to<std::string>(radixGroupingSet_->outputSpillRowCount()));
+      return;
+    }
+    this->setRuntimeMetric(
+        OperatorMetricKey::kTotalRowCount,
+        folly::to<std::string>(radixGroupingSet_->numDistinct()));
+    this->setRuntimeMetric(
+        OperatorMetricKey::kHasBeenProcessedRowCount,
+        folly::to<std::string>(numOutputRows_));
+    return;
+  }
   if (groupingSet_ != nullptr && groupingSet_->hasSpilled()) {
     this->setRuntimeMetric(
         OperatorMetricKey::kTotalRowCount,
@@ -571,6 +764,10 @@ RowVectorPtr HashAggregation::getOutput() {
   // - partial aggregation reached memory limit;
   // - distinct aggregation has new keys;
   // - running in partial streaming mode and have some output ready.
+  if (radixGroupingSet_ != nullptr) {
+    return getRadixOutput();
+  }
+
   if (!noMoreInput_ && !partialFull_ && !newDistincts_ &&
       !groupingSet_->hasOutput()) {
     input_ = nullptr;
@@ -647,6 +844,27 @@ RowVectorPtr HashAggregation::getOutput() {
   return output_;
 }
 
+RowVectorPtr HashAggregation::getRadixOutput() {
+  if (!radixGroupingSet_->hasOutput()) {
+    input_ = nullptr;
+    return nullptr;
+  }
+
+  const auto& queryConfig = operatorCtx_->driverCtx()->queryConfig();
+  const auto maxOutputRows = outputBatchRows(estimatedOutputRowSize_);
+  prepareOutput(maxOutputRows, false);
+  if (!radixGroupingSet_->getOutput(
+          maxOutputRows, queryConfig.preferredOutputBatchBytes(), output_)) {
+    finished_ = true;
+    recordSpillReadStats();
+    pool()->release();
+    return nullptr;
+  }
+  numOutputRows_ += output_->size();
+  recordRuntimeMetrics();
+  return output_;
+}
+
 RowVectorPtr HashAggregation::getDistinctOutput() {
   BOLT_CHECK(isDistinct_);
   BOLT_CHECK(!finished_);
@@ -718,8 +936,13 @@ RowVectorPtr HashAggregation::getDistinctOutput() {
 }
 
 void HashAggregation::noMoreInput() {
+  addMetadataAggregates();
   updateEstimatedOutputRowSize();
-  groupingSet_->noMoreInput();
+  if (radixGroupingSet_ != nullptr) {
+    radixGroupingSet_->noMoreInput();
+  } else {
+    groupingSet_->noMoreInput();
+  }
   convertedInput_ = nullptr;
   Operator::noMoreInput();
   recordSpillStats();
@@ -737,7 +960,7 @@ void HashAggregation::reclaim(
   BOLT_CHECK(canReclaim());
   BOLT_CHECK(!nonReclaimableSection_);
 
-  if (groupingSet_ == nullptr) {
+  if (groupingSet_ == nullptr && radixGroupingSet_ == nullptr) {
     return;
   }
 
@@ -748,6 +971,21 @@ void HashAggregation::reclaim(
 
   updateEstimatedOutputRowSize();
 
+  if (radixGroupingSet_ != nullptr) {
+    if (noMoreInput_) {
+      // Spill the unproduced rows of the partitions which haven't spilled yet.
+      radixGroupingSet_->spillRemaining();
+      recordSpillStats();
+    } else {
+      // Partitions spill one at a time, largest first, until 'targetBytes'
+      // have been freed.
+      radixGroupingSet_->spill(targetBytes);
+    }
+    // Release the minimum reserved memory.
+    pool()->release();
+    return;
+  }
+
   if (noMoreInput_) {
     if (groupingSet_->hasSpilled()) {
       LOG(WARNING)
@@ -797,11 +1035,17 @@ void HashAggregation::close() {
     Operator::recordGroupingSetStats(groupingSet_->getRuntimeStats());
     groupingSet_.reset();
   }
+  if (radixGroupingSet_) {
+    Operator::recordGroupingSetStats(radixGroupingSet_->getRuntimeStats());
+    radixGroupingSet_.reset();
+  }
   output_ = nullptr;
 }
 
 void HashAggregation::updateEstimatedOutputRowSize() {
-  const auto optionalRowSize = groupingSet_->estimateOutputRowSize();
+  const auto optionalRowSize = radixGroupingSet_ != nullptr
+      ? radixGroupingSet_->estimateOutputRowSize()
+      : groupingSet_->estimateOutputRowSize();
   if (!optionalRowSize.has_value()) {
     return;
   }
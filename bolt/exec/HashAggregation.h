@@ -32,8 +32,11 @@
 
 #include "bolt/exec/GroupingSet.h"
 #include "bolt/exec/Operator.h"
+#include "bolt/exec/RadixPartitionedGroupingSet.h"
 namespace bytedance::bolt::exec {
 
+class TableScan;
+
 class HashAggregation : public Operator {
  public:
   HashAggregation(
@@ -69,6 +72,15 @@ class HashAggregation : public Operator {
 
   void prepareOutput(vector_size_t size, bool isCompositeOutput);
 
+  // Has the TableScan that feeds 'this' answer the aggregates from file
+  // metadata where it can, if all of them are count, min or max without
+  // masks or sorting.
+  void maybePushdownMetadataAggregates(
+      const std::vector<AggregateInfo>& aggregateInfos);
+
+  // Adds the partial results the TableScan computed from metadata.
+  void addMetadataAggregates();
+
   // Invoked to reset partial aggregation state if it was full and has been
   // flushed.
   void resetPartialOutputIfNeed();
@@ -89,6 +101,9 @@ class HashAggregation : public Operator {
 
   RowVectorPtr getDistinctOutput();
 
+  // Produces the output of 'radixGroupingSet_' one partition after another.
+  RowVectorPtr getRadixOutput();
+
   // Invoked to record the spilling stats in operator stats after processing all
   // the inputs.
   void recordSpillStats();
@@ -126,6 +141,10 @@ class HashAggregation : public Operator {
   int64_t maxPartialAggregationMemoryUsage_;
   std::unique_ptr<GroupingSet> groupingSet_;
 
+  // Set instead of 'groupingSet_' if the final aggregation is radix
+  // partitioned by 'kHashAggregationRadixPartitionBits'.
+  std::unique_ptr<RadixPartitionedGroupingSet> radixGroupingSet_;
+
   // Size of a single output row estimated using
   // 'groupingSet_->estimateRowSize()'. If spilling, this value is set to max
   // 'groupingSet_->estimateRowSize()' across all accumulated data set.
@@ -147,6 +166,11 @@ class HashAggregation : public Operator {
   bool pushdownChecked_ = false;
   bool mayPushdown_ = false;
 
+  // The TableScan the aggregates were pushed into, if any, and the
+  // intermediate types of its results.
+  TableScan* metadataAggregationSource_{nullptr};
+  std::vector<TypePtr> metadataIntermediateTypes_;
+
   // Count the number of input rows. It is reset on partial aggregation output
   // flush.
   int64_t numInputRows_ = 0;
@@ -1072,6 +1072,12 @@ bool HashBuild::finishHashBuild() {
       dropDuplicates_,
       isInputFromSpill() ? spillConfig()->startPartitionBit
                          : BaseHashTable::kNoSpillInputStartPartitionBit);
+  const auto compactTableMaxBytes =
+      operatorCtx_->driverCtx()->queryConfig().hashJoinCompactTableMaxBytes();
+  if (compactTableMaxBytes > 0 &&
+      table_->compactJoinTable(compactTableMaxBytes)) {
+    addRuntimeStat("compactJoinTable", RuntimeCounter(1));
+  }
   addRuntimeStats();
 
   // [Morsel-driven] early capture empty hashtable and stop build side
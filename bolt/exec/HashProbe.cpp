@@ -40,6 +40,7 @@
 #include "bolt/exec/Task.h"
 #include "bolt/expression/FieldReference.h"
 #include "bolt/vector/BaseVector.h"
+#include "bolt/vector/LazyVector.h"
 namespace bytedance::bolt::exec {
 
 namespace {
@@ -103,6 +104,59 @@ void extractColumns(
   }
 }
 
+// Loads a build side column for the rows of a HashProbe output batch. Holds
+// the matched build rows of the batch, shared with the loaders of the other
+// build side columns, and the table to keep the rows alive until loaded. A
+// null row loads as null.
+class TableRowsLoader : public VectorLoader {
+ public:
+  TableRowsLoader(
+      std::shared_ptr<BaseHashTable> table,
+      BufferPtr tableRows,
+      column_index_t column,
+      TypePtr type,
+      memory::MemoryPool* pool)
+      : table_(std::move(table)),
+        tableRows_(std::move(tableRows)),
+        column_(column),
+        type_(std::move(type)),
+        pool_(pool) {}
+
+ protected:
+  void loadInternal(
+      RowSet rows,
+      ValueHook* hook,
+      vector_size_t resultSize,
+      VectorPtr* result) override {
+    // Aggregations are only pushed down through filters, see
+    // Driver::mayPushdownAggregation(), so these loads never get a hook.
+    BOLT_CHECK_NULL(hook);
+    const auto* tableRows = tableRows_->as<char*>();
+
+    // Rows outside 'rows' are left null so that only the loaded rows are
+    // copied out of the table.
+    std::vector<char*> loadedRows(resultSize, nullptr);
+    for (auto row : rows) {
+      loadedRows[row] = tableRows[row];
+    }
+    auto& vector = *result;
+    if (!vector || !BaseVector::isVectorWritable(vector) ||
+        !vector->isFlatEncoding()) {
+      vector = BaseVector::create(type_, resultSize, pool_);
+    }
+    vector->resize(resultSize);
+    table_->rows()->extractColumn(
+        loadedRows.data(), resultSize, column_, vector);
+  }
+
+ private:
+  const std::shared_ptr<BaseHashTable> table_;
+  const BufferPtr tableRows_;
+  const column_index_t column_;
+  const TypePtr type_;
+  memory::MemoryPool* const pool_;
+};
+
 BlockingReason fromStateToBlockingReason(ProbeOperatorState state) {
   switch (state) {
     case ProbeOperatorState::kRunning:
@@ -211,6 +265,11 @@ void HashProbe::initialize() {
     isIdentityProjection_ = true;
   }
 
+  lateMaterialization_ = !tableOutputProjections_.empty() && !spillEnabled() &&
+      operatorCtx_->driverCtx()
+          ->queryConfig()
+          .hashJoinLateMaterializationEnabled();
+
   if (nullAware_) {
     filterTableResult_.resize(1);
   }
@@ -661,6 +720,10 @@ void HashProbe::addInput(RowVectorPtr input) {
   }
   input_ = std::move(input);
 
+  if (operatorCtx_->task()->batchSizeController() != nullptr) {
+    outputBatchSize_ = outputBatchRows();
+  }
+
   // Reset passingInputRowsInitialized_ as input_ as changed.
   passingInputRowsInitialized_ = false;
 
@@ -778,6 +841,13 @@ void HashProbe::prepareOutput(vector_size_t size) {
   // clearProjectedOutput(). BaseVector::prepareForReuse keeps null
   // children unmodified and makes non-null (build side) children reusable.
   if (output_) {
+    if (lateMaterialization_) {
+      // Lazy build-side children are not reusable, so they are dropped rather
+      // than replaced with new flat vectors.
+      for (auto projection : tableOutputProjections_) {
+        output_->childAt(projection.outputChannel) = nullptr;
+      }
+    }
     VectorPtr output = std::move(output_);
     BaseVector::prepareForReuse(output, size);
     output_ = std::static_pointer_cast<RowVector>(output);
@@ -866,6 +936,8 @@ void HashProbe::fillOutput(vector_size_t size) {
 
   if (isLeftSemiProjectJoin(joinType_)) {
     fillLeftSemiProjectMatchColumn(size);
+  } else if (lateMaterialization_) {
+    fillLazyTableOutput(size);
   } else {
     bool wrapInDictionary = false;
     std::map<int64_t, int16_t> addrToIndex;
@@ -912,6 +984,23 @@ void HashProbe::fillOutput(vector_size_t size) {
   }
 }
 
+void HashProbe::fillLazyTableOutput(vector_size_t size) {
+  auto tableRows = AlignedBuffer::allocate<char*>(size, pool());
+  std::copy(
+      outputTableRows_.begin(),
+      outputTableRows_.begin() + size,
+      tableRows->asMutable<char*>());
+  for (auto projection : tableOutputProjections_) {
+    const auto& type = outputType_->childAt(projection.outputChannel);
+    output_->childAt(projection.outputChannel) = std::make_shared<LazyVector>(
+        pool(),
+        type,
+        size,
+        std::make_unique<TableRowsLoader>(
+            table_, tableRows, projection.inputChannel, type, pool()));
+  }
+}
+
 bool HashProbe::canWrapInDictionary(
     vector_size_t size,
     std::map<int64_t, int16_t>& uniqueMap) const {
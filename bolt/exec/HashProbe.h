@@ -126,6 +126,10 @@ class HashProbe : public Operator {
   // Populate output columns.
   void fillOutput(vector_size_t size);
 
+  // Sets the build side columns of 'output_' to lazy vectors over the first
+  // 'size' rows of 'outputTableRows_'.
+  void fillLazyTableOutput(vector_size_t size);
+
   // Populate 'match' output column for the left semi join project,
   void fillLeftSemiProjectMatchColumn(vector_size_t size);
 
@@ -271,7 +275,8 @@ class HashProbe : public Operator {
 
   void resetHashTable();
   // TODO: Define batch size as bytes based on RowContainer row sizes.
-  const uint32_t outputBatchSize_;
+  // Refreshed for each input batch with 'adaptive_output_batch_sizing'.
+  uint32_t outputBatchSize_;
 
   const std::shared_ptr<const core::HashJoinNode> joinNode_;
 
@@ -650,6 +655,11 @@ class HashProbe : public Operator {
 
   bool hitSampling_{false};
 
+  // True if the build side columns are output as lazy vectors. Not set when
+  // spilling is enabled as spilling clears or replaces the table that the
+  // unloaded vectors read.
+  bool lateMaterialization_{false};
+
   // for skew partition in HashBuild
   bool needLastProbeSideOutput() const;
 
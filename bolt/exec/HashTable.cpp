@@ -834,6 +834,7 @@ void HashTable<ignoreNullKeys>::allocateTables(uint64_t size) {
   rows_->pool()->allocateContiguous(numPages, tableAllocation_);
   table_ = tableAllocation_.data<char*>();
   memset(table_, 0, capacity_ * sizeof(char*));
+  compactRows_.reset();
 }
 
 template <bool ignoreNullKeys>
@@ -845,6 +846,7 @@ void HashTable<ignoreNullKeys>::clear() {
     // All modes have 8 bytes per slot.
     memset(table_, 0, capacity_ * sizeof(char*));
   }
+  compactRows_.reset();
   numDistinct_ = 0;
   numTombstones_ = 0;
   numProbeInputs_ = 0;
@@ -1858,6 +1860,59 @@ void HashTable<ignoreNullKeys>::prepareJoinTable(
             << ", numDistinct_ = " << numDistinct_;
 }
 
+template <bool ignoreNullKeys>
+bool HashTable<ignoreNullKeys>::compactJoinTable(uint64_t maxBytes) {
+  BOLT_CHECK(isJoinBuild_);
+  if (hashMode_ != HashMode::kHash || table_ == nullptr ||
+      rows_->probedFlagOffset() != 0) {
+    return false;
+  }
+  const auto rowSize = rows_->fixedRowSize();
+  uint64_t numRows = 0;
+  for (const auto* rowContainer : allRows()) {
+    numRows += rowContainer->numRows();
+  }
+  if (numRows == 0 || numRows * rowSize > maxBytes) {
+    return false;
+  }
+
+  // Rows that repeat a key of a table without next row links are not in the
+  // table, so fewer than 'numRows' rows may be copied.
+  auto compactRows =
+      AlignedBuffer::allocate<char>(numRows * rowSize, rows_->pool());
+  char* nextCopy = compactRows->asMutable<char>();
+  const auto copyRow = [&](const char* row) {
+    char* copy = nextCopy;
+    std::memcpy(copy, row, rowSize);
+    nextCopy += rowSize;
+    return copy;
+  };
+  for (int64_t offset = 0; offset < numBuckets_ * kBucketSize;
+       offset += kBucketSize) {
+    auto* bucket = bucketAt(offset);
+    for (auto slot = 0; slot < sizeof(TagVector); ++slot) {
+      const auto tag = bucket->tagAt(slot);
+      if (tag == ProbeState::kEmptyTag || tag == ProbeState::kTombstoneTag) {
+        continue;
+      }
+      char* copy = copyRow(bucket->pointerAt(slot));
+      bucket->setPointer(slot, copy);
+      if (nextOffset_ == 0) {
+        continue;
+      }
+      // The copy still links to the original of the next row.
+      for (char* row = copy; nextRow(row) != nullptr; row = nextRow(row)) {
+        nextRow(row) = copyRow(nextRow(row));
+      }
+    }
+  }
+  BOLT_CHECK_LE(
+      static_cast<uint64_t>(nextCopy - compactRows->as<char>()),
+      numRows * rowSize);
+  compactRows_ = std::move(compactRows);
+  return true;
+}
+
 template <bool ignoreNullKeys>
 int32_t HashTable<ignoreNullKeys>::listJoinResults(
     JoinResultIterator& iter,
@@ -313,6 +313,18 @@ class BaseHashTable {
   /// deduplicated.
   virtual void joinTableMayHaveDuplicates() = 0;
 
+  /// Copies the rows of a join table prepared in kHash mode into one
+  /// contiguous block in the order of their table slots, with the rows of
+  /// equal keys right after the first one, and points the table at the
+  /// copies. Probes of a small build side then compare keys and extract
+  /// columns from a dense, cache-resident block instead of from rows spread
+  /// over the pages of several RowContainers. Returns false without changing
+  /// anything if the table is in another mode, has a probed flag or if the
+  /// rows take more than 'maxBytes'. The copies share the string storage of
+  /// the RowContainers, which keep the original rows for listing and
+  /// spilling.
+  virtual bool compactJoinTable(uint64_t maxBytes) = 0;
+
   /// Returns the memory footprint in bytes for any data structures
   /// owned by 'this'.
   virtual int64_t allocatedBytes() const = 0;
@@ -653,8 +665,10 @@ class HashTable : public BaseHashTable {
 
   int64_t allocatedBytes() const override {
     // For each row: sizeof(char*) per table entry + memory
-    // allocated with MemoryAllocator for fixed-width rows and strings.
-    return sizeof(char*) * capacity_ + rows_->allocatedBytes();
+    // allocated with MemoryAllocator for fixed-width rows and strings + the
+    // compacted copies of the rows, if any.
+    return sizeof(char*) * capacity_ + rows_->allocatedBytes() +
+        (compactRows_ ? compactRows_->capacity() : 0);
   }
 
   HashStringAllocator* stringAllocator() override {
@@ -686,6 +700,8 @@ class HashTable : public BaseHashTable {
     joinBuildNoDuplicates_ = false;
   }
 
+  bool compactJoinTable(uint64_t maxBytes) override;
+
   HashMode hashMode() const override {
     return hashMode_;
   }
@@ -1094,6 +1110,10 @@ class HashTable : public BaseHashTable {
   char** table_ = nullptr;
   memory::ContiguousAllocation tableAllocation_;
 
+  // Copies of the rows the table points to after compactJoinTable(). Dropped
+  // when the table is reallocated or cleared.
+  BufferPtr compactRows_;
+
   // Number of slots across all buckets.
   int64_t capacity_{0};
 
@@ -469,6 +469,22 @@ OperatorStats Operator::stats(bool clear) {
 
 uint32_t Operator::outputBatchRows(
     std::optional<uint64_t> averageRowSize) const {
+  if (auto* controller = operatorCtx_->task()->batchSizeController()) {
+    if (!averageRowSize.has_value()) {
+      const auto [outputBytes, outputPositions] =
+          stats_.withRLock([](const auto& stats) {
+            return std::make_pair(stats.outputBytes, stats.outputPositions);
+          });
+      if (outputPositions > 0) {
+        averageRowSize = outputBytes / outputPositions;
+      }
+    }
+    const auto numRows = controller->outputBatchRows(averageRowSize);
+    stats_.wlock()->addRuntimeStat(
+        kAdaptiveOutputBatchRows, RuntimeCounter(numRows));
+    return numRows;
+  }
+
   const auto& queryConfig = operatorCtx_->task()->queryCtx()->queryConfig();
 
   if (!averageRowSize.has_value()) {
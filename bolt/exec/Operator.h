@@ -189,6 +189,11 @@ class Operator : public BaseRuntimeStatWriter {
   };
   static constexpr const char* kSpillWrites = "spillWrites";
 
+  /// Runtime stat with the output batch sizes chosen by the task's
+  /// BatchSizeController.
+  static constexpr const char* kAdaptiveOutputBatchRows =
+      "adaptiveOutputBatchRows";
+
   /// 'operatorId' is the initial index of the 'this' in the Driver's list of
   /// Operators. This is used as in index into OperatorStats arrays in the Task.
   /// 'planNodeId' is a query-level unique identifier of the PlanNode to which
@@ -608,6 +613,10 @@ class Operator : public BaseRuntimeStatWriter {
   /// must not be negative. If the averageRowSize is 0 which is not advised,
   /// returns maxOutputBatchRows. If the averageRowSize is not given, returns
   /// preferredOutputBatchRows.
+  ///
+  /// With 'adaptive_output_batch_sizing', the sizes are scaled by the task's
+  /// BatchSizeController and a missing averageRowSize is estimated from the
+  /// output produced so far.
   uint32_t outputBatchRows(
       std::optional<uint64_t> averageRowSize = std::nullopt) const;
 
@@ -641,7 +650,8 @@ class Operator : public BaseRuntimeStatWriter {
 
   bool initialized_{false};
 
-  folly::Synchronized<OperatorStats> stats_;
+  // Mutable for recording runtime stats from const members.
+  mutable folly::Synchronized<OperatorStats> stats_;
 
   /// NOTE: only one of the two could be set for an operator for tracing .
   /// 'splitTracer_' is only set for table scan to record the processed split
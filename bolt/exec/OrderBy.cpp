@@ -121,6 +121,9 @@ void OrderBy::noMoreInput() {
   sortBuffer_->noMoreInput();
   maxOutputRows_ = outputBatchRows(sortBuffer_->estimateOutputRowSize());
   recordSpillStats();
+  if (const auto numMergeRanges = sortBuffer_->numSpillMergeRanges()) {
+    addRuntimeStat(kSpillMergeRanges, RuntimeCounter(numMergeRanges));
+  }
 }
 
 RowVectorPtr OrderBy::getOutput() {
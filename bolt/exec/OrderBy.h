@@ -49,6 +49,10 @@ namespace bytedance::bolt::exec {
 /// output.
 class OrderBy : public Operator {
  public:
+  /// Runtime stat with the number of key ranges the spilled runs are merged
+  /// in. Not set if nothing was spilled.
+  static constexpr const char* kSpillMergeRanges = "spillMergeRanges";
+
   OrderBy(
       int32_t operatorId,
       DriverCtx* FOLLY_NONNULL driverCtx,
@@ -43,7 +43,7 @@ BlockingReason Destination::advance(
     bool* atEnd,
     ContinueFuture* future,
     Scratch& scratch) {
-  if (rowIdx_ >= rows_.size()) {
+  if (rowIdx_ >= numRows()) {
     *atEnd = true;
     return BlockingReason::kNotBlocked;
   }
@@ -56,8 +56,9 @@ BlockingReason Destination::advance(
 
   // Collect rows to serialize.
   bool shouldFlush = false;
-  while (rowIdx_ < rows_.size() && !shouldFlush) {
-    bytesInCurrent_ += sizes[rowIdx_];
+  while (rowIdx_ < numRows() && !shouldFlush) {
+    bytesInCurrent_ +=
+        sizes[range_.has_value() ? range_->begin + rowIdx_ : rowIdx_];
     ++rowIdx_;
     ++rowsInCurrent_;
     shouldFlush =
@@ -70,10 +71,15 @@ BlockingReason Destination::advance(
     auto rowType = asRowType(output->type());
     current_->createStreamTree(rowType, rowsInCurrent_, &options_);
   }
-  current_->append(
-      output, folly::Range(&rows_[firstRow], rowIdx_ - firstRow), scratch);
+  if (range_.has_value()) {
+    const IndexRange range{range_->begin + firstRow, rowIdx_ - firstRow};
+    current_->append(output, folly::Range(&range, 1), scratch);
+  } else {
+    current_->append(
+        output, folly::Range(&rows_[firstRow], rowIdx_ - firstRow), scratch);
+  }
   // Update output state variable.
-  if (rowIdx_ == rows_.size()) {
+  if (rowIdx_ == numRows()) {
     *atEnd = true;
   }
   if (shouldFlush || (eagerFlush_ && rowsInCurrent_ > 0)) {
@@ -157,7 +163,14 @@ PartitionedOutput::PartitionedOutput(
       compressionKind_(
           ctx->task->queryCtx()->queryConfig().isExchangeCompressionEnabled()
               ? common::CompressionKind_ZSTD
-              : common::CompressionKind_NONE) {
+              : common::CompressionKind_NONE),
+      partitionMajorGather_([&]() {
+        const auto minDestinations = ctx->task->queryCtx()
+                                         ->queryConfig()
+                                         .partitionMajorGatherMinDestinations();
+        return minDestinations > 0 && numDestinations_ > 1 &&
+            numDestinations_ >= minDestinations;
+      }()) {
   if (!planNode->isPartitioned()) {
     BOLT_USER_CHECK_EQ(numDestinations_, 1);
   }
@@ -213,7 +226,7 @@ void PartitionedOutput::initializeDestinations() {
 }
 
 void PartitionedOutput::initializeSizeBuffers() {
-  auto numInput = input_->size();
+  auto numInput = output_->size();
   if (numInput > rowSize_.size()) {
     rowSize_.resize(numInput);
     sizePointers_.resize(numInput);
@@ -225,7 +238,7 @@ void PartitionedOutput::initializeSizeBuffers() {
 }
 
 void PartitionedOutput::estimateRowSizes() {
-  auto numInput = input_->size();
+  auto numInput = output_->size();
   std::fill(rowSize_.begin(), rowSize_.end(), 0);
   raw_vector<vector_size_t> storage;
   auto numbers = iota(numInput, storage);
@@ -243,10 +256,6 @@ void PartitionedOutput::addInput(RowVectorPtr input) {
 
   initializeDestinations();
 
-  initializeSizeBuffers();
-
-  estimateRowSizes();
-
   for (auto& destination : destinations_) {
     destination->beginBatch();
   }
@@ -258,7 +267,14 @@ void PartitionedOutput::addInput(RowVectorPtr input) {
     auto singlePartition = partitionFunction_->partition(*input_, partitions_);
     if (replicateNullsAndAny_) {
       collectNullRows();
-
+    }
+    // Rows that go to every destination would be gathered once per
+    // destination, so batches with such rows are added row by row.
+    const bool hasReplicatedRows = replicateNullsAndAny_ &&
+        (!replicatedAny_ || nullRows_.hasSelections());
+    if (partitionMajorGather_ && !hasReplicatedRows) {
+      gatherByPartition(singlePartition);
+    } else if (replicateNullsAndAny_) {
       vector_size_t start = 0;
       if (!replicatedAny_) {
         for (auto& destination : destinations_) {
@@ -292,6 +308,62 @@ void PartitionedOutput::addInput(RowVectorPtr input) {
       }
     }
   }
+
+  // Sizes are estimated after partitioning since partition-major gather
+  // replaces 'output_'.
+  initializeSizeBuffers();
+
+  estimateRowSizes();
+}
+
+void PartitionedOutput::gatherByPartition(
+    const std::optional<uint32_t>& singlePartition) {
+  const auto numRows = input_->size();
+  if (singlePartition.has_value()) {
+    destinations_[singlePartition.value()]->setRange(IndexRange{0, numRows});
+    return;
+  }
+
+  // Counting sort of the rows by destination. Within a destination the rows
+  // keep their input order.
+  partitionOffsets_.assign(numDestinations_ + 1, 0);
+  for (vector_size_t row = 0; row < numRows; ++row) {
+    ++partitionOffsets_[partitions_[row] + 1];
+  }
+  for (auto i = 0; i < numDestinations_; ++i) {
+    partitionOffsets_[i + 1] += partitionOffsets_[i];
+  }
+  std::vector<vector_size_t> next(
+      partitionOffsets_.begin(), partitionOffsets_.end() - 1);
+  gatherRows_.resize(numRows);
+  for (vector_size_t row = 0; row < numRows; ++row) {
+    gatherRows_[next[partitions_[row]]++] = row;
+  }
+
+  // Gathers one column at a time. The columns of the previous batch are
+  // reused once the destinations no longer reference them.
+  rows_.resizeFill(numRows, true);
+  gatheredColumns_.resize(output_->childrenSize());
+  for (auto i = 0; i < output_->childrenSize(); ++i) {
+    const auto& source = BaseVector::loadedVectorShared(output_->childAt(i));
+    auto& column = gatheredColumns_[i];
+    if (column != nullptr && column.use_count() == 1 &&
+        column->type()->equivalent(*source->type())) {
+      BaseVector::prepareForReuse(column, numRows);
+    } else {
+      column = BaseVector::create(source->type(), numRows, pool());
+    }
+    column->copy(source.get(), rows_, gatherRows_.data(), false);
+  }
+  output_ = std::make_shared<RowVector>(
+      pool(), outputType_, nullptr, numRows, gatheredColumns_);
+
+  for (auto i = 0; i < numDestinations_; ++i) {
+    const auto size = partitionOffsets_[i + 1] - partitionOffsets_[i];
+    if (size > 0) {
+      destinations_[i]->setRange(IndexRange{partitionOffsets_[i], size});
+    }
+  }
 }
 
 void PartitionedOutput::collectNullRows() {
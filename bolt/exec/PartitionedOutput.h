@@ -60,6 +60,7 @@ class Destination {
   // Resets the destination before starting a new batch.
   void beginBatch() {
     rows_.clear();
+    range_.reset();
     rowIdx_ = 0;
   }
 
@@ -73,6 +74,14 @@ class Destination {
     }
   }
 
+  /// Sets the rows of the batch to the contiguous 'rows' of a partition-major
+  /// output. They are serialized as ranges instead of row by row. Must not be
+  /// combined with addRow() or addRows() in the same batch.
+  void setRange(const IndexRange& rows) {
+    BOLT_CHECK(rows_.empty());
+    range_ = rows;
+  }
+
   // Serializes row from 'output' till either 'maxBytes' have been serialized or
   BlockingReason advance(
       uint64_t maxBytes,
@@ -102,6 +111,10 @@ class Destination {
   }
 
  private:
+  vector_size_t numRows() const {
+    return range_.has_value() ? range_->size : rows_.size();
+  }
+
   // Sets the next target size for flushing. This is called at the
   // start of each batch of output for the destination. The effect is
   // to make different destinations ready at slightly different times
@@ -127,7 +140,10 @@ class Destination {
   vector_size_t rowsInCurrent_{0};
   raw_vector<vector_size_t> rows_;
 
-  // First index of 'rows_' that is not appended to 'current_'.
+  // Set instead of 'rows_' if the rows of the batch are contiguous.
+  std::optional<IndexRange> range_;
+
+  // First index of 'rows_' or 'range_' that is not appended to 'current_'.
   vector_size_t rowIdx_{0};
 
   // The current stream where the input is serialized to. This is cleared on
@@ -199,6 +215,7 @@ class PartitionedOutput : public Operator {
   void close() override {
     Operator::close();
     destinations_.clear();
+    gatheredColumns_.clear();
   }
 
  private:
@@ -213,6 +230,12 @@ class PartitionedOutput : public Operator {
   /// Collect all rows with null keys into nullRows_.
   void collectNullRows();
 
+  /// Replaces 'output_' with its rows sorted by destination and gives each
+  /// destination its contiguous range of the result. The sort is a counting
+  /// sort over 'partitions_' and the rows are gathered one column at a time.
+  /// Not used for batches with rows that go to every destination.
+  void gatherByPartition(const std::optional<uint32_t>& singlePartition);
+
   const std::vector<column_index_t> keyChannels_;
   const int numDestinations_;
   const bool replicateNullsAndAny_;
@@ -224,6 +247,8 @@ class PartitionedOutput : public Operator {
   const int64_t maxBufferedBytes_;
   const bool eagerFlush_;
   const common::CompressionKind compressionKind_;
+  // True if rows are gathered by partition before serialization.
+  const bool partitionMajorGather_;
 
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
   ContinueFuture future_;
@@ -240,6 +265,11 @@ class PartitionedOutput : public Operator {
   std::vector<uint32_t> partitions_;
   std::vector<DecodedVector> decodedVectors_;
   Scratch scratch_;
+  // Start of the rows of each destination in the partition-major output.
+  std::vector<vector_size_t> partitionOffsets_;
+  // Input row of each row of the partition-major output.
+  std::vector<vector_size_t> gatherRows_;
+  std::vector<VectorPtr> gatheredColumns_;
 };
 
 } // namespace bytedance::bolt::exec
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/exec/PrefixSort.h"
+
+#include <cstring>
+#include <string>
+
+#include <folly/lang/Bits.h>
+
+#include "bolt/buffer/Buffer.h"
+#include "bolt/common/base/Exceptions.h"
+#include "bolt/exec/prefixsort/PrefixSortAlgorithm.h"
+#include "bolt/exec/prefixsort/PrefixSortEncoder.h"
+namespace bytedance::bolt::exec {
+namespace {
+
+using prefixsort::PrefixSortEncoder;
+
+// A key column and where its normalized key goes in an entry of the sort
+// buffer: one byte that orders nulls, followed by 'size' bytes of value.
+struct NormalizedKey {
+  RowColumn column;
+  TypeKind kind;
+  CompareFlags flags;
+  uint32_t offset;
+  uint32_t size;
+};
+
+bool isString(TypeKind kind) {
+  return kind == TypeKind::VARCHAR || kind == TypeKind::VARBINARY;
+}
+
+// Returns the number of bytes a non-null value of 'kind' encodes to, or
+// std::nullopt if values of 'kind' cannot be encoded.
+std::optional<uint32_t> encodedSize(
+    TypeKind kind,
+    uint32_t stringPrefixLength) {
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+      return PrefixSortEncoder::encodedSize<bool>();
+    case TypeKind::TINYINT:
+      return PrefixSortEncoder::encodedSize<int8_t>();
+    case TypeKind::SMALLINT:
+      return PrefixSortEncoder::encodedSize<int16_t>();
+    case TypeKind::INTEGER:
+      return PrefixSortEncoder::encodedSize<int32_t>();
+    case TypeKind::BIGINT:
+      return PrefixSortEncoder::encodedSize<int64_t>();
+    case TypeKind::REAL:
+      return PrefixSortEncoder::encodedSize<float>();
+    case TypeKind::DOUBLE:
+      return PrefixSortEncoder::encodedSize<double>();
+    case TypeKind::TIMESTAMP:
+      return PrefixSortEncoder::encodedSize<Timestamp>();
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return stringPrefixLength + 1;
+    default:
+      return std::nullopt;
+  }
+}
+
+template <TypeKind Kind>
+void encodeValue(const char* row, int32_t offset, char* dest) {
+  using T = typename KindToFlatVector<Kind>::HashRowType;
+  PrefixSortEncoder::encode(RowContainer::valueAt<T>(row, offset), dest);
+}
+
+void encodeKey(
+    const NormalizedKey& key,
+    const char* row,
+    uint32_t stringPrefixLength,
+    std::string& storage,
+    char* dest) {
+  char* value = dest + 1;
+  if (RowContainer::isNullAt(row, key.column)) {
+    dest[0] = key.flags.nullsFirst ? 0 : 1;
+    std::memset(value, 0, key.size);
+    return;
+  }
+  dest[0] = key.flags.nullsFirst ? 1 : 0;
+  const auto offset = key.column.offset();
+  switch (key.kind) {
+    case TypeKind::BOOLEAN:
+      encodeValue<TypeKind::BOOLEAN>(row, offset, value);
+      break;
+    case TypeKind::TINYINT:
+      encodeValue<TypeKind::TINYINT>(row, offset, value);
+      break;
+    case TypeKind::SMALLINT:
+      encodeValue<TypeKind::SMALLINT>(row, offset, value);
+      break;
+    case TypeKind::INTEGER:
+      encodeValue<TypeKind::INTEGER>(row, offset, value);
+      break;
+    case TypeKind::BIGINT:
+      encodeValue<TypeKind::BIGINT>(row, offset, value);
+      break;
+    case TypeKind::REAL:
+      encodeValue<TypeKind::REAL>(row, offset, value);
+      break;
+    case TypeKind::DOUBLE:
+      encodeValue<TypeKind::DOUBLE>(row, offset, value);
+      break;
+    case TypeKind::TIMESTAMP:
+      encodeValue<TypeKind::TIMESTAMP>(row, offset, value);
+      break;
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY: {
+      const auto view = HashStringAllocator::contiguousString(
+          RowContainer::valueAt<StringView>(row, offset), storage);
+      PrefixSortEncoder::encode(
+          std::string_view(view.data(), view.size()),
+          stringPrefixLength,
+          value);
+      break;
+    }
+    default:
+      BOLT_UNREACHABLE();
+  }
+  if (!key.flags.ascending) {
+    for (auto i = 0; i < key.size; ++i) {
+      value[i] = ~value[i];
+    }
+  }
+}
+
+} // namespace
+
+// static
+std::optional<PrefixSortConfig> PrefixSort::config(
+    const core::QueryConfig& queryConfig) {
+  PrefixSortConfig config;
+  config.maxNormalizedKeyBytes = queryConfig.prefixSortNormalizedKeyMaxBytes();
+  if (config.maxNormalizedKeyBytes == 0) {
+    return std::nullopt;
+  }
+  config.minNumRows = queryConfig.prefixSortMinRows();
+  config.maxStringPrefixLength = queryConfig.prefixSortMaxStringPrefixLength();
+  BOLT_USER_CHECK_LT(
+      config.maxStringPrefixLength,
+      255,
+      "{} must be less than 255",
+      core::QueryConfig::kPrefixSortMaxStringPrefixLength);
+  return config;
+}
+
+// static
+bool PrefixSort::sort(
+    folly::Range<char**> rows,
+    RowContainer* rowContainer,
+    const std::vector<column_index_t>& keyColumns,
+    const std::vector<CompareFlags>& compareFlags,
+    const PrefixSortConfig& config,
+    memory::MemoryPool* pool) {
+  BOLT_CHECK_EQ(keyColumns.size(), compareFlags.size());
+  if (rows.size() < std::max<uint32_t>(config.minNumRows, 2)) {
+    return false;
+  }
+
+  std::vector<NormalizedKey> keys;
+  uint32_t keyBytes = 0;
+  for (auto i = 0; i < keyColumns.size(); ++i) {
+    const auto kind = rowContainer->columnTypes()[keyColumns[i]]->kind();
+    const auto size = encodedSize(kind, config.maxStringPrefixLength);
+    if (!size.has_value() ||
+        keyBytes + 1 + size.value() > config.maxNormalizedKeyBytes) {
+      break;
+    }
+    keys.push_back(
+        {rowContainer->columnAt(keyColumns[i]),
+         kind,
+         compareFlags[i],
+         keyBytes,
+         size.value()});
+    keyBytes += 1 + size.value();
+    // A truncated string decides nothing about the keys after it.
+    if (isString(kind)) {
+      break;
+    }
+  }
+  if (keys.empty()) {
+    return false;
+  }
+  // Keys from 'firstTieKey' on are compared in full when the normalized keys
+  // of two rows are equal.
+  const size_t firstTieKey =
+      isString(keys.back().kind) ? keys.size() - 1 : keys.size();
+
+  // Each entry is the normalized key followed by the row pointer. The entry
+  // after the last one is the swap buffer of the sort.
+  const uint64_t entrySize = keyBytes + sizeof(char*);
+  auto buffer =
+      AlignedBuffer::allocate<char>((rows.size() + 1) * entrySize, pool);
+  char* const entries = buffer->asMutable<char>();
+  char* const end = entries + rows.size() * entrySize;
+  std::string storage;
+  for (auto i = 0; i < rows.size(); ++i) {
+    char* entry = entries + i * entrySize;
+    for (const auto& key : keys) {
+      encodeKey(
+          key,
+          rows[i],
+          config.maxStringPrefixLength,
+          storage,
+          entry + key.offset);
+    }
+    folly::storeUnaligned<char*>(entry + keyBytes, rows[i]);
+  }
+
+  prefixsort::PrefixSortRunner runner(entrySize, end);
+  if (firstTieKey < keyColumns.size()) {
+    runner.quickSort(entries, end, [&](char* left, char* right) {
+      if (auto result = std::memcmp(left, right, keyBytes)) {
+        return result;
+      }
+      const auto* leftRow = folly::loadUnaligned<char*>(left + keyBytes);
+      const auto* rightRow = folly::loadUnaligned<char*>(right + keyBytes);
+      for (auto i = firstTieKey; i < keyColumns.size(); ++i) {
+        if (auto result = rowContainer->compare(
+                leftRow, rightRow, keyColumns[i], compareFlags[i])) {
+          return result;
+        }
+      }
+      return 0;
+    });
+  } else {
+    runner.quickSort(entries, end, [&](char* left, char* right) {
+      return std::memcmp(left, right, keyBytes);
+    });
+  }
+
+  for (auto i = 0; i < rows.size(); ++i) {
+    rows[i] = folly::loadUnaligned<char*>(entries + i * entrySize + keyBytes);
+  }
+  return true;
+}
+
+} // namespace bytedance::bolt::exec
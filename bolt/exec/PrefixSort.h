@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <folly/Range.h>
+
+#include "bolt/common/base/CompareFlags.h"
+#include "bolt/common/memory/MemoryPool.h"
+#include "bolt/core/QueryConfig.h"
+#include "bolt/exec/RowContainer.h"
+namespace bytedance::bolt::exec {
+
+struct PrefixSortConfig {
+  /// Maximum number of bytes of normalized keys per row.
+  uint32_t maxNormalizedKeyBytes{128};
+
+  /// Inputs with fewer rows are left to the comparison-based sorts.
+  uint32_t minNumRows{128};
+
+  /// Number of leading bytes of a VARCHAR or VARBINARY key in the prefix.
+  uint32_t maxStringPrefixLength{16};
+};
+
+/// Sorts rows of a RowContainer by their normalized keys instead of by
+/// comparing the rows. The leading sort keys of each row are encoded into a
+/// byte string that orders like the keys under their CompareFlags and that is
+/// stored next to the row pointer in a contiguous buffer. The buffer is
+/// sorted with memcmp, so most comparisons touch neither the RowContainer
+/// nor its string storage. Only rows whose prefixes tie on a string key that
+/// was truncated, or on all encoded keys when some keys were not encoded,
+/// are compared in full.
+///
+/// BOOLEAN, integer, REAL, DOUBLE, TIMESTAMP, VARCHAR and VARBINARY keys are
+/// encoded. Encoding stops at the first key of another type, after the first
+/// string key and when 'maxNormalizedKeyBytes' would be exceeded.
+class PrefixSort {
+ public:
+  /// Returns the configuration in 'queryConfig', or std::nullopt if prefix
+  /// sort is disabled.
+  static std::optional<PrefixSortConfig> config(
+      const core::QueryConfig& queryConfig);
+
+  /// Sorts 'rows' of 'rowContainer' by the columns 'keyColumns' compared
+  /// with 'compareFlags'. Returns false without changing 'rows' if there are
+  /// fewer than 'config.minNumRows' rows or the first key cannot be encoded.
+  /// The normalized keys are allocated from 'pool'.
+  static bool sort(
+      folly::Range<char**> rows,
+      RowContainer* rowContainer,
+      const std::vector<column_index_t>& keyColumns,
+      const std::vector<CompareFlags>& compareFlags,
+      const PrefixSortConfig& config,
+      memory::MemoryPool* pool);
+};
+
+} // namespace bytedance::bolt::exec
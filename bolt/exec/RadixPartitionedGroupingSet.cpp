@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/exec/RadixPartitionedGroupingSet.h"
+#include <numeric>
+#include "bolt/exec/OperatorUtils.h"
+namespace bytedance::bolt::exec {
+
+RadixPartitionedGroupingSet::RadixPartitionedGroupingSet(
+    const RowTypePtr& inputType,
+    const std::vector<column_index_t>& keyChannels,
+    const HashBitRange& hashBits,
+    const common::SpillConfig* spillConfig,
+    const GroupingSetFactory& groupingSetFactory,
+    memory::MemoryPool* pool)
+    : pool_(pool), partitionFunction_(hashBits, inputType, keyChannels) {
+  BOLT_CHECK_GT(hashBits.numBits(), 0);
+  const auto numPartitions = hashBits.numPartitions();
+  if (spillConfig != nullptr) {
+    spillConfigs_.reserve(numPartitions);
+    for (auto i = 0; i < numPartitions; ++i) {
+      spillConfigs_.push_back(*spillConfig);
+      spillConfigs_.back().fileNamePrefix =
+          fmt::format("{}_radix{}", spillConfig->fileNamePrefix, i);
+    }
+  }
+  partitions_.reserve(numPartitions);
+  for (auto i = 0; i < numPartitions; ++i) {
+    partitions_.push_back(groupingSetFactory(
+        spillConfigs_.empty() ? nullptr : &spillConfigs_[i]));
+  }
+  outputIterators_.resize(numPartitions);
+  partitionSizes_.resize(numPartitions);
+  partitionIndices_.resize(numPartitions);
+}
+
+void RadixPartitionedGroupingSet::addInput(
+    const RowVectorPtr& input,
+    bool mayPushdown) {
+  const auto numRows = input->size();
+  if (numRows == 0) {
+    return;
+  }
+
+  // The same lazy vector can't be loaded by several dictionary wrappers over
+  // different row subsets.
+  if (isLazyNotLoaded(*input)) {
+    input->loadedVector();
+  }
+
+  const auto singlePartition =
+      partitionFunction_.partition(*input, partitionIds_);
+  if (singlePartition.has_value()) {
+    partitions_[singlePartition.value()]->addInput(input, mayPushdown);
+    return;
+  }
+
+  std::fill(partitionSizes_.begin(), partitionSizes_.end(), 0);
+  for (auto row = 0; row < numRows; ++row) {
+    ++partitionSizes_[partitionIds_[row]];
+  }
+
+  std::vector<vector_size_t*> rawIndices(partitions_.size(), nullptr);
+  for (auto partition = 0; partition < partitions_.size(); ++partition) {
+    const auto size = partitionSizes_[partition];
+    if (size == numRows) {
+      partitions_[partition]->addInput(input, mayPushdown);
+      return;
+    }
+    if (size == 0) {
+      continue;
+    }
+    partitionIndices_[partition] = allocateIndices(size, pool_);
+    rawIndices[partition] =
+        partitionIndices_[partition]->asMutable<vector_size_t>();
+    partitionSizes_[partition] = 0;
+  }
+
+  for (auto row = 0; row < numRows; ++row) {
+    const auto partition = partitionIds_[row];
+    rawIndices[partition][partitionSizes_[partition]++] = row;
+  }
+
+  for (auto partition = 0; partition < partitions_.size(); ++partition) {
+    const auto size = partitionSizes_[partition];
+    if (size == 0) {
+      continue;
+    }
+    partitions_[partition]->addInput(
+        wrapAndCombineDict(size, partitionIndices_[partition], input),
+        /*mayPushdown=*/false);
+    partitionIndices_[partition] = nullptr;
+  }
+}
+
+void RadixPartitionedGroupingSet::noMoreInput() {
+  noMoreInput_ = true;
+  for (auto& partition : partitions_) {
+    partition->noMoreInput();
+  }
+}
+
+bool RadixPartitionedGroupingSet::getOutput(
+    int32_t maxOutputRows,
+    int32_t maxOutputBytes,
+    RowVectorPtr& result) {
+  BOLT_CHECK(noMoreInput_);
+  while (outputPartition_ < partitions_.size()) {
+    if (partitions_[outputPartition_]->getOutput(
+            maxOutputRows,
+            maxOutputBytes,
+            outputIterators_[outputPartition_],
+            result)) {
+      return true;
+    }
+    outputIterators_[outputPartition_].reset();
+    ++outputPartition_;
+  }
+  return false;
+}
+
+void RadixPartitionedGroupingSet::spill(uint64_t targetBytes) {
+  BOLT_CHECK(!noMoreInput_);
+  std::vector<int32_t> order(partitions_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::vector<uint64_t> partitionBytes(partitions_.size());
+  for (auto i = 0; i < partitions_.size(); ++i) {
+    partitionBytes[i] =
+        partitions_[i]->numRows() == 0 ? 0 : partitions_[i]->allocatedBytes();
+  }
+  std::sort(order.begin(), order.end(), [&](int32_t lhs, int32_t rhs) {
+    return partitionBytes[lhs] > partitionBytes[rhs];
+  });
+
+  const auto startBytes = pool_->currentBytes();
+  for (const auto partition : order) {
+    if (partitionBytes[partition] == 0) {
+      break;
+    }
+    partitions_[partition]->spill();
+    if (targetBytes != 0 &&
+        startBytes - std::min(startBytes, pool_->currentBytes()) >=
+            targetBytes) {
+      break;
+    }
+  }
+}
+
+void RadixPartitionedGroupingSet::spillRemaining() {
+  BOLT_CHECK(noMoreInput_);
+  for (auto partition = outputPartition_; partition < partitions_.size();
+       ++partition) {
+    if (partitions_[partition]->hasSpilled()) {
+      continue;
+    }
+    partitions_[partition]->spill(outputIterators_[partition]);
+  }
+}
+
+int32_t RadixPartitionedGroupingSet::numSpilledPartitions() const {
+  int32_t numSpilled{0};
+  for (const auto& partition : partitions_) {
+    numSpilled += partition->hasSpilled();
+  }
+  return numSpilled;
+}
+
+uint64_t RadixPartitionedGroupingSet::allocatedBytes() const {
+  uint64_t bytes{0};
+  for (const auto& partition : partitions_) {
+    bytes += partition->allocatedBytes();
+  }
+  return bytes;
+}
+
+int64_t RadixPartitionedGroupingSet::numDistinct() const {
+  int64_t numDistinct{0};
+  for (const auto& partition : partitions_) {
+    numDistinct += partition->numDistinct();
+  }
+  return numDistinct;
+}
+
+int64_t RadixPartitionedGroupingSet::numRows() const {
+  int64_t numRows{0};
+  for (const auto& partition : partitions_) {
+    numRows += partition->numRows();
+  }
+  return numRows;
+}
+
+HashTableStats RadixPartitionedGroupingSet::hashTableStats() const {
+  HashTableStats stats;
+  for (const auto& partition : partitions_) {
+    const auto partitionStats = partition->hashTableStats();
+    stats.capacity += partitionStats.capacity;
+    stats.numRehashes += partitionStats.numRehashes;
+    stats.numDistinct += partitionStats.numDistinct;
+    stats.numTombstones += partitionStats.numTombstones;
+  }
+  return stats;
+}
+
+std::optional<int64_t> RadixPartitionedGroupingSet::estimateOutputRowSize()
+    const {
+  std::optional<int64_t> rowSize;
+  for (const auto& partition : partitions_) {
+    const auto partitionRowSize = partition->estimateOutputRowSize();
+    if (partitionRowSize.has_value()) {
+      rowSize = std::max(rowSize.value_or(0), partitionRowSize.value());
+    }
+  }
+  return rowSize;
+}
+
+std::optional<common::SpillStats>
+RadixPartitionedGroupingSet::newSpilledStats() {
+  std::optional<common::SpillStats> totalStats;
+  for (const auto& partition : partitions_) {
+    const auto partitionStats = partition->spilledStats();
+    if (partitionStats.has_value()) {
+      if (!totalStats.has_value()) {
+        totalStats = common::SpillStats{};
+      }
+      totalStats.value() += partitionStats.value();
+    }
+  }
+  if (!totalStats.has_value()) {
+    return std::nullopt;
+  }
+  const auto newStats = totalStats.value() - reportedSpillStats_;
+  reportedSpillStats_ = totalStats.value();
+  return newStats;
+}
+
+std::optional<common::SpillReadStats>
+RadixPartitionedGroupingSet::spillReadStats() const {
+  std::optional<common::SpillReadStats> totalStats;
+  for (const auto& partition : partitions_) {
+    const auto partitionStats = partition->spillReadStats();
+    if (partitionStats.has_value()) {
+      if (!totalStats.has_value()) {
+        totalStats = common::SpillReadStats{};
+      }
+      totalStats->spillReadTimeUs += partitionStats->spillReadTimeUs;
+      totalStats->spillDecompressTimeUs +=
+          partitionStats->spillDecompressTimeUs;
+      totalStats->spillReadIOTimeUs += partitionStats->spillReadIOTimeUs;
+    }
+  }
+  return totalStats;
+}
+
+uint64_t RadixPartitionedGroupingSet::totalSpillRowCount() const {
+  uint64_t count{0};
+  for (const auto& partition : partitions_) {
+    count += partition->totalSpillRowCount();
+  }
+  return count;
+}
+
+uint64_t RadixPartitionedGroupingSet::outputSpillRowCount() const {
+  uint64_t count{0};
+  for (const auto& partition : partitions_) {
+    count += partition->outputSpillRowCount();
+  }
+  return count;
+}
+
+common::AggregationStats RadixPartitionedGroupingSet::getRuntimeStats() const {
+  common::AggregationStats stats;
+  for (const auto& partition : partitions_) {
+    const auto partitionStats = partition->getRuntimeStats();
+    stats.aggProbeTimeNs += partitionStats.aggProbeTimeNs;
+    stats.aggFunctionTimeNs += partitionStats.aggFunctionTimeNs;
+    stats.aggOutputUpdateTimeNs += partitionStats.aggOutputUpdateTimeNs;
+    stats.aggExtractGroupsTimeNs += partitionStats.aggExtractGroupsTimeNs;
+    stats.aggOutputUniqueRows += partitionStats.aggOutputUniqueRows;
+    stats.aggOutputTimeNs += partitionStats.aggOutputTimeNs;
+    stats.aggProbeBypassTimeNs += partitionStats.aggProbeBypassTimeNs;
+    stats.aggProbeBypassCount += partitionStats.aggProbeBypassCount;
+  }
+  return stats;
+}
+
+} // namespace bytedance::bolt::exec
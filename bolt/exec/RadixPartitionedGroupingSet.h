@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bolt/exec/GroupingSet.h"
+#include "bolt/exec/HashBitRange.h"
+#include "bolt/exec/HashPartitionFunction.h"
+namespace bytedance::bolt::exec {
+
+/// Splits a high-cardinality grouping into 2^N independent GroupingSets
+/// selected by a range of hash bits of the grouping keys. Each input batch is
+/// scattered by partition and every partition is aggregated into its own small
+/// HashTable and RowContainer, so the working set of an insert stays cache
+/// resident instead of spanning one huge table. Partitions hold disjoint keys,
+/// which lets them spill and produce output one at a time.
+///
+/// The hash bits are taken from the spill partition bit range so that a radix
+/// partition covers the same keys as the corresponding spill partition.
+class RadixPartitionedGroupingSet {
+ public:
+  /// Creates the grouping set of one partition. 'spillConfig' is owned by
+  /// 'this' and is specific to the partition, or nullptr if spilling is
+  /// disabled.
+  using GroupingSetFactory = std::function<std::unique_ptr<GroupingSet>(
+      const common::SpillConfig* spillConfig)>;
+
+  RadixPartitionedGroupingSet(
+      const RowTypePtr& inputType,
+      const std::vector<column_index_t>& keyChannels,
+      const HashBitRange& hashBits,
+      const common::SpillConfig* spillConfig,
+      const GroupingSetFactory& groupingSetFactory,
+      memory::MemoryPool* pool);
+
+  void addInput(const RowVectorPtr& input, bool mayPushdown);
+
+  void noMoreInput();
+
+  bool hasOutput() const {
+    return noMoreInput_;
+  }
+
+  /// Produces the output of the partitions in partition order. Returns false
+  /// once all the partitions are exhausted.
+  bool getOutput(
+      int32_t maxOutputRows,
+      int32_t maxOutputBytes,
+      RowVectorPtr& result);
+
+  /// Spills partitions in descending order of memory usage until at least
+  /// 'targetBytes' have been freed from the pool. Spills all the partitions if
+  /// 'targetBytes' is zero. Used while receiving input.
+  void spill(uint64_t targetBytes);
+
+  /// Spills the not yet produced groups of all the partitions that have not
+  /// spilled. Used under output processing.
+  void spillRemaining();
+
+  int32_t numPartitions() const {
+    return partitions_.size();
+  }
+
+  int32_t numSpilledPartitions() const;
+
+  bool hasSpilled() const {
+    return numSpilledPartitions() > 0;
+  }
+
+  uint64_t allocatedBytes() const;
+
+  int64_t numDistinct() const;
+
+  int64_t numRows() const;
+
+  HashTableStats hashTableStats() const;
+
+  std::optional<int64_t> estimateOutputRowSize() const;
+
+  /// Returns the spill stats accumulated by all the partitions since the last
+  /// call, or std::nullopt if none of the partitions has spilled.
+  std::optional<common::SpillStats> newSpilledStats();
+
+  std::optional<common::SpillReadStats> spillReadStats() const;
+
+  uint64_t totalSpillRowCount() const;
+
+  uint64_t outputSpillRowCount() const;
+
+  common::AggregationStats getRuntimeStats() const;
+
+ private:
+  memory::MemoryPool* const pool_;
+
+  // Computes the radix partition of each input row from the grouping keys.
+  HashPartitionFunction partitionFunction_;
+
+  // Per-partition copies of the spill config with distinct spill file name
+  // prefixes. Sized once on construction as 'partitions_' point into it.
+  std::vector<common::SpillConfig> spillConfigs_;
+
+  std::vector<std::unique_ptr<GroupingSet>> partitions_;
+
+  // Output position in each partition's row container.
+  std::vector<RowContainerIterator> outputIterators_;
+
+  // The partition currently producing output.
+  int32_t outputPartition_{0};
+
+  bool noMoreInput_{false};
+
+  // Spill stats already returned by newSpilledStats().
+  common::SpillStats reportedSpillStats_;
+
+  // Reusable per-batch state for scattering input rows.
+  std::vector<uint32_t> partitionIds_;
+  std::vector<vector_size_t> partitionSizes_;
+  std::vector<BufferPtr> partitionIndices_;
+};
+
+} // namespace bytedance::bolt::exec
@@ -30,6 +30,7 @@
 
 #include "SortBuffer.h"
 #include <algorithm>
+#include <numeric>
 #include "Spiller.h"
 #include "bolt/exec/MemoryReclaimer.h"
 #include "bolt/exec/RowToColumnVector.h"
@@ -39,6 +40,56 @@
 #include "bolt/exec/meta/MetaRowSorterApi.h"
 #endif
 namespace bytedance::bolt::exec {
+namespace {
+
+// Number of sort keys sampled from each spilled run to pick the key ranges of
+// a parallel merge.
+constexpr int64_t kSpillKeySamplesPerRun = 1'024;
+
+// Number of rows per batch written by the merge of a key range.
+constexpr vector_size_t kRangeMergeBatchRows = 1'024;
+
+// Copies rows from 'merger' in merge order into 'output' from 'outputRow' on
+// until 'output' is full or 'merger' is at end, and returns the number of
+// copied rows. 'sources' and 'sourceRows' hold at least as many rows as
+// 'output'.
+vector_size_t copyMergedRows(
+    TreeOfLosers<SpillMergeStream>& merger,
+    const std::vector<IdentityProjection>& columnMap,
+    std::vector<const RowVector*>& sources,
+    std::vector<vector_size_t>& sourceRows,
+    RowVector* output,
+    vector_size_t outputRow) {
+  const auto firstRow = outputRow;
+  vector_size_t outputSize = 0;
+  bool isEndOfBatch = false;
+  while (outputRow + outputSize < output->size()) {
+    SpillMergeStream* stream = merger.next();
+    if (stream == nullptr) {
+      break;
+    }
+
+    sources[outputSize] = &stream->current();
+    sourceRows[outputSize] = stream->currentIndex(&isEndOfBatch);
+    ++outputSize;
+    if (FOLLY_UNLIKELY(isEndOfBatch)) {
+      // The stream is at end of input batch. Need to copy out the rows before
+      // fetching next batch in 'pop'.
+      gatherCopy(
+          output, outputRow, outputSize, sources, sourceRows, columnMap);
+      outputRow += outputSize;
+      outputSize = 0;
+    }
+    // Advance the stream.
+    stream->pop();
+  }
+
+  if (FOLLY_LIKELY(outputSize != 0)) {
+    gatherCopy(output, outputRow, outputSize, sources, sourceRows, columnMap);
+  }
+  return outputRow + outputSize - firstRow;
+}
+} // namespace
 
 SortBuffer::SortBuffer(
     const RowTypePtr& input,
@@ -96,6 +147,28 @@ SortBuffer::SortBuffer(
       sortedColumnTypes, nonSortedColumnTypes, pool_);
   spillerStoreType_ =
       ROW(std::move(sortedSpillColumnNames), std::move(sortedSpillColumnTypes));
+  if (operatorCtx_ != nullptr) {
+    prefixSortConfig_ =
+        PrefixSort::config(operatorCtx_->driverCtx()->queryConfig());
+    mergeParallelism_ = operatorCtx_->driverCtx()
+                            ->queryConfig()
+                            .orderBySpillMergeParallelism();
+  }
+}
+
+SortBuffer::~SortBuffer() {
+  // The range merges read 'mergePartition_' and write through 'this', so they
+  // must be done before it goes away. Closing a merge that is not read
+  // removes the files it wrote.
+  for (auto& rangeMerge : rangeMerges_) {
+    rangeMerge->close();
+  }
+  spillMerger_.reset();
+  try {
+    removeMergePartition();
+  } catch (const std::exception& e) {
+    LOG(WARNING) << "Failed to remove merged spill files: " << e.what();
+  }
 }
 
 void SortBuffer::addInput(const VectorPtr& input) {
@@ -145,52 +218,16 @@ void SortBuffer::noMoreInput() {
     data_->listRows(&iter, numInputRows_, sortedRows_.data());
 
     MicrosecondTimer timer(&sortInSortTimeUs_);
-
-#ifdef ENABLE_BOLT_JIT
-    if (cmp_ == nullptr && operatorCtx_ &&
-        operatorCtx_->driverCtx()->queryConfig().enableJitRowCmpRow()) {
-      if (data_->JITable(data_->keyTypes())) {
-        auto [jitMod, rowRowCmpfn] = data_->codegenCompare(
-            data_->keyTypes(),
+    if (!prefixSortConfig_.has_value() ||
+        !PrefixSort::sort(
+            folly::Range(sortedRows_.data(), sortedRows_.size()),
+            data_.get(),
+            data_->keyIndices(),
             sortCompareFlags_,
-            bytedance::bolt::jit::CmpType::SORT_LESS,
-            true);
-        jitModule_ = std::move(jitMod);
-        cmp_ = (RowRowCompare)jitModule_->getFuncPtr(rowRowCmpfn);
-      }
-    }
-    if (cmp_) {
-      sorter_.sort(sortedRows_.begin(), sortedRows_.end(), cmp_);
-    } else {
-#endif
-
-#ifdef ENABLE_META_SORT
-      MetaRowsSorterWraper<BufferRows>::MetaCodegenSort(
-          sortedRows_,
-          data_.get(),
-          sorter_,
-          data_->keyIndices(),
-          sortCompareFlags_);
-#else
-    sorter_.sort(
-        sortedRows_.begin(),
-        sortedRows_.end(),
-        [this](const char* leftRow, const char* rightRow) {
-          for (vector_size_t index = 0; index < sortCompareFlags_.size();
-               ++index) {
-            if (auto result = data_->compare(
-                    leftRow, rightRow, index, sortCompareFlags_[index])) {
-              return result < 0;
-            }
-          }
-          return false;
-        });
-#endif
-
-#ifdef ENABLE_BOLT_JIT
+            prefixSortConfig_.value(),
+            pool_)) {
+      sortRows();
     }
-#endif
-
   } else {
     // Spill the remaining in-memory state to disk if spilling has been
     // triggered on this sort buffer. This is to simplify query OOM prevention
@@ -205,6 +242,53 @@ void SortBuffer::noMoreInput() {
   pool_->release();
 }
 
+void SortBuffer::sortRows() {
+#ifdef ENABLE_BOLT_JIT
+  if (cmp_ == nullptr && operatorCtx_ &&
+      operatorCtx_->driverCtx()->queryConfig().enableJitRowCmpRow()) {
+    if (data_->JITable(data_->keyTypes())) {
+      auto [jitMod, rowRowCmpfn] = data_->codegenCompare(
+          data_->keyTypes(),
+          sortCompareFlags_,
+          bytedance::bolt::jit::CmpType::SORT_LESS,
+          true);
+      jitModule_ = std::move(jitMod);
+      cmp_ = (RowRowCompare)jitModule_->getFuncPtr(rowRowCmpfn);
+    }
+  }
+  if (cmp_) {
+    sorter_.sort(sortedRows_.begin(), sortedRows_.end(), cmp_);
+  } else {
+#endif
+
+#ifdef ENABLE_META_SORT
+    MetaRowsSorterWraper<BufferRows>::MetaCodegenSort(
+        sortedRows_,
+        data_.get(),
+        sorter_,
+        data_->keyIndices(),
+        sortCompareFlags_);
+#else
+  sorter_.sort(
+      sortedRows_.begin(),
+      sortedRows_.end(),
+      [this](const char* leftRow, const char* rightRow) {
+        for (vector_size_t index = 0; index < sortCompareFlags_.size();
+             ++index) {
+          if (auto result = data_->compare(
+                  leftRow, rightRow, index, sortCompareFlags_[index])) {
+            return result < 0;
+          }
+        }
+        return false;
+      });
+#endif
+
+#ifdef ENABLE_BOLT_JIT
+  }
+#endif
+}
+
 RowVectorPtr SortBuffer::getOutput(uint32_t maxOutputRows) {
   BOLT_CHECK(noMoreInput_);
 
@@ -349,7 +433,9 @@ void SortBuffer::spillInput() {
     if (sorter_.getSortAlgo() != SortAlgo::kAuto) {
       spiller_->setSortAlgo(sorter_.getSortAlgo());
     }
+    spiller_->setPrefixSortConfig(prefixSortConfig_);
   }
+  sampleSpillKeys();
   spiller_->spill();
   LOG(INFO) << (operatorCtx_ ? operatorCtx_->toString() : "SortBuffer")
             << " spill row container, data size: "
@@ -436,44 +522,18 @@ void SortBuffer::getOutputWithoutSpill() {
 void SortBuffer::getOutputWithSpill() {
   BOLT_DCHECK_EQ(sortedRows_.size(), 0);
   if (spillMerger_) {
-    BOLT_CHECK_NOT_NULL(spillMerger_);
-
-    int32_t outputRow = 0;
-    int32_t outputSize = 0;
-    bool isEndOfBatch = false;
-    while (outputRow + outputSize < output_->size()) {
-      SpillMergeStream* stream = spillMerger_->next();
-      BOLT_CHECK_NOT_NULL(stream);
-
-      spillSources_[outputSize] = &stream->current();
-      spillSourceRows_[outputSize] = stream->currentIndex(&isEndOfBatch);
-      ++outputSize;
-      if (FOLLY_UNLIKELY(isEndOfBatch)) {
-        // The stream is at end of input batch. Need to copy out the rows before
-        // fetching next batch in 'pop'.
-        gatherCopy(
-            output_.get(),
-            outputRow,
-            outputSize,
-            spillSources_,
-            spillSourceRows_,
-            columnMap_);
-        outputRow += outputSize;
-        outputSize = 0;
-      }
-      // Advance the stream.
-      stream->pop();
-    }
-    BOLT_CHECK_EQ(outputRow + outputSize, output_->size());
-
-    if (FOLLY_LIKELY(outputSize != 0)) {
-      gatherCopy(
-          output_.get(),
-          outputRow,
-          outputSize,
+    vector_size_t outputRow = 0;
+    while (outputRow < output_->size()) {
+      outputRow += copyMergedRows(
+          *spillMerger_,
+          columnMap_,
           spillSources_,
           spillSourceRows_,
-          columnMap_);
+          output_.get(),
+          outputRow);
+      if (outputRow < output_->size()) {
+        BOLT_CHECK(nextMergedRange());
+      }
     }
 
     numOutputRows_ += output_->size();
@@ -526,8 +586,13 @@ void SortBuffer::finishSpill() {
   BOLT_CHECK_NULL(spillMerger_);
   auto spillPartition = spiller_->finishSpill();
   if (spillConfig_->rowBasedSpillMode == common::RowBasedSpillMode::DISABLE) {
+    if (startRangeMerge(spillPartition)) {
+      numSpillMergeRanges_ = rangeMerges_.size() + 1;
+      return;
+    }
     spillMerger_ = spillPartition.createOrderedReader(
         pool(), spillConfig_->spillUringEnabled);
+    numSpillMergeRanges_ = 1;
   } else {
     rowBasedSpillMerger_ = spillPartition.createRowBasedOrderedReader(
         pool(),
@@ -537,4 +602,217 @@ void SortBuffer::finishSpill() {
   }
 }
 
+void SortBuffer::sampleSpillKeys() {
+  if (mergeParallelism_ <= 1 ||
+      spillConfig_->rowBasedSpillMode != common::RowBasedSpillMode::DISABLE) {
+    return;
+  }
+  const auto numRows = data_->numRows();
+  const auto step = std::max<int64_t>(1, numRows / kSpillKeySamplesPerRun);
+  std::vector<char*> samples;
+  samples.reserve(numRows / step + 1);
+  std::vector<char*> rows(kSpillKeySamplesPerRun);
+  RowContainerIterator iter;
+  int64_t numListed = 0;
+  int64_t nextSample = 0;
+  while (const auto numRead =
+             data_->listRows(&iter, rows.size(), rows.data())) {
+    for (; nextSample < numListed + numRead; nextSample += step) {
+      samples.push_back(rows[nextSample - numListed]);
+    }
+    numListed += numRead;
+  }
+
+  const auto numKeys = sortCompareFlags_.size();
+  std::vector<std::string> names;
+  std::vector<TypePtr> types;
+  std::vector<VectorPtr> keys;
+  for (column_index_t i = 0; i < numKeys; ++i) {
+    names.push_back(spillerStoreType_->nameOf(i));
+    types.push_back(spillerStoreType_->childAt(i));
+    keys.push_back(BaseVector::create(types.back(), samples.size(), pool_));
+    data_->extractColumn(samples.data(), samples.size(), i, keys.back());
+  }
+  spillKeySamples_.push_back(std::make_shared<RowVector>(
+      pool_,
+      ROW(std::move(names), std::move(types)),
+      nullptr,
+      samples.size(),
+      std::move(keys)));
+}
+
+bool SortBuffer::startRangeMerge(SpillPartition& spillPartition) {
+  if (spillKeySamples_.empty() || spillPartition.numFiles() <= 1) {
+    return false;
+  }
+  auto* executor = operatorCtx_->task()->queryCtx()->executor();
+  if (executor == nullptr) {
+    return false;
+  }
+
+  vector_size_t numSamples = 0;
+  for (const auto& runSamples : spillKeySamples_) {
+    numSamples += runSamples->size();
+  }
+  auto samples = BaseVector::create<RowVector>(
+      spillKeySamples_[0]->type(), numSamples, pool_);
+  vector_size_t offset = 0;
+  for (const auto& runSamples : spillKeySamples_) {
+    samples->copy(runSamples.get(), offset, 0, runSamples->size());
+    offset += runSamples->size();
+  }
+  spillKeySamples_.clear();
+
+  const auto compareSamples = [&](vector_size_t left, vector_size_t right) {
+    for (auto i = 0; i < sortCompareFlags_.size(); ++i) {
+      if (auto result = samples->childAt(i)
+                            ->compare(
+                                samples->childAt(i).get(),
+                                left,
+                                right,
+                                sortCompareFlags_[i])
+                            .value()) {
+        return result;
+      }
+    }
+    return 0;
+  };
+  std::vector<vector_size_t> order(numSamples);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto left, auto right) {
+    return compareSamples(left, right) < 0;
+  });
+
+  // Range bounds at evenly spaced sample quantiles. Equal quantiles would make
+  // empty ranges, so these collapse into one bound. A bound equal to the
+  // smallest sample would leave the first range empty and is skipped too.
+  std::vector<vector_size_t> bounds;
+  for (uint32_t i = 1; i < mergeParallelism_; ++i) {
+    const auto sample = order[static_cast<int64_t>(i) * numSamples /
+                              mergeParallelism_];
+    if (compareSamples(bounds.empty() ? order[0] : bounds.back(), sample) <
+        0) {
+      bounds.push_back(sample);
+    }
+  }
+  if (bounds.empty()) {
+    return false;
+  }
+  mergeBounds_ =
+      BaseVector::create<RowVector>(samples->type(), bounds.size(), pool_);
+  for (auto i = 0; i < bounds.size(); ++i) {
+    mergeBounds_->copy(samples.get(), i, bounds[i], 1);
+  }
+
+  mergePartition_ =
+      std::make_unique<SpillPartition>(std::move(spillPartition));
+  spillMerger_ = mergePartition_->createRangeOrderedReader(
+      mergeBounds_, std::nullopt, 0, pool(), spillConfig_->spillUringEnabled);
+
+  rangeMergePool_ = pool_->parent()->addLeafChild(
+      fmt::format("{}.rangeMerge", pool_->name()));
+  const auto ioConfig = spillConfig_->spillIOConfig(1);
+  const auto pathPrefix = fmt::format(
+      "{}/{}-merge", ioConfig.getSpillDirPathCb(), ioConfig.fileNamePrefix);
+  for (size_t range = 1; range <= bounds.size(); ++range) {
+    rangeMerges_.push_back(std::make_shared<AsyncSource<MergedRangeFiles>>(
+        [this, range, pathPrefix]() {
+          auto merged = std::make_unique<MergedRangeFiles>();
+          merged->files = mergeRange(range, pathPrefix);
+          return merged;
+        }));
+    executor->add([rangeMerge = rangeMerges_.back()]() {
+      rangeMerge->prepare();
+    });
+  }
+  LOG(INFO) << operatorCtx_->toString() << " merges "
+            << mergePartition_->numFiles() << " spill files in "
+            << bounds.size() + 1 << " key ranges";
+  return true;
+}
+
+SpillFiles SortBuffer::mergeRange(
+    size_t range,
+    const std::string& pathPrefix) {
+  auto* pool = rangeMergePool_.get();
+  const auto lower = static_cast<vector_size_t>(range - 1);
+  const auto upper = lower + 1 < mergeBounds_->size()
+      ? std::optional<vector_size_t>(lower + 1)
+      : std::nullopt;
+  auto merger = mergePartition_->createRangeOrderedReader(
+      mergeBounds_, lower, upper, pool, spillConfig_->spillUringEnabled);
+  SpillWriter writer(
+      spillerStoreType_,
+      sortCompareFlags_.size(),
+      sortCompareFlags_,
+      fmt::format("{}-{}", pathPrefix, range),
+      spillConfig_->maxFileSize,
+      spillConfig_->spillIOConfig(1),
+      pool,
+      &rangeMergeStats_);
+  std::vector<const RowVector*> sources(kRangeMergeBatchRows);
+  std::vector<vector_size_t> sourceRows(kRangeMergeBatchRows);
+  for (;;) {
+    auto batch = BaseVector::create<RowVector>(
+        spillerStoreType_, kRangeMergeBatchRows, pool);
+    const auto numRows =
+        copyMergedRows(*merger, {}, sources, sourceRows, batch.get(), 0);
+    if (numRows == 0) {
+      break;
+    }
+    IndexRange rows{0, numRows};
+    writer.write(batch, folly::Range<IndexRange*>(&rows, 1));
+  }
+  return writer.finish();
+}
+
+bool SortBuffer::nextMergedRange() {
+  while (nextRangeMerge_ < rangeMerges_.size()) {
+    if (spillMerger_ != nullptr) {
+      mergedRangeReadStats_.spillReadTimeUs +=
+          spillMerger_->getSpillReadTime();
+      mergedRangeReadStats_.spillDecompressTimeUs +=
+          spillMerger_->getSpillDecompressTime();
+      mergedRangeReadStats_.spillReadIOTimeUs +=
+          spillMerger_->getSpillReadIOTime();
+      spillMerger_.reset();
+    }
+
+    auto files = rangeMerges_[nextRangeMerge_++]->move();
+    BOLT_CHECK_NOT_NULL(files);
+    SpillPartition partition(mergePartition_->id(), std::move(files->files));
+    if (nextRangeMerge_ == rangeMerges_.size()) {
+      // The earlier ranges have been moved too, so no merge reads the runs.
+      removeMergePartition();
+    }
+    spillMerger_ = partition.createOrderedReader(
+        pool(), spillConfig_->spillUringEnabled);
+    if (spillMerger_ != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SortBuffer::removeMergePartition() {
+  if (mergePartition_ == nullptr) {
+    return;
+  }
+  for (const auto& file : mergePartition_->files()) {
+    filesystems::getFileSystem(file.path, nullptr)->remove(file.path);
+  }
+  mergePartition_.reset();
+}
+
+SortBuffer::MergedRangeFiles::~MergedRangeFiles() {
+  for (const auto& file : files) {
+    try {
+      filesystems::getFileSystem(file.path, nullptr)->remove(file.path);
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Failed to remove merged spill file " << file.path
+                   << ": " << e.what();
+    }
+  }
+}
+
 } // namespace bytedance::bolt::exec
@@ -34,11 +34,13 @@
 #include <cstddef>
 #include <cstdint>
 #include "Spiller.h"
+#include "bolt/common/base/AsyncSource.h"
 #include "bolt/common/base/SortStat.h"
 #include "bolt/exec/ContainerRowSerde.h"
 #include "bolt/exec/HybridSorter.h"
 #include "bolt/exec/Operator.h"
 #include "bolt/exec/OperatorUtils.h"
+#include "bolt/exec/PrefixSort.h"
 #include "bolt/exec/RowContainer.h"
 #include "bolt/exec/Spill.h"
 #include "bolt/vector/BaseVector.h"
@@ -59,6 +61,8 @@ class SortBuffer {
       uint64_t spillMemoryThreshold = 0,
       OperatorCtx* operatorCtx = nullptr);
 
+  ~SortBuffer();
+
   void addInput(const VectorPtr& input);
 
   /// Indicates no more input and triggers either of:
@@ -92,12 +96,12 @@ class SortBuffer {
 
   /// Returns the spill read stats, currently only spillReadTime supported.
   std::optional<common::SpillReadStats> spillReadStats() const {
-    common::SpillReadStats spillReadStats;
+    common::SpillReadStats spillReadStats = mergedRangeReadStats_;
     if (spillMerger_ != nullptr) {
-      spillReadStats.spillReadTimeUs = spillMerger_->getSpillReadTime();
-      spillReadStats.spillDecompressTimeUs =
+      spillReadStats.spillReadTimeUs += spillMerger_->getSpillReadTime();
+      spillReadStats.spillDecompressTimeUs +=
           spillMerger_->getSpillDecompressTime();
-      spillReadStats.spillReadIOTimeUs = spillMerger_->getSpillReadIOTime();
+      spillReadStats.spillReadIOTimeUs += spillMerger_->getSpillReadIOTime();
     } else if (rowBasedSpillMerger_ != nullptr) {
       spillReadStats.spillReadTimeUs = rowBasedSpillMerger_->getSpillReadTime();
       spillReadStats.spillDecompressTimeUs =
@@ -110,6 +114,12 @@ class SortBuffer {
     return spillReadStats;
   }
 
+  /// Returns the number of key ranges the spilled runs are merged in, or 0
+  /// if they are not merged by 'spillMerger_'.
+  uint32_t numSpillMergeRanges() const {
+    return numSpillMergeRanges_;
+  }
+
   std::optional<common::SortStats> sortStats() const {
     common::SortStats sortStats;
     sortStats.sortColToRowTimeUs = getSortColToRowTime();
@@ -148,6 +158,9 @@ class SortBuffer {
   // Ensures there is sufficient memory reserved to process 'input'.
   void ensureInputFits(const VectorPtr& input);
   void updateEstimatedOutputRowSize();
+  // Sorts 'sortedRows_' by comparing the rows when prefix sort is disabled or
+  // does not apply.
+  void sortRows();
   // Invoked to initialize or reset the reusable output buffer to get output.
   void prepareOutput(uint32_t maxOutputRows);
   void getOutputWithoutSpill();
@@ -159,6 +172,30 @@ class SortBuffer {
   // Finish spill, and we shouldn't get any rows from non-spilled partition as
   // there is only one hash partition for SortBuffer.
   void finishSpill();
+  // Samples the sort keys of the rows of 'data_' that are spilled as one
+  // sorted run.
+  void sampleSpillKeys();
+  // Picks key ranges of the sorted runs in 'spillPartition' from the sampled
+  // keys, merges the first range on the calling driver and starts merging the
+  // others on the query executor. Returns false if the runs are not merged by
+  // range, in which case 'spillPartition' is left untouched.
+  bool startRangeMerge(SpillPartition& spillPartition);
+  // The spill files written by the merge of a key range. The files are
+  // removed on destruction unless moved out to be read.
+  struct MergedRangeFiles {
+    SpillFiles files;
+
+    ~MergedRangeFiles();
+  };
+
+  // Merges the rows of range 'range' of 'mergePartition_' into new spill files
+  // whose paths start with 'pathPrefix'.
+  SpillFiles mergeRange(size_t range, const std::string& pathPrefix);
+  // Switches 'spillMerger_' to the next merged range once the current one is
+  // read. Returns false if there are no more ranges.
+  bool nextMergedRange();
+  // Removes the files of 'mergePartition_' once no range reads them.
+  void removeMergePartition();
 
   const RowTypePtr input_;
   const std::vector<CompareFlags> sortCompareFlags_;
@@ -201,6 +238,34 @@ class SortBuffer {
   std::vector<const RowVector*> spillSources_;
   std::vector<vector_size_t> spillSourceRows_;
 
+  // The number of key ranges to merge the sorted spill runs in. 1 merges all
+  // the runs through 'spillMerger_'.
+  uint32_t mergeParallelism_{1};
+  // Sort keys sampled from each spilled run. Used to pick the key ranges.
+  std::vector<RowVectorPtr> spillKeySamples_;
+  // The sorted runs being merged by key range. Their files are read by the
+  // merges of all ranges and removed after the last range starts reading.
+  std::unique_ptr<SpillPartition> mergePartition_;
+  // The sort keys that bound the ranges. Range i ends before row i.
+  RowVectorPtr mergeBounds_;
+  // Used by the range merges, which run on the query executor. A leaf pool
+  // next to 'pool_' under the same plan node pool. It has no reclaimer, so
+  // the memory of the merges in flight cannot be spilled. All ranges may be
+  // merged at once, each holding one batch per sorted run.
+  std::shared_ptr<memory::MemoryPool> rangeMergePool_;
+  // Merges of the ranges after the first into new spill files, in key order.
+  std::vector<std::shared_ptr<AsyncSource<MergedRangeFiles>>> rangeMerges_;
+  // Index into 'rangeMerges_' of the next range to read.
+  size_t nextRangeMerge_{0};
+  // The number of key ranges the spilled runs are merged in. 0 if they are
+  // not merged by 'spillMerger_'.
+  uint32_t numSpillMergeRanges_{0};
+  // Spill read stats of the mergers of the ranges that have been read.
+  common::SpillReadStats mergedRangeReadStats_;
+  // Spill write stats of the range merges. These are not added to the spill
+  // stats of the operator which count its input only.
+  folly::Synchronized<common::SpillStats> rangeMergeStats_;
+
   // Reusable output vector.
   RowVectorPtr output_;
   // Estimated size of a single output row by using the max
@@ -210,6 +275,8 @@ class SortBuffer {
   size_t numOutputRows_{0};
 
   HybridSorter sorter_;
+  // Set if the query enables prefix sort.
+  std::optional<PrefixSortConfig> prefixSortConfig_;
 
 #ifdef ENABLE_BOLT_JIT
   bolt::jit::CompiledModuleSP jitModule_;
@@ -332,6 +332,93 @@ void FileSpillMergeStream::nextBatch() {
   size_ = rowVector_->size();
 }
 
+// static
+std::unique_ptr<SpillMergeStream> RangeSpillMergeStream::create(
+    std::unique_ptr<SpillReadFile> spillFile,
+    RowVectorPtr bounds,
+    std::optional<vector_size_t> lower,
+    std::optional<vector_size_t> upper) {
+  auto* spillStream = new RangeSpillMergeStream(
+      std::move(spillFile), std::move(bounds), lower, upper);
+  spillStream->nextBatch();
+  return std::unique_ptr<SpillMergeStream>(spillStream);
+}
+
+uint32_t RangeSpillMergeStream::id() const {
+  return spillFile_->id();
+}
+
+int32_t RangeSpillMergeStream::compareToBound(
+    vector_size_t index,
+    vector_size_t bound) const {
+  const auto& flags = sortCompareFlags();
+  for (auto key = 0; key < numSortKeys(); ++key) {
+    const auto result =
+        rowVector_->childAt(key)
+            ->compare(
+                bounds_->childAt(key).get(),
+                index,
+                bound,
+                flags.empty() ? CompareFlags() : flags[key])
+            .value();
+    if (result != 0) {
+      return result;
+    }
+  }
+  return 0;
+}
+
+vector_size_t RangeSpillMergeStream::lowerBound(
+    vector_size_t begin,
+    vector_size_t end,
+    vector_size_t bound) const {
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (compareToBound(middle, bound) < 0) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+void RangeSpillMergeStream::nextBatch() {
+  MicrosecondTimer timer(&spillReadTimeUs_);
+  index_ = 0;
+  size_ = 0;
+  if (atUpper_) {
+    return;
+  }
+  while (spillFile_->nextBatch(rowVector_)) {
+    vector_size_t begin = 0;
+    vector_size_t end = rowVector_->size();
+    if (end == 0) {
+      continue;
+    }
+    if (lower_.has_value() && !pastLower_) {
+      if (compareToBound(end - 1, lower_.value()) < 0) {
+        continue;
+      }
+      begin = lowerBound(0, end, lower_.value());
+      pastLower_ = true;
+    }
+    if (upper_.has_value() && compareToBound(end - 1, upper_.value()) >= 0) {
+      end = lowerBound(begin, end, upper_.value());
+      atUpper_ = true;
+      spillReadIOTimeUs_ += spillFile_->getSpillReadIOTime();
+      // Ends the batch at the last row in range so that callers see that row
+      // as the last one of the batch.
+      rowVector_ =
+          std::static_pointer_cast<RowVector>(rowVector_->slice(0, end));
+    }
+    index_ = begin;
+    size_ = end;
+    return;
+  }
+  spillReadIOTimeUs_ += spillFile_->getSpillReadIOTime();
+}
+
 std::unique_ptr<TreeOfLosers<SpillMergeStream>>
 SpillPartition::createOrderedReader(
     memory::MemoryPool* pool,
@@ -353,6 +440,28 @@ SpillPartition::createOrderedReader(
   return std::make_unique<TreeOfLosers<SpillMergeStream>>(std::move(streams));
 }
 
+std::unique_ptr<TreeOfLosers<SpillMergeStream>>
+SpillPartition::createRangeOrderedReader(
+    const RowVectorPtr& bounds,
+    std::optional<vector_size_t> lower,
+    std::optional<vector_size_t> upper,
+    memory::MemoryPool* pool,
+    bool spillUringEnabled) const {
+  std::vector<std::unique_ptr<SpillMergeStream>> streams;
+  streams.reserve(files_.size());
+  for (const auto& fileInfo : files_) {
+    streams.push_back(RangeSpillMergeStream::create(
+        SpillReadFile::create(fileInfo, pool, spillUringEnabled),
+        bounds,
+        lower,
+        upper));
+  }
+  if (FOLLY_UNLIKELY(streams.empty())) {
+    return nullptr;
+  }
+  return std::make_unique<TreeOfLosers<SpillMergeStream>>(std::move(streams));
+}
+
 std::unique_ptr<TreeOfLosers<RowBasedSpillMergeStream>>
 SpillPartition::createRowBasedOrderedReader(
     memory::MemoryPool* pool,
@@ -215,6 +215,68 @@ class FileSpillMergeStream : public SpillMergeStream {
   std::unique_ptr<SpillReadFile> spillFile_;
 };
 
+// A source of the rows of a sorted spill file whose sort keys are in a key
+// range. The range starts at row 'lower' of 'bounds' inclusive and ends at row
+// 'upper' exclusive, where 'bounds' holds the sort key columns of the file and
+// an unset bound leaves that side open. Spill files have no index to seek in,
+// so batches are read from the start but the ones that end below 'lower' are
+// skipped without comparing their rows, and the file is not read past the
+// first batch that reaches 'upper'. Unlike FileSpillMergeStream, the file is
+// not removed on destruction as the streams of the other ranges read it too.
+class RangeSpillMergeStream : public SpillMergeStream {
+ public:
+  static std::unique_ptr<SpillMergeStream> create(
+      std::unique_ptr<SpillReadFile> spillFile,
+      RowVectorPtr bounds,
+      std::optional<vector_size_t> lower,
+      std::optional<vector_size_t> upper);
+
+  uint32_t id() const override;
+
+ private:
+  RangeSpillMergeStream(
+      std::unique_ptr<SpillReadFile> spillFile,
+      RowVectorPtr bounds,
+      std::optional<vector_size_t> lower,
+      std::optional<vector_size_t> upper)
+      : spillFile_(std::move(spillFile)),
+        bounds_(std::move(bounds)),
+        lower_(lower),
+        upper_(upper) {
+    BOLT_CHECK_NOT_NULL(spillFile_);
+    BOLT_CHECK_NOT_NULL(bounds_);
+  }
+
+  int32_t numSortKeys() const override {
+    return spillFile_->numSortKeys();
+  }
+
+  const std::vector<CompareFlags>& sortCompareFlags() const override {
+    return spillFile_->sortCompareFlags();
+  }
+
+  void nextBatch() override;
+
+  // Compares the sort keys of row 'index' of 'rowVector_' with row 'bound' of
+  // 'bounds_'.
+  int32_t compareToBound(vector_size_t index, vector_size_t bound) const;
+
+  // Returns the first row of 'rowVector_' in ['begin', 'end') whose keys are
+  // not less than row 'bound' of 'bounds_', or 'end' if there is none.
+  vector_size_t
+  lowerBound(vector_size_t begin, vector_size_t end, vector_size_t bound)
+      const;
+
+  std::unique_ptr<SpillReadFile> spillFile_;
+  const RowVectorPtr bounds_;
+  const std::optional<vector_size_t> lower_;
+  const std::optional<vector_size_t> upper_;
+  // True once a row at or above 'lower_' has been read.
+  bool pastLower_{false};
+  // True once a row at or above 'upper_' has been read.
+  bool atUpper_{false};
+};
+
 // A source of sorted spilled rows coming either from a file or memory.
 class RowBasedSpillMergeStream : public MergeStream {
  public:
@@ -740,6 +802,18 @@ class SpillPartition {
       memory::MemoryPool* pool,
       bool spillUringEnabled = false);
 
+  /// Invoked to create an ordered stream reader of the rows whose sort keys
+  /// are in the range from row 'lower' of 'bounds' inclusive to row 'upper'
+  /// exclusive. Unlike createOrderedReader(), the spill files are kept so that
+  /// the readers of the other ranges can be created from them, and the caller
+  /// removes the files once all the ranges are read.
+  std::unique_ptr<TreeOfLosers<SpillMergeStream>> createRangeOrderedReader(
+      const RowVectorPtr& bounds,
+      std::optional<vector_size_t> lower,
+      std::optional<vector_size_t> upper,
+      memory::MemoryPool* pool,
+      bool spillUringEnabled = false) const;
+
   std::unique_ptr<TreeOfLosers<RowBasedSpillMergeStream>>
   createRowBasedOrderedReader(
       memory::MemoryPool* pool,
@@ -433,67 +433,78 @@ void Spiller::ensureSorted(SpillRun& run) {
         compareFlags.emplace_back(CompareFlags());
     }
 
-#ifdef ENABLE_BOLT_JIT
-    if (cmp_ == nullptr && spillConfig_ &&
-        spillConfig_->getJITenabledForSpill()) {
-      if (container_->JITable(container_->keyTypes())) {
-        auto [jitMod, rowRowCmpfn] = container_->codegenCompare(
-            container_->keyTypes(),
+    // The spill memory pool keeps the normalized keys out of the memory of
+    // the operator being reclaimed.
+    if (!prefixSortConfig_.has_value() ||
+        !PrefixSort::sort(
+            folly::Range(run.rows.data(), run.rows.size()),
+            container_,
+            container_->keyIndices(),
             noFlags ? compareFlags : state_.sortCompareFlags(),
-            bytedance::bolt::jit::CmpType::SORT_LESS,
-            true);
-        jitModule_ = std::move(jitMod);
-        cmp_ = (RowRowCompare)jitModule_->getFuncPtr(rowRowCmpfn);
+            prefixSortConfig_.value(),
+            memory::spillMemoryPool())) {
+#ifdef ENABLE_BOLT_JIT
+      if (cmp_ == nullptr && spillConfig_ &&
+          spillConfig_->getJITenabledForSpill()) {
+        if (container_->JITable(container_->keyTypes())) {
+          auto [jitMod, rowRowCmpfn] = container_->codegenCompare(
+              container_->keyTypes(),
+              noFlags ? compareFlags : state_.sortCompareFlags(),
+              bytedance::bolt::jit::CmpType::SORT_LESS,
+              true);
+          jitModule_ = std::move(jitMod);
+          cmp_ = (RowRowCompare)jitModule_->getFuncPtr(rowRowCmpfn);
+        }
       }
-    }
-    if (cmp_) {
+      if (cmp_) {
 #if DEBUG_JIT
-      sorter_.sort(
-          run.rows.begin(),
-          run.rows.end(),
-          [&](const char* left, const char* right) {
-            auto expected = container_->compareRows(
-                                left, right, state_.sortCompareFlags()) < 0;
-            auto res = cmp_(left, right) > 0;
-            bool jitEqual = (int)res > 0; // as cmp_ may return 255 for true
-            if ((expected != jitEqual)) {
-              std::stringstream ss;
-              ss << " spill sort expected: " << (int)expected
-                 << " jitEqual: " << (int)jitEqual
-                 << " left: " << container_->toString(left)
-                 << " right: " << container_->toString(right) << std::endl;
-              std::cerr << ss.str() << std::endl;
-              BOLT_CHECK(false);
-            }
-            return expected;
-          });
+        sorter_.sort(
+            run.rows.begin(),
+            run.rows.end(),
+            [&](const char* left, const char* right) {
+              auto expected = container_->compareRows(
+                                  left, right, state_.sortCompareFlags()) < 0;
+              auto res = cmp_(left, right) > 0;
+              bool jitEqual = (int)res > 0; // as cmp_ may return 255 for true
+              if ((expected != jitEqual)) {
+                std::stringstream ss;
+                ss << " spill sort expected: " << (int)expected
+                   << " jitEqual: " << (int)jitEqual
+                   << " left: " << container_->toString(left)
+                   << " right: " << container_->toString(right) << std::endl;
+                std::cerr << ss.str() << std::endl;
+                BOLT_CHECK(false);
+              }
+              return expected;
+            });
 #else
-      sorter_.sort(run.rows.begin(), run.rows.end(), cmp_);
+        sorter_.sort(run.rows.begin(), run.rows.end(), cmp_);
 #endif
-    } else {
+      } else {
 #endif
 
 #ifdef ENABLE_META_SORT
-      MetaRowsSorterWraper<SpillRows>::MetaCodegenSort(
-          run.rows,
-          container_,
-          sorter_,
-          container_->keyIndices(),
-          noFlags ? compareFlags : state_.sortCompareFlags());
+        MetaRowsSorterWraper<SpillRows>::MetaCodegenSort(
+            run.rows,
+            container_,
+            sorter_,
+            container_->keyIndices(),
+            noFlags ? compareFlags : state_.sortCompareFlags());
 #else
-    sorter_.sort(
-        run.rows.begin(),
-        run.rows.end(),
-        [&](const char* left, const char* right) {
-          return container_->compareRows(
-                     left, right, state_.sortCompareFlags()) < 0;
-        });
+      sorter_.sort(
+          run.rows.begin(),
+          run.rows.end(),
+          [&](const char* left, const char* right) {
+            return container_->compareRows(
+                       left, right, state_.sortCompareFlags()) < 0;
+          });
 
 #endif
 
 #ifdef ENABLE_BOLT_JIT
-    }
+      }
 #endif
+    }
 
     run.sorted = true;
   }
@@ -33,6 +33,7 @@
 #include "bolt/common/base/SpillConfig.h"
 #include "bolt/common/compression/Compression.h"
 #include "bolt/exec/HashBitRange.h"
+#include "bolt/exec/PrefixSort.h"
 #include "bolt/exec/RowContainer.h"
 #include "bolt/exec/Spill.h"
 
@@ -246,6 +247,11 @@ class Spiller {
     sorter_ = HybridSorter{algo};
   }
 
+  /// Sorts the spill runs with prefix sort if 'config' is set.
+  void setPrefixSortConfig(std::optional<PrefixSortConfig> config) {
+    prefixSortConfig_ = std::move(config);
+  }
+
   const RowContainer* container() const {
     return container_;
   }
@@ -426,6 +432,7 @@ class Spiller {
   common::SpillConfig* spillConfig_{nullptr};
 
   HybridSorter sorter_;
+  std::optional<PrefixSortConfig> prefixSortConfig_;
 
   bool supportSkewPartition_{false};
   bool rangePartitioningApplicable_{false};
@@ -300,6 +300,13 @@ RowVectorPtr TableScan::getOutput() {
         for (const auto& entry : pendingDynamicFilters_) {
           dataSource_->addDynamicFilter(entry.first, entry.second);
         }
+        if (!metadataAggregates_.empty()) {
+          metadataAggregatesPushed_ =
+              dataSource_->pushdownMetadataAggregates(metadataAggregates_);
+          stats_.wlock()->addRuntimeStat(
+              "metadataAggregatesPushed",
+              RuntimeCounter(metadataAggregatesPushed_));
+        }
       }
 
       debugString_ = fmt::format(
@@ -492,8 +499,11 @@ void TableScan::preload(std::shared_ptr<connector::ConnectorSplit> split) {
 
 void TableScan::checkPreload() {
   auto executor = connector_->executor();
+  // Preloaded splits are read by data sources the aggregates were not pushed
+  // into.
   if (maxSplitPreloadPerDriver_ == 0 || !executor ||
-      !connector_->supportsSplitPreload() || !asyncThreadCtx_.allowPreload()) {
+      !connector_->supportsSplitPreload() || !asyncThreadCtx_.allowPreload() ||
+      !metadataAggregates_.empty()) {
     return;
   }
   if (dataSource_->allPrefetchIssued()) {
@@ -517,6 +527,20 @@ bool TableScan::isFinished() {
   return noMoreSplits_;
 }
 
+void TableScan::pushdownMetadataAggregates(
+    std::vector<connector::MetadataAggregate> aggregates) {
+  BOLT_CHECK_NULL(
+      dataSource_, "Metadata aggregates must be pushed down before any split");
+  metadataAggregates_ = std::move(aggregates);
+}
+
+std::vector<variant> TableScan::takeMetadataAggregates() {
+  if (!metadataAggregatesPushed_) {
+    return {};
+  }
+  return dataSource_->takeMetadataAggregates();
+}
+
 void TableScan::addDynamicFilter(
     const core::PlanNodeId& producer,
     column_index_t outputChannel,
@@ -67,6 +67,17 @@ class TableScan : public SourceOperator {
       column_index_t outputChannel,
       const std::shared_ptr<common::Filter>& filter) override;
 
+  /// Asks the data source to answer 'aggregates' over the output of this scan
+  /// from file metadata, see DataSource::pushdownMetadataAggregates(). Must
+  /// be called before the first split. Disables split preloading.
+  void pushdownMetadataAggregates(
+      std::vector<connector::MetadataAggregate> aggregates);
+
+  /// Returns the partial results the data source computed from metadata, one
+  /// per pushed down aggregate, or an empty vector if the data source did not
+  /// accept the aggregates.
+  std::vector<variant> takeMetadataAggregates();
+
   /// Returns process-wide cumulative IO wait time for all table
   /// scan. This is the blocked time. If running entirely from memory
   /// this would be 0.
@@ -124,6 +135,11 @@ class TableScan : public SourceOperator {
   std::unordered_map<column_index_t, std::shared_ptr<common::Filter>>
       pendingDynamicFilters_;
 
+  // Aggregates to push down into the data source when it gets created.
+  std::vector<connector::MetadataAggregate> metadataAggregates_;
+  // True if the data source accepted 'metadataAggregates_'.
+  bool metadataAggregatesPushed_{false};
+
   int32_t maxPreloadedSplits_{0};
 
   const int32_t maxSplitPreloadPerDriver_{0};
@@ -318,6 +318,7 @@ Task::Task(
       queryCtx_(std::move(queryCtx)),
       planFragment_(std::move(planFragment)),
       traceConfig_(maybeMakeTraceConfig()),
+      batchSizeController_(BatchSizeController::create(*queryCtx_)),
       consumerSupplier_(std::move(consumerSupplier)),
       onError_(onError),
       splitsStates_(buildSplitStates(planFragment_.planNode)),
@@ -1660,10 +1661,41 @@ BlockingReason Task::getSplitOrFutureLocked(
     return BlockingReason::kWaitForSplit;
   }
 
+  // Splits are divided before they start preloading so that the preloaded
+  // data sources read only the first part.
+  divideSplitsLocked(splitsStore, std::max<int32_t>(1, maxPreloadSplits));
   split = getSplitLocked(splitsStore, maxPreloadSplits, preload);
   return BlockingReason::kNotBlocked;
 }
 
+void Task::divideSplitsLocked(SplitsStore& splitsStore, int32_t numSplits) {
+  const auto targetBytes = queryCtx_->queryConfig().tableScanSubSplitBytes();
+  if (targetBytes == 0) {
+    return;
+  }
+  for (auto i = 0; i < splitsStore.splits.size() && i < numSplits; ++i) {
+    auto& split = splitsStore.splits[i];
+    if (!split.hasConnectorSplit() ||
+        split.connectorSplit->dataSource != nullptr ||
+        split.multiSplitInnerSize != 1) {
+      continue;
+    }
+    auto parts = split.connectorSplit->divide(targetBytes);
+    if (parts.empty()) {
+      continue;
+    }
+    BOLT_CHECK_EQ(parts.size(), 2);
+    const auto groupId = split.groupId;
+    split = exec::Split(std::move(parts[0]), groupId);
+    // The rest is divided again when it gets within the first 'numSplits'.
+    splitsStore.splits.insert(
+        splitsStore.splits.begin() + i + 1,
+        exec::Split(std::move(parts[1]), groupId));
+    ++taskStats_.numTotalSplits;
+    ++taskStats_.numQueuedSplits;
+  }
+}
+
 exec::Split Task::getSplitLocked(
     SplitsStore& splitsStore,
     int32_t maxPreloadSplits,
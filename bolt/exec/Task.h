@@ -31,6 +31,7 @@
 #pragma once
 #include "bolt/core/PlanFragment.h"
 #include "bolt/core/QueryCtx.h"
+#include "bolt/exec/BatchSizeController.h"
 #include "bolt/exec/Driver.h"
 #include "bolt/exec/ExecutorTaskScheduler.h"
 #include "bolt/exec/LocalPartition.h"
@@ -161,6 +162,13 @@ class Task : public std::enable_shared_from_this<Task> {
     return traceConfig_;
   }
 
+  /// Returns the controller that scales the output batch sizes of the
+  /// operators of this task, or nullptr if 'adaptive_output_batch_sizing' is
+  /// not set.
+  BatchSizeController* batchSizeController() const {
+    return batchSizeController_.get();
+  }
+
   /// Returns ConsumerSupplier passed in the constructor.
   ConsumerSupplier consumerSupplier() const {
     return consumerSupplier_;
@@ -923,6 +931,12 @@ class Task : public std::enable_shared_from_this<Task> {
       std::function<void(std::shared_ptr<connector::ConnectorSplit>)> preload =
           nullptr);
 
+  /// Divides the first 'numSplits' splits of the store that are larger than
+  /// QueryConfig::tableScanSubSplitBytes() and are not preloading into parts
+  /// of that size. Each divided split is replaced by its first part followed
+  /// by the rest, so that the rest goes to the next driver asking for a split.
+  void divideSplitsLocked(SplitsStore& splitsStore, int32_t numSplits);
+
   /// Returns next split from the store. The caller must ensure the store is not
   /// empty.
   exec::Split getSplitLocked(
@@ -1117,6 +1131,8 @@ class Task : public std::enable_shared_from_this<Task> {
 
   const std::optional<trace::TraceConfig> traceConfig_;
 
+  const std::unique_ptr<BatchSizeController> batchSizeController_;
+
   // Root MemoryPool for this Task. All member variables that hold references
   // to pool_ must be defined after pool_, childPools_.
   std::shared_ptr<memory::MemoryPool> pool_;
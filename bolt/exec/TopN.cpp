@@ -31,9 +31,45 @@
 #include <folly/container/F14Map.h>
 
 #include "bolt/exec/ContainerRowSerde.h"
+#include "bolt/exec/Driver.h"
 #include "bolt/exec/TopN.h"
+#include "bolt/type/Filter.h"
 #include "bolt/vector/FlatVector.h"
 namespace bytedance::bolt::exec {
+namespace {
+
+// Returns true if the leading sorting key can be filtered with a range that
+// orders like the key. Floating point keys are excluded because NaN sorts
+// after all other values but fails every range, decimals because their
+// filters depend on the precision.
+bool canFilterSortingKey(const TypePtr& type) {
+  if (type->isDecimal()) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::TIMESTAMP:
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+std::unique_ptr<common::Filter>
+makeBigintFilter(int64_t value, bool ascending, bool nullAllowed) {
+  return std::make_unique<common::BigintRange>(
+      ascending ? std::numeric_limits<int64_t>::min() : value,
+      ascending ? value : std::numeric_limits<int64_t>::max(),
+      nullAllowed);
+}
+
+} // namespace
+
 TopN::TopN(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -52,6 +88,7 @@ TopN::TopN(
           topNNode->sortingOrders(),
           data_.get()),
       topRows_(comparator_),
+      leadingKeyOrder_(topNNode->sortingOrders()[0]),
       decodedVectors_(outputType_->children().size()) {
   const auto numColumns{outputType_->children().size()};
   const auto numSortingKeys{topNNode->sortingKeys().size()};
@@ -61,6 +98,19 @@ TopN::TopN(
     sortingKeyColumns_.emplace_back(exprToChannel(key.get(), outputType_));
     isSortingKey[sortingKeyColumns_.back()] = true;
   }
+  prefixSortConfig_ =
+      PrefixSort::config(operatorCtx_->driverCtx()->queryConfig());
+  if (prefixSortConfig_.has_value()) {
+    sortingCompareFlags_.reserve(numSortingKeys);
+    for (const auto& order : topNNode->sortingOrders()) {
+      sortingCompareFlags_.push_back(
+          {.nullsFirst = order.isNullsFirst(),
+           .ascending = order.isAscending()});
+    }
+  }
+  dynamicFilterEnabled_ =
+      operatorCtx_->driverCtx()->queryConfig().topNDynamicFilterEnabled() &&
+      canFilterSortingKey(outputType_->childAt(sortingKeyColumns_[0]));
   if (numColumns > numSortingKeys) {
     nonKeyColumns_.reserve(numColumns - numSortingKeys);
     for (column_index_t i = 0; i < numColumns; ++i) {
@@ -72,11 +122,20 @@ TopN::TopN(
 }
 
 void TopN::addInput(RowVectorPtr input) {
+  if (dynamicFilterEnabled_ && !dynamicFilterChecked_) {
+    dynamicFilterChecked_ = true;
+    dynamicFilterEnabled_ =
+        !operatorCtx_->driverCtx()
+             ->driver->canPushdownFilters(this, {sortingKeyColumns_[0]})
+             .empty();
+  }
+
   for (const auto col : sortingKeyColumns_) {
     decodedVectors_[col].decode(*input->childAt(col));
   }
 
   const bool hasNonKeyColumn{!nonKeyColumns_.empty()};
+  bool topRowsChanged{false};
   // Maps passed rows of 'data_' to the corresponding input row number. These
   // input rows of non-key columns are later stored into data_.
   folly::F14FastMap<void*, vector_size_t> passedRows;
@@ -101,11 +160,22 @@ void TopN::addInput(RowVectorPtr input) {
     }
 
     topRows_.push(newRow);
+    topRowsChanged = true;
     if (hasNonKeyColumn) {
       passedRows[newRow] = row;
     }
   }
 
+  // Once there are 'count_' rows, rows that sort after the last of them on
+  // the leading key cannot make the top rows. The range includes the key of
+  // the last row, so ties are still decided by the other keys. The source
+  // intersects it with the filters pushed earlier.
+  if (dynamicFilterEnabled_ && topRowsChanged && topRows_.size() == count_) {
+    if (auto filter = makeDynamicFilter()) {
+      dynamicFilters_[sortingKeyColumns_[0]] = std::move(filter);
+    }
+  }
+
   if (hasNonKeyColumn && !passedRows.empty()) {
     for (const auto col : nonKeyColumns_) {
       decodedVectors_[col].decode(*input->childAt(col));
@@ -120,6 +190,61 @@ void TopN::addInput(RowVectorPtr input) {
   }
 }
 
+std::unique_ptr<common::Filter> TopN::makeDynamicFilter() const {
+  const char* row = topRows_.top();
+  const auto column = data_->columnAt(sortingKeyColumns_[0]);
+  const bool nullsFirst = leadingKeyOrder_.isNullsFirst();
+  if (RowContainer::isNullAt(row, column)) {
+    // All the top rows have null keys. Non-null keys sort after them only if
+    // nulls come first.
+    if (nullsFirst) {
+      return std::make_unique<common::IsNull>();
+    }
+    return nullptr;
+  }
+
+  const bool ascending = leadingKeyOrder_.isAscending();
+  const auto offset = column.offset();
+  switch (outputType_->childAt(sortingKeyColumns_[0])->kind()) {
+    case TypeKind::TINYINT:
+      return makeBigintFilter(
+          RowContainer::valueAt<int8_t>(row, offset), ascending, nullsFirst);
+    case TypeKind::SMALLINT:
+      return makeBigintFilter(
+          RowContainer::valueAt<int16_t>(row, offset), ascending, nullsFirst);
+    case TypeKind::INTEGER:
+      return makeBigintFilter(
+          RowContainer::valueAt<int32_t>(row, offset), ascending, nullsFirst);
+    case TypeKind::BIGINT:
+      return makeBigintFilter(
+          RowContainer::valueAt<int64_t>(row, offset), ascending, nullsFirst);
+    case TypeKind::TIMESTAMP: {
+      const auto value = RowContainer::valueAt<Timestamp>(row, offset);
+      return std::make_unique<common::TimestampRange>(
+          ascending ? Timestamp::min() : value,
+          ascending ? value : Timestamp::max(),
+          nullsFirst);
+    }
+    case TypeKind::VARCHAR:
+    case TypeKind::VARBINARY: {
+      std::string storage;
+      const auto view = HashStringAllocator::contiguousString(
+          RowContainer::valueAt<StringView>(row, offset), storage);
+      std::string value(view.data(), view.size());
+      return std::make_unique<common::BytesRange>(
+          ascending ? "" : value,
+          ascending,
+          false,
+          ascending ? value : "",
+          !ascending,
+          false,
+          nullsFirst);
+    }
+    default:
+      BOLT_UNREACHABLE();
+  }
+}
+
 RowVectorPtr TopN::getOutput() {
   if (finished_ || !noMoreInput_) {
     return nullptr;
@@ -151,9 +276,24 @@ void TopN::noMoreInput() {
     return;
   }
   rows_.resize(topRows_.size());
-  for (auto i = rows_.size(); i > 0; --i) {
-    rows_[i - 1] = topRows_.top();
-    topRows_.pop();
+  if (prefixSortConfig_.has_value()) {
+    // The rows popped from 'topRows_' are reused for new ones, so 'data_'
+    // holds exactly the rows in 'topRows_'.
+    RowContainerIterator iter;
+    data_->listRows(&iter, rows_.size(), rows_.data());
+  }
+  if (!prefixSortConfig_.has_value() ||
+      !PrefixSort::sort(
+          folly::Range(rows_.data(), rows_.size()),
+          data_.get(),
+          sortingKeyColumns_,
+          sortingCompareFlags_,
+          prefixSortConfig_.value(),
+          pool())) {
+    for (auto i = rows_.size(); i > 0; --i) {
+      rows_[i - 1] = topRows_.top();
+      topRows_.pop();
+    }
   }
 
   outputBatchSize_ = outputBatchRows(data_->estimateRowSize());
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "bolt/exec/Operator.h"
+#include "bolt/exec/PrefixSort.h"
 #include "bolt/exec/RowContainer.h"
 namespace bytedance::bolt::exec {
 
@@ -58,6 +59,11 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Returns a filter on the leading sorting key that passes all rows that may
+  // still make the top 'count_' rows, or nullptr if every row may. Must be
+  // called only when 'topRows_' holds 'count_' rows.
+  std::unique_ptr<common::Filter> makeDynamicFilter() const;
+
   const int32_t count_;
 
   bool finished_ = false;
@@ -80,6 +86,21 @@ class TopN : public Operator {
   std::priority_queue<char*, std::vector<char*>, RowComparator> topRows_;
   std::vector<char*> rows_;
 
+  // If set, 'rows_' are ordered with prefix sort instead of by draining
+  // 'topRows_'. 'sortingCompareFlags_' are the orders of
+  // 'sortingKeyColumns_'.
+  std::optional<PrefixSortConfig> prefixSortConfig_;
+  std::vector<CompareFlags> sortingCompareFlags_;
+
+  // Order of the leading sorting key.
+  const core::SortOrder leadingKeyOrder_;
+
+  // True while the leading sorting key value of the last of the top rows is
+  // pushed down to the source as a dynamic filter. Decided with the
+  // Driver on the first input.
+  bool dynamicFilterEnabled_;
+  bool dynamicFilterChecked_{false};
+
   std::vector<DecodedVector> decodedVectors_;
   vector_size_t outputBatchSize_;
 };
@@ -234,6 +234,8 @@ void Window::initialize() {
   }
   createPeerAndFrameBuffers();
   windowBuild_->setNumRowsPerOutput(numRowsPerOutput_);
+  windowBuild_->setPrefixSortConfig(
+      PrefixSort::config(operatorCtx_->driverCtx()->queryConfig()));
   windowNode_.reset();
 }
 
@@ -224,6 +224,17 @@ void WindowBuild::sortPartitions() {
   RowContainerIterator iter;
   data_->listRows(&iter, numRows_, sortRows_.data());
 
+  if (prefixSortConfig_.has_value() &&
+      PrefixSort::sort(
+          folly::Range(sortRows_.data(), sortRows_.size()),
+          data_.get(),
+          data_->keyIndices(),
+          sortSpillCompareFlags_,
+          prefixSortConfig_.value(),
+          pool_)) {
+    return;
+  }
+
 #ifdef ENABLE_BOLT_JIT
   if (cmp_ == nullptr && enableJit_) {
     if (data_->JITable(data_->keyTypes())) {
@@ -349,6 +360,7 @@ void WindowBuild::setupSortSpiller() {
       sortSpillCompareFlags_,
       spillConfig_);
   sortSpiller_->setSpillConfig(spillConfig_);
+  sortSpiller_->setPrefixSortConfig(prefixSortConfig_);
 }
 
 void WindowBuild::sortSpill() {
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <exec/Spiller.h>
+#include "bolt/exec/PrefixSort.h"
 #include "bolt/exec/RowContainer.h"
 #include "bolt/exec/WindowPartition.h"
 namespace bytedance::bolt::exec {
@@ -148,6 +149,11 @@ class WindowBuild {
     maxOutputRows_ = maxOutputRows;
   }
 
+  // Sorts the input and the spill runs with prefix sort if 'config' is set.
+  void setPrefixSortConfig(std::optional<PrefixSortConfig> config) {
+    prefixSortConfig_ = std::move(config);
+  }
+
   virtual void resetSpiller() {}
 
   void setNumRowsPerOutput(vector_size_t numRowsPerOutput) {
@@ -253,6 +259,7 @@ class WindowBuild {
   bolt::jit::CompiledModuleSP jitModule_;
 #endif
   HybridSorter sorter_;
+  std::optional<PrefixSortConfig> prefixSortConfig_;
   RowRowCompare cmp_{nullptr};
 
   // The maximum size that an SortBuffer can hold in memory before spilling.
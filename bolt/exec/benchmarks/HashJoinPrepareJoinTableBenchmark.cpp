@@ -49,18 +49,21 @@ struct HashTableBenchmarkParams {
   //  -the build row schema,
   //  -the expected hash table size,
   //  -number of building rows,
-  //  -number of build RowContainers.
+  //  -number of build RowContainers,
+  //  -the byte limit for compacting the table after preparing it, 0 for none.
   HashTableBenchmarkParams(
       BaseHashTable::HashMode mode,
       const TypePtr& buildType,
       int64_t hashTableSize,
       int64_t buildSize,
-      int32_t numWays)
+      int32_t numWays,
+      uint64_t compactTableMaxBytes = 0)
       : mode{mode},
         buildType{buildType},
         hashTableSize{hashTableSize},
         buildSize{buildSize},
-        numWays{numWays} {
+        numWays{numWays},
+        compactTableMaxBytes{compactTableMaxBytes} {
     BOLT_CHECK_LE(hashTableSize, buildSize);
     BOLT_CHECK_GE(numWays, 1);
 
@@ -79,11 +82,12 @@ struct HashTableBenchmarkParams {
     }
 
     title = fmt::format(
-        "Size:{},parallel:{},withDup:{},{}",
+        "Size:{},parallel:{},withDup:{},{}{}",
         buildSize,
         numWays > 1,
         buildSize > hashTableSize,
-        BaseHashTable::modeString(mode));
+        BaseHashTable::modeString(mode),
+        compactTableMaxBytes > 0 ? ",compact" : "");
   }
 
   // Expected mode.
@@ -101,6 +105,9 @@ struct HashTableBenchmarkParams {
   // Number of build RowContainers.
   int32_t numWays;
 
+  // Passed to compactJoinTable() after prepareJoinTable() if not 0.
+  uint64_t compactTableMaxBytes;
+
   // Title for reporting
   std::string title;
 
@@ -137,10 +144,13 @@ class HashJoinPrepareJoinTableBenchmark : public VectorTestBase {
     createTable();
   }
 
-  // Run 'prepareJoinTable'.
+  // Run 'prepareJoinTable' and 'compactJoinTable' if set.
   void run() {
     topTable_->prepareJoinTable(std::move(otherTables_), executor_.get());
     BOLT_CHECK_EQ(topTable_->hashMode(), params_.mode);
+    if (params_.compactTableMaxBytes > 0) {
+      BOLT_CHECK(topTable_->compactJoinTable(params_.compactTableMaxBytes));
+    }
   }
 
  private:
@@ -308,6 +318,27 @@ void initHashModeBenchmarkParams(
     }
   }
 }
+// Small kHash mode build sides as in joins with dimension tables, prepared
+// with and without copying the rows into a compact block.
+void initDimensionTableBenchmarkParams(
+    std::vector<HashTableBenchmarkParams>& params) {
+  TypePtr threeKeyType{ROW({"k1", "k2", "k3"}, {BIGINT(), BIGINT(), BIGINT()})};
+  std::vector<int64_t> buildSizeVector = {10'000, 50'000};
+  std::vector<int64_t> numTablesVector = {1, 8};
+  for (auto buildSize : buildSizeVector) {
+    for (auto numTables : numTablesVector) {
+      for (uint64_t compactTableMaxBytes : {0, 16 << 20}) {
+        params.push_back(HashTableBenchmarkParams(
+            BaseHashTable::HashMode::kHash,
+            threeKeyType,
+            buildSize,
+            buildSize,
+            numTables,
+            compactTableMaxBytes));
+      }
+    }
+  }
+}
 } // namespace
 
 int main(int argc, char** argv) {
@@ -324,6 +355,7 @@ int main(int argc, char** argv) {
   // initArrayModeBenchmarkParams(params);
   initNormalizedKeyModeBenchmarkParams(params);
   initHashModeBenchmarkParams(params);
+  initDimensionTableBenchmarkParams(params);
 
   for (auto& param : params) {
     folly::addBenchmark(__FILE__, param.title, [param, &bm]() {
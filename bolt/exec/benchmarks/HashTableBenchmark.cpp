@@ -73,9 +73,13 @@ struct HashTableBenchmarkParams {
   // Title for reporting
   std::string title;
 
-  // Expected mode.
+  // Expected mode. If kHash, the tables are kept in kHash mode regardless of
+  // the keys.
   BaseHashTable::HashMode mode{BaseHashTable::HashMode::kNormalizedKey};
 
+  // Passed to compactJoinTable() after prepareJoinTable() if not 0.
+  uint64_t compactTableMaxBytes{0};
+
   int64_t buildSize;
 
   // Number of distinct probe rows. Not all are necessarily in the table.
@@ -192,7 +196,9 @@ class HashTableBenchmark : public VectorTestBase {
           dependentTypes,
           true,
           false,
-          BaseHashTable::HashMode::kArray,
+          params_.mode == BaseHashTable::HashMode::kHash
+              ? BaseHashTable::HashMode::kHash
+              : BaseHashTable::HashMode::kArray,
           1'000,
           pool_.get(),
           params.enableJitRowEqVectors);
@@ -209,6 +215,8 @@ class HashTableBenchmark : public VectorTestBase {
       startOffset += params_.size;
     }
     topTable_->prepareJoinTable(std::move(otherTables), executor_.get());
+    compacted_ = params_.compactTableMaxBytes > 0 &&
+        topTable_->compactJoinTable(params_.compactTableMaxBytes);
     LOG(INFO) << "Made table " << topTable_->toString();
 
     if (topTable_->hashMode() == BaseHashTable::HashMode::kNormalizedKey) {
@@ -482,8 +490,15 @@ class HashTableBenchmark : public VectorTestBase {
         }
         for (auto i = 0; i < lookup->rows.size(); ++i) {
           auto key = lookup->rows[i];
-          numHit += lookup->hits[key] != nullptr;
-          ASSERT_EQ(rowOfKey_[startOffset + key], lookup->hits[key]);
+          auto* hit = lookup->hits[key];
+          auto* expected = rowOfKey_[startOffset + key];
+          numHit += hit != nullptr;
+          if (compacted_ && hit != nullptr && expected != nullptr) {
+            // Hits are copies of the rows in the RowContainers.
+            ASSERT_EQ(0, topTable_->rows()->compareRows(hit, expected));
+          } else {
+            ASSERT_EQ(expected, hit);
+          }
         }
       }
     }
@@ -594,6 +609,9 @@ class HashTableBenchmark : public VectorTestBase {
   std::unique_ptr<HashTable<true>> topTable_;
   HashTableBenchmarkParams params_;
 
+  // True if the rows of 'topTable_' were copied by compactJoinTable().
+  bool compacted_{false};
+
   // Timing set by test*Probe().
   float hashClocksPerRow_{0};
   float clocksPerRow_{0};
@@ -657,6 +675,20 @@ int main(int argc, char** argv) {
       HashTableBenchmarkParams("Miss32M", 32000000, 5),
 
       HashTableBenchmarkParams("Hit128M", 128000000, 100)};
+
+  // Joins with dimension tables in kHash mode, with and without compacting
+  // the table.
+  for (auto size : {10'000, 100'000}) {
+    for (bool compact : {false, true}) {
+      HashTableBenchmarkParams dimension(
+          fmt::format("HashDim{}K{}", size / 1'000, compact ? "Compact" : ""),
+          size,
+          100);
+      dimension.mode = BaseHashTable::HashMode::kHash;
+      dimension.compactTableMaxBytes = compact ? 64 << 20 : 0;
+      params.push_back(dimension);
+    }
+  }
   if (FLAGS_custom_size != 0) {
     params.push_back(HashTableBenchmarkParams(
         "Custom",
@@ -30,27 +30,81 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <string_view>
+#include <type_traits>
 
 #include "bolt/common/base/BitUtil.h"
 #include "bolt/common/base/Exceptions.h"
 #include "bolt/common/base/SimdUtil.h"
+#include "bolt/type/Timestamp.h"
 namespace bytedance::bolt::exec::prefixsort {
 
 /// Provides encode/decode methods for PrefixSort.
 class PrefixSortEncoder {
  public:
-  /// 1. Only int64_t is supported now.
+  /// 1. Supports bool, signed integers, float, double and Timestamp. Writes
+  /// encodedSize<T>() bytes.
   /// 2. Encoding is compatible with sorting ascending with no nulls.
   template <typename T>
   static FOLLY_ALWAYS_INLINE void encode(T value, char* row);
 
+  /// Encodes the first 'prefixLength' bytes of 'value', padded with zeros,
+  /// followed by one byte that orders a string after its own prefixes: the
+  /// size of 'value' if it is at most 'prefixLength' bytes, 'prefixLength' +
+  /// 1 otherwise. Two encodings are equal if the strings are equal or both
+  /// are longer than 'prefixLength' and share their first 'prefixLength'
+  /// bytes. Writes 'prefixLength' + 1 bytes. 'prefixLength' must be less
+  /// than 255.
+  static FOLLY_ALWAYS_INLINE void
+  encode(std::string_view value, uint32_t prefixLength, char* row) {
+    if (value.size() > prefixLength) {
+      std::memcpy(row, value.data(), prefixLength);
+      row[prefixLength] = prefixLength + 1;
+      return;
+    }
+    std::memcpy(row, value.data(), value.size());
+    std::memset(row + value.size(), 0, prefixLength - value.size());
+    row[prefixLength] = value.size();
+  }
+
+  template <typename T>
+  static constexpr uint32_t encodedSize() {
+    if constexpr (std::is_same_v<T, Timestamp>) {
+      return sizeof(int64_t) + sizeof(uint64_t);
+    } else {
+      return sizeof(T);
+    }
+  }
+
  private:
   FOLLY_ALWAYS_INLINE static uint8_t flipSignBit(uint8_t byte) {
     return byte ^ 128;
   }
+
+  // Maps the bits of a float or double to an unsigned integer that orders
+  // like the value. NaN is larger than all other values and -0.0 equals 0.0,
+  // as in RowContainer::comparePrimitiveAsc().
+  template <typename TFloat, typename TInt>
+  FOLLY_ALWAYS_INLINE static TInt floatingPointBits(TFloat value) {
+    constexpr TInt kSignBit = TInt(1) << (sizeof(TInt) * 8 - 1);
+    TInt bits;
+    if (std::isnan(value)) {
+      const auto nan = std::numeric_limits<TFloat>::quiet_NaN();
+      std::memcpy(&bits, &nan, sizeof(TInt));
+      bits &= ~kSignBit;
+    } else if (value == 0) {
+      bits = 0;
+    } else {
+      std::memcpy(&bits, &value, sizeof(TInt));
+    }
+    return (bits & kSignBit) ? ~bits : bits | kSignBit;
+  }
 };
 
 /// Assuming that value is little-endian encoded, we encode it as follows to
@@ -65,4 +119,49 @@ FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(int64_t value, char* row) {
   row[0] = flipSignBit(row[0]);
 }
 
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(int32_t value, char* row) {
+  const auto v = __builtin_bswap32(static_cast<uint32_t>(value));
+  simd::memcpy(row, &v, sizeof(int32_t));
+  row[0] = flipSignBit(row[0]);
+}
+
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(int16_t value, char* row) {
+  const auto v = __builtin_bswap16(static_cast<uint16_t>(value));
+  simd::memcpy(row, &v, sizeof(int16_t));
+  row[0] = flipSignBit(row[0]);
+}
+
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(int8_t value, char* row) {
+  row[0] = flipSignBit(static_cast<uint8_t>(value));
+}
+
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(bool value, char* row) {
+  row[0] = value ? 1 : 0;
+}
+
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(double value, char* row) {
+  const auto v =
+      __builtin_bswap64(floatingPointBits<double, uint64_t>(value));
+  simd::memcpy(row, &v, sizeof(uint64_t));
+}
+
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(float value, char* row) {
+  const auto v = __builtin_bswap32(floatingPointBits<float, uint32_t>(value));
+  simd::memcpy(row, &v, sizeof(uint32_t));
+}
+
+/// Seconds first, then nanos, as Timestamp::operator<().
+template <>
+FOLLY_ALWAYS_INLINE void PrefixSortEncoder::encode(Timestamp value, char* row) {
+  encode(value.getSeconds(), row);
+  const auto nanos = __builtin_bswap64(value.getNanos());
+  simd::memcpy(row + sizeof(int64_t), &nanos, sizeof(uint64_t));
+}
+
 } // namespace bytedance::bolt::exec::prefixsort
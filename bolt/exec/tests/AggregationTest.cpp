@@ -1303,6 +1303,55 @@ TEST_P(AggregationTest, largeValueRangeArray) {
   EXPECT_EQ(1, stats.at(finalAggId).inputVectors);
 }
 
+TEST_P(AggregationTest, radixPartitionedAggregation) {
+  if (GetParam().useGPU) {
+    GTEST_SKIP() << "GPU Aggregation does not support radix partitioning\n";
+  }
+  rowType_ = ROW({"c0", "c1", "c2"}, {BIGINT(), VARCHAR(), INTEGER()});
+  auto batches = makeVectors(rowType_, 1'000, 10);
+  createDuckDbTable(batches);
+
+  core::PlanNodeId aggNodeId;
+  const auto plan =
+      PlanBuilder()
+          .values(batches)
+          .partialAggregation({"c0", "c1"}, {"sum(c2)", "count(1)", "max(c2)"})
+          .finalAggregation()
+          .capturePlanNodeId(aggNodeId)
+          .planNode();
+  const std::string sql =
+      "SELECT c0, c1, sum(c2), count(1), max(c2) FROM tmp GROUP BY 1, 2";
+
+  for (const auto radixBits : {1, 4}) {
+    SCOPED_TRACE(fmt::format("radixBits: {}", radixBits));
+    auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                    .config(
+                        QueryConfig::kHashAggregationRadixPartitionBits,
+                        std::to_string(radixBits))
+                    .plan(plan)
+                    .assertResults(sql);
+    auto stats = toPlanStats(task->taskStats()).at(aggNodeId);
+    EXPECT_EQ(stats.customStats.at("radixPartitions").sum, 1 << radixBits);
+    EXPECT_EQ(stats.spilledBytes, 0);
+  }
+
+  // Each partition spills independently and merges its own spill runs.
+  auto spillDirectory = exec::test::TempDirectoryPath::create();
+  auto task = AssertQueryBuilder(duckDbQueryRunner_)
+                  .spillDirectory(spillDirectory->path)
+                  .config(QueryConfig::kSpillEnabled, true)
+                  .config(QueryConfig::kAggregationSpillEnabled, true)
+                  .config(QueryConfig::kAggregationSpillMemoryThreshold, "1")
+                  .config(QueryConfig::kHashAggregationRadixPartitionBits, "2")
+                  .plan(plan)
+                  .assertResults(sql);
+  auto stats = toPlanStats(task->taskStats()).at(aggNodeId);
+  EXPECT_EQ(stats.customStats.at("radixPartitions").sum, 4);
+  EXPECT_GT(stats.spilledRows, 0);
+  EXPECT_GT(stats.spilledBytes, 0);
+  OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
+}
+
 TEST_P(AggregationTest, partialAggregationMemoryLimitIncrease) {
   if (GetParam().useGPU) {
     GTEST_SKIP() << "GPU Aggregation does not support statistics yet\n";
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/exec/BatchSizeController.h"
+
+#include <gtest/gtest.h>
+
+#include "bolt/common/base/tests/GTestUtils.h"
+#include "bolt/common/memory/Memory.h"
+namespace bytedance::bolt::exec {
+namespace {
+
+constexpr int64_t kCapacity = 64 << 20;
+
+class BatchSizeControllerTest : public testing::Test {
+ protected:
+  static void SetUpTestCase() {
+    memory::MemoryManager::testingSetInstance(memory::MemoryManager::Options{});
+  }
+
+  void SetUp() override {
+    rootPool_ = memory::memoryManager()->addRootPool("root", kCapacity);
+    pool_ = rootPool_->addLeafChild("leaf");
+  }
+
+  BatchSizeController::Options options() const {
+    BatchSizeController::Options options;
+    // Adjust only on explicit update() calls.
+    options.updateIntervalMs = 3'600'000;
+    return options;
+  }
+
+  std::shared_ptr<memory::MemoryPool> rootPool_;
+  std::shared_ptr<memory::MemoryPool> pool_;
+};
+
+TEST_F(BatchSizeControllerTest, growWithHeadroom) {
+  BatchSizeController controller(options(), pool_.get(), nullptr);
+  ASSERT_EQ(controller.scale(), 1);
+  ASSERT_EQ(controller.memoryUsage(), 0);
+
+  for (auto i = 0; i < 4; ++i) {
+    controller.update();
+  }
+  ASSERT_EQ(controller.scale(), 4);
+  ASSERT_EQ(controller.stats().numGrows, 2);
+  ASSERT_EQ(controller.stats().numShrinks, 0);
+
+  ASSERT_EQ(controller.outputBatchRows(std::nullopt), 4 * 1'024);
+  ASSERT_EQ(controller.outputBatchRows(0), 4 * 10'000);
+  ASSERT_EQ(controller.outputBatchRows(1), 4 * 10'000);
+  // A batch takes at most 1/16 of the free memory.
+  ASSERT_EQ(controller.outputBatchRows(1'000), (kCapacity / 16) / 1'000);
+  ASSERT_EQ(controller.outputBatchRows(UINT64_MAX), 1);
+}
+
+TEST_F(BatchSizeControllerTest, shrinkUnderPressure) {
+  BatchSizeController controller(options(), pool_.get(), nullptr);
+  auto* buffer = pool_->allocate(kCapacity * 7 / 8);
+  ASSERT_GT(controller.memoryUsage(), 0.8);
+
+  for (auto i = 0; i < 4; ++i) {
+    controller.update();
+  }
+  ASSERT_EQ(controller.scale(), 1.0 / 8);
+  ASSERT_EQ(controller.stats().numShrinks, 3);
+  ASSERT_EQ(controller.outputBatchRows(std::nullopt), 1'024 / 8);
+  ASSERT_EQ(controller.outputBatchRows(0), 10'000 / 8);
+  ASSERT_EQ(controller.outputBatchRows(UINT64_MAX), 1);
+
+  // Usage between the two thresholds keeps the scale.
+  pool_->free(buffer, kCapacity * 7 / 8);
+  buffer = pool_->allocate(kCapacity * 5 / 8);
+  controller.update();
+  ASSERT_EQ(controller.scale(), 1.0 / 8);
+
+  // Batches grow back once the memory is released.
+  pool_->free(buffer, kCapacity * 5 / 8);
+  controller.update();
+  ASSERT_EQ(controller.scale(), 1.0 / 4);
+  ASSERT_EQ(controller.stats().numGrows, 1);
+}
+
+TEST_F(BatchSizeControllerTest, create) {
+  auto queryCtx = core::QueryCtx::create();
+  ASSERT_EQ(BatchSizeController::create(*queryCtx), nullptr);
+
+  queryCtx = core::QueryCtx::create(
+      nullptr,
+      core::QueryConfig(
+          {{core::QueryConfig::kAdaptiveOutputBatchSizing, "true"},
+           {core::QueryConfig::kAdaptiveOutputBatchMaxScale, "2"},
+           {core::QueryConfig::kPreferredOutputBatchRows, "100"}}));
+  auto controller = BatchSizeController::create(*queryCtx);
+  ASSERT_NE(controller, nullptr);
+  ASSERT_EQ(controller->outputBatchRows(std::nullopt), 200);
+
+  queryCtx = core::QueryCtx::create(
+      nullptr,
+      core::QueryConfig(
+          {{core::QueryConfig::kAdaptiveOutputBatchSizing, "true"},
+           {core::QueryConfig::kAdaptiveOutputBatchMaxScale, "0.5"}}));
+  BOLT_ASSERT_USER_THROW(
+      BatchSizeController::create(*queryCtx),
+      "adaptive_output_batch_max_scale must be at least 1");
+}
+
+} // namespace
+} // namespace bytedance::bolt::exec
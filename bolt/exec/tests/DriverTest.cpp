@@ -29,10 +29,12 @@
  */
 
 #include <bolt/exec/Driver.h>
+#include <folly/String.h>
 #include <folly/Unit.h>
 #include <folly/init/Init.h>
 #include <memory>
 #include "bolt/common/base/tests/GTestUtils.h"
+#include "bolt/common/memory/NumaTopology.h"
 #include "bolt/common/testutil/TestValue.h"
 #include "bolt/dwio/common/tests/utils/BatchMaker.h"
 #include "bolt/exec/PlanNodeStats.h"
@@ -619,6 +621,37 @@ TEST_F(DriverTest, pause) {
   EXPECT_EQ(operators[1].outputPositions, 10 * hits);
 }
 
+TEST_F(DriverTest, perfCounters) {
+  core::PlanNodeId filterId;
+  auto plan = PlanBuilder()
+                  .values({makeRowVector({makeFlatVector<int64_t>(
+                      10'000, [](auto row) { return row; })})})
+                  .filter("c0 % 7 = 1")
+                  .capturePlanNodeId(filterId)
+                  .planNode();
+  std::shared_ptr<Task> task;
+  AssertQueryBuilder(plan)
+      .config(core::QueryConfig::kOperatorTrackPerfCounters, "true")
+      .copyResults(pool(), task);
+  const auto& customStats =
+      toPlanStats(task->taskStats()).at(filterId).customStats;
+
+  // Nothing is reported without access to perf events.
+  process::PerfEventCounts counts;
+  const bool counting = process::readThreadPerfEvents(counts);
+  int32_t numReported{0};
+  for (auto i = 0; i < process::kNumPerfEvents; ++i) {
+    const auto event = static_cast<process::PerfEvent>(i);
+    numReported +=
+        customStats.count(std::string(process::perfEventMetricName(event)));
+  }
+  if (counting) {
+    ASSERT_GT(numReported, 0);
+  } else {
+    ASSERT_EQ(numReported, 0);
+  }
+}
+
 TEST_F(DriverTest, yield) {
   constexpr int32_t kNumTasks = 20;
   constexpr int32_t kThreadsPerTask = 5;
@@ -1452,6 +1485,84 @@ DEBUG_ONLY_TEST_F(DriverTest, driverCpuTimeSlicingCheck) {
   }
 }
 
+DEBUG_ONLY_TEST_F(DriverTest, numaDriverPinning) {
+  const auto cpus = memory::NumaTopology::currentThreadCpus();
+  if (cpus.size() < 2) {
+    GTEST_SKIP() << "Needs at least 2 CPUs";
+  }
+  // Splits the CPUs of this process into two nodes unless the topology is
+  // already known, e.g. detected on a multi node host.
+  const auto half = cpus.size() / 2;
+  FLAGS_bolt_numa_topology = fmt::format(
+      "{};{}",
+      folly::join(",", cpus.begin(), cpus.begin() + half),
+      folly::join(",", cpus.begin() + half, cpus.end()));
+  const auto& topology = memory::NumaTopology::get();
+  if (topology->numNodes() < 2) {
+    GTEST_SKIP() << "Needs a topology with at least 2 nodes";
+  }
+
+  // One thread, so that both queries run their drivers on it.
+  auto executor = std::make_unique<folly::CPUThreadPoolExecutor>(1);
+  std::vector<int32_t> driverCpus;
+  SCOPED_TESTVALUE_SET(
+      "bytedance::bolt::exec::Values::getOutput",
+      std::function<void(const exec::Values*)>([&](const exec::Values*) {
+        driverCpus = memory::NumaTopology::currentThreadCpus();
+      }));
+  auto runQuery = [&](bool pinning) {
+    driverCpus.clear();
+    auto fragment =
+        PlanBuilder()
+            .values({makeRowVector({makeFlatVector<int32_t>({1, 2, 3})})})
+            .planFragment();
+    std::unordered_map<std::string, std::string> queryConfig{
+        {core::QueryConfig::kNumaDriverPinning, pinning ? "true" : "false"}};
+    auto task = Task::create(
+        "t0",
+        fragment,
+        0,
+        core::QueryCtx::create(
+            executor.get(), core::QueryConfig{std::move(queryConfig)}),
+        Task::ExecutionMode::kParallel,
+        [](RowVectorPtr /*unused*/,
+           ContinueFuture* /*unused*/,
+           unsigned int /*unused*/) {
+          return exec::BlockingReason::kNotBlocked;
+        });
+    task->start(1, 1);
+    ASSERT_TRUE(waitForTaskCompletion(task.get(), 600'000'000));
+  };
+  auto executorCpus = [&]() {
+    return folly::via(executor.get(), [] {
+             return memory::NumaTopology::currentThreadCpus();
+           }).get();
+  };
+  auto executorPinnedNode = [&]() {
+    return folly::via(executor.get(), [] {
+             return memory::NumaThreadPin::pinnedNode();
+           }).get();
+  };
+  ASSERT_EQ(executorCpus(), cpus);
+
+  // The driver runs on the CPUs of the node picked by the task id.
+  runQuery(true);
+  const int32_t node = std::hash<std::string>{}("t0") % topology->numNodes();
+  ASSERT_FALSE(driverCpus.empty());
+  for (auto cpu : driverCpus) {
+    ASSERT_EQ(topology->nodeOf(cpu), node);
+  }
+  // The thread stays pinned for the next driver of the node.
+  ASSERT_EQ(executorPinnedNode(), node);
+  ASSERT_EQ(executorCpus(), driverCpus);
+
+  // A query without pinning gives the thread all its CPUs back.
+  runQuery(false);
+  ASSERT_EQ(driverCpus, cpus);
+  ASSERT_EQ(executorPinnedNode(), -1);
+  ASSERT_EQ(executorCpus(), cpus);
+}
+
 namespace {
 
 template <typename T>
@@ -4410,6 +4410,88 @@ TEST_F(HashJoinTest, lazyVectors) {
   }
 }
 
+TEST_F(HashJoinTest, lateMaterialization) {
+  auto probeVectors = makeBatches(4, [&](int32_t batch) {
+    return makeRowVector(
+        {"t0", "t1"},
+        {makeFlatVector<int64_t>(
+             1'000, [&](auto row) { return (batch * 1'000 + row) % 1'700; }),
+         makeFlatVector<int64_t>(1'000, [](auto row) { return row; })});
+  });
+  auto buildVectors = makeBatches(3, [&](int32_t batch) {
+    return makeRowVector(
+        {"u0", "u1", "u2"},
+        {makeFlatVector<int64_t>(
+             500, [&](auto row) { return batch * 500 + row; }),
+         makeFlatVector<int64_t>(
+             500, [](auto row) { return row % 17; }, nullEvery(7)),
+         makeFlatVector<std::string>(500, [](auto row) {
+           return std::string(40, 'a' + row % 26);
+         })});
+  });
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  // The build columns reach the filter unloaded and only the rows that pass
+  // the filter on 'u1' copy 'u2' out of the table.
+  for (const auto joinType : {core::JoinType::kInner, core::JoinType::kLeft}) {
+    SCOPED_TRACE(core::joinTypeName(joinType));
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    core::PlanNodeId filterId;
+    auto plan = PlanBuilder(planNodeIdGenerator)
+                    .values(probeVectors)
+                    .hashJoin(
+                        {"t0"},
+                        {"u0"},
+                        PlanBuilder(planNodeIdGenerator)
+                            .values(buildVectors)
+                            .planNode(),
+                        "",
+                        {"t0", "t1", "u1", "u2"},
+                        joinType)
+                    .filter("u1 = 3 OR u1 IS NULL")
+                    .capturePlanNodeId(filterId)
+                    .planNode();
+
+    HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+        .planNode(std::move(plan))
+        .config(core::QueryConfig::kHashJoinLateMaterializationEnabled, "true")
+        .injectSpill(false)
+        .referenceQuery(fmt::format(
+            "SELECT t0, t1, u1, u2 FROM t {} JOIN u ON t0 = u0 "
+            "WHERE u1 = 3 OR u1 IS NULL",
+            joinType == core::JoinType::kLeft ? "LEFT" : "INNER"))
+        .verifier([&](const std::shared_ptr<Task>& task, bool /*unused*/) {
+          auto planStats = toPlanStats(task->taskStats());
+          ASSERT_EQ(
+              planStats.at(filterId).customStats.count(LazyVector::kWallNanos),
+              1);
+        })
+        .run();
+  }
+
+  // Aggregations over the build columns load them.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .values(probeVectors)
+                  .hashJoin(
+                      {"t0"},
+                      {"u0"},
+                      PlanBuilder(planNodeIdGenerator)
+                          .values(buildVectors)
+                          .planNode(),
+                      "",
+                      {"t1", "u1", "u2"})
+                  .singleAggregation({"t1"}, {"sum(u1)", "max(u2)"})
+                  .planNode();
+  HashJoinBuilder(*pool_, duckDbQueryRunner_, driverExecutor_.get())
+      .planNode(std::move(plan))
+      .config(core::QueryConfig::kHashJoinLateMaterializationEnabled, "true")
+      .referenceQuery(
+          "SELECT t1, sum(u1), max(u2) FROM t, u WHERE t0 = u0 GROUP BY t1")
+      .run();
+}
+
 TEST_F(HashJoinTest, lazyVectorNotLoadedInFilter) {
   // Ensure that if lazy vectors are temporarily wrapped during a filter's
   // execution and remain unloaded, the temporary wrap is promptly
@@ -1188,6 +1188,72 @@ TEST_P(HashTableTest, toStringMultipleKeys) {
   ASSERT_NO_THROW(table->toString());
 }
 
+TEST_P(HashTableTest, compactJoinTable) {
+  constexpr vector_size_t kSize = 2'000;
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
+  hashers.push_back(std::make_unique<VectorHasher>(VARCHAR(), 0));
+  auto table = HashTable<false>::createForJoin(
+      std::move(hashers),
+      {BIGINT()}, /*dependentTypes*/
+      true /*allowDuplicates*/,
+      false /*hasProbedFlag*/,
+      BaseHashTable::HashMode::kHash,
+      1 /*minTableSizeForParallelJoinBuild*/,
+      pool(),
+      GetParam().jitRowEqVectors);
+
+  // Two rows per key, one in 100 keys is null. The keys are not inlined.
+  auto data = makeRowVector({
+      makeFlatVector<std::string>(
+          kSize,
+          [](auto row) { return fmt::format("dimension key {}", row / 2); },
+          nullEvery(100)),
+      makeFlatVector<int64_t>(kSize, folly::identity),
+  });
+  store(*table->rows(), data);
+  table->prepareJoinTable({});
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kHash);
+
+  const auto allocatedBytes = table->allocatedBytes();
+  ASSERT_FALSE(table->compactJoinTable(kSize));
+  ASSERT_EQ(table->allocatedBytes(), allocatedBytes);
+  ASSERT_TRUE(table->compactJoinTable(1 << 20));
+  ASSERT_GT(table->allocatedBytes(), allocatedBytes);
+
+  auto probe = makeRowVector({makeFlatVector<std::string>(
+      kSize / 2 + 10,
+      [](auto row) { return fmt::format("dimension key {}", row); })});
+  HashLookup lookup(table->hashers(), GetParam().jitRowEqVectors);
+  SelectivityVector rows(probe->size());
+  table->prepareForJoinProbe(lookup, probe, rows, true);
+  table->joinProbe(lookup);
+  BaseHashTable::JoinResultIterator iter;
+  iter.reset(lookup);
+  std::vector<vector_size_t> inputRows(kSize);
+  std::vector<char*> hits(kSize);
+  const auto numHits = table->listJoinResults(
+      iter,
+      false,
+      folly::Range(inputRows.data(), inputRows.size()),
+      folly::Range(hits.data(), hits.size()));
+  ASSERT_EQ(numHits, kSize - kSize / 100);
+  ASSERT_TRUE(iter.atEnd());
+
+  auto payload =
+      BaseVector::create<FlatVector<int64_t>>(BIGINT(), numHits, pool());
+  table->rows()->extractColumn(hits.data(), numHits, 1, payload);
+  for (auto i = 0; i < numHits; ++i) {
+    ASSERT_EQ(payload->valueAt(i) / 2, inputRows[i]);
+  }
+
+  // Null keys are chained like other keys.
+  std::vector<char*> nullKeyRows(kSize);
+  BaseHashTable::NullKeyRowsIterator nullKeyIter;
+  ASSERT_EQ(
+      table->listNullKeyRows(&nullKeyIter, kSize, nullKeyRows.data()),
+      kSize / 100);
+}
+
 TEST(HashTableTest, tableInsertPartitionInfo) {
   std::vector<char*> overflows;
   const auto testFn = [&](PartitionBoundIndexType start,
@@ -883,6 +883,78 @@ TEST_F(MultiFragmentTest, replicateNullsAndAny) {
   }
 }
 
+TEST_F(MultiFragmentTest, partitionMajorGather) {
+  constexpr int kFanout = 8;
+  std::vector<RowVectorPtr> data;
+  // Only the first batch has null keys, so with replicateNullsAndAny the
+  // other batches are still gathered by partition.
+  for (auto i = 0; i < 3; ++i) {
+    data.push_back(makeRowVector({
+        makeFlatVector<int32_t>(
+            1'000,
+            [&](auto row) { return row * (i + 1); },
+            [&](auto row) { return i == 0 && row % 7 == 0; }),
+        makeFlatVector<std::string>(
+            1'000,
+            [&](auto row) { return std::string(row % 50, 'a' + i); },
+            nullEvery(11)),
+        makeArrayVector<int64_t>(
+            1'000,
+            [](auto row) { return row % 5; },
+            [](auto row, auto index) { return row + index; }),
+    }));
+  }
+  createDuckDbTable(data);
+  configSettings_[core::QueryConfig::kPartitionMajorGatherMinDestinations] =
+      "1";
+
+  for (const bool replicateNullsAndAny : {false, true}) {
+    SCOPED_TRACE(fmt::format("replicateNullsAndAny {}", replicateNullsAndAny));
+    const auto prefix = fmt::format("gather-{}", replicateNullsAndAny);
+    std::vector<std::shared_ptr<Task>> tasks;
+    auto leafTaskId = makeTaskId(prefix + "-leaf", 0);
+    auto leafPlan =
+        PlanBuilder()
+            .values(data)
+            .partitionedOutput({"c0"}, kFanout, replicateNullsAndAny)
+            .planNode();
+    auto leafTask = makeTask(leafTaskId, leafPlan, 0);
+    tasks.push_back(leafTask);
+    leafTask->start(1);
+
+    core::PlanNodePtr passThroughPlan;
+    std::vector<std::string> passThroughTaskIds;
+    for (int i = 0; i < kFanout; ++i) {
+      passThroughPlan = PlanBuilder()
+                            .exchange(leafPlan->outputType())
+                            .partitionedOutput({}, 1)
+                            .planNode();
+      passThroughTaskIds.push_back(makeTaskId(prefix + "-pass", i));
+      auto task = makeTask(passThroughTaskIds.back(), passThroughPlan, i);
+      tasks.push_back(task);
+      task->start(1);
+      addRemoteSplits(task, {leafTaskId});
+    }
+
+    auto op = PlanBuilder().exchange(passThroughPlan->outputType()).planNode();
+    // Rows with null keys, the first row among them, go to every destination.
+    assertQuery(
+        op,
+        passThroughTaskIds,
+        replicateNullsAndAny
+            ? fmt::format(
+                  "SELECT * FROM tmp UNION ALL "
+                  "SELECT t.* FROM (SELECT * FROM tmp WHERE c0 IS NULL) t, "
+                  "range({})",
+                  kFanout - 1)
+            : "SELECT * FROM tmp");
+
+    for (auto& task : tasks) {
+      ASSERT_TRUE(waitForTaskCompletion(task.get())) << task->taskId();
+    }
+  }
+}
+
 // Test query finishing before all splits have been scheduled.
 TEST_F(MultiFragmentTest, limit) {
   auto data = makeRowVector({makeFlatVector<int32_t>(
@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <filesystem>
 #include <ranges>
 
 #include "bolt/common/base/tests/GTestUtils.h"
@@ -43,6 +44,7 @@
 #include "bolt/common/testutil/TestValue.h"
 #include "bolt/core/QueryConfig.h"
 #include "bolt/cudf/tests/CudfResource.h"
+#include "bolt/exec/OrderBy.h"
 #include "bolt/exec/PlanNodeStats.h"
 #include "bolt/exec/Spill.h"
 #include "bolt/exec/Spiller.h"
@@ -1147,6 +1149,124 @@ TEST_P(OrderByTest, spillWithArrowSerde) {
   OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
 }
 
+TEST_P(OrderByTest, spillRangeMerge) {
+  if (GetParam().useGPU) {
+    GTEST_SKIP() << "GPU OrderBy does not support spilling\n";
+  }
+
+  const vector_size_t batchSize = 1'000;
+  std::vector<RowVectorPtr> input;
+  for (int i = 0; i < 8; ++i) {
+    input.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            batchSize,
+            [&](vector_size_t row) { return (row * 7 + i) % 211; },
+            nullEvery(13)),
+        makeFlatVector<std::string>(
+            batchSize,
+            [&](vector_size_t row) {
+              return fmt::format("{:04}", (row + i * 31) % 97);
+            }),
+        makeFlatVector<int32_t>(
+            batchSize, [&](vector_size_t row) { return row % 3; }),
+        makeFlatVector<int32_t>(
+            batchSize, [](vector_size_t /*row*/) { return 5; }),
+    }));
+  }
+  createDuckDbTable(input);
+
+  struct {
+    std::vector<std::string> keys;
+    std::string duckDbSql;
+    std::vector<uint32_t> sortingKeys;
+    // True if the sampled bounds collapse into a single range.
+    bool singleRange;
+  } testSettings[] = {
+      {{"c0 DESC NULLS FIRST", "c1"},
+       "SELECT * FROM tmp ORDER BY c0 DESC NULLS FIRST, c1",
+       {0, 1},
+       false},
+      // Few distinct keys, so the sampled bounds collapse into fewer ranges.
+      {{"c2"}, "SELECT * FROM tmp ORDER BY c2", {2}, false},
+      // One distinct key, so there is nothing to split.
+      {{"c3"}, "SELECT * FROM tmp ORDER BY c3", {3}, true}};
+  for (const auto& testData : testSettings) {
+    for (const uint32_t parallelism : {1, 4, 32}) {
+      SCOPED_TRACE(fmt::format("{} {}", testData.duckDbSql, parallelism));
+      core::PlanNodeId orderById;
+      auto plan = PlanBuilder()
+                      .values(input)
+                      .orderBy(testData.keys, false)
+                      .capturePlanNodeId(orderById)
+                      .planNode();
+
+      auto spillDirectory = exec::test::TempDirectoryPath::create();
+      auto queryCtx = core::QueryCtx::create(executor_.get());
+      // Spills each input batch as a sorted run.
+      TestScopedSpillInjection scopedSpillInjection(100);
+      queryCtx->testingOverrideConfigUnsafe({
+          {core::QueryConfig::kSpillEnabled, "true"},
+          {core::QueryConfig::kOrderBySpillEnabled, "true"},
+          {core::QueryConfig::kOrderBySpillMergeParallelism,
+           std::to_string(parallelism)},
+          {core::QueryConfig::kPreferredOutputBatchRows, "333"},
+      });
+      CursorParameters params;
+      params.planNode = plan;
+      params.queryCtx = queryCtx;
+      params.spillDirectory = spillDirectory->path;
+      auto task =
+          assertQueryOrdered(params, testData.duckDbSql, testData.sortingKeys);
+      auto& planStats = toPlanStats(task->taskStats()).at(orderById);
+      ASSERT_GT(planStats.spilledRows, 0);
+      ASSERT_GT(planStats.spilledFiles, 1);
+      const auto& mergeRanges =
+          planStats.customStats.at(OrderBy::kSpillMergeRanges);
+      if (parallelism == 1 || testData.singleRange) {
+        ASSERT_EQ(mergeRanges.max, 1);
+      } else {
+        ASSERT_GT(mergeRanges.min, 1);
+        ASSERT_LE(mergeRanges.max, parallelism);
+      }
+      OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
+    }
+  }
+
+  // Only the first range is read. The files merged for the other ranges are
+  // removed when the OrderBy closes, before the task is deleted.
+  auto plan = PlanBuilder()
+                  .values(input)
+                  .orderBy({"c0 DESC NULLS FIRST", "c1", "c2"}, false)
+                  .limit(0, 10, false)
+                  .planNode();
+  auto spillDirectory = exec::test::TempDirectoryPath::create();
+  auto queryCtx = core::QueryCtx::create(executor_.get());
+  TestScopedSpillInjection scopedSpillInjection(100);
+  queryCtx->testingOverrideConfigUnsafe({
+      {core::QueryConfig::kSpillEnabled, "true"},
+      {core::QueryConfig::kOrderBySpillEnabled, "true"},
+      {core::QueryConfig::kOrderBySpillMergeParallelism, "4"},
+  });
+  CursorParameters params;
+  params.planNode = plan;
+  params.queryCtx = queryCtx;
+  params.spillDirectory = spillDirectory->path;
+  auto task = assertQueryOrdered(
+      params,
+      "SELECT * FROM tmp ORDER BY c0 DESC NULLS FIRST, c1, c2 LIMIT 10",
+      {0, 1, 2});
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+  int32_t numSpillFiles = 0;
+  for (const auto& entry :
+       std::filesystem::recursive_directory_iterator(spillDirectory->path)) {
+    if (entry.is_regular_file()) {
+      ++numSpillFiles;
+    }
+  }
+  ASSERT_EQ(numSpillFiles, 0);
+  OperatorTestBase::deleteTaskAndCheckSpillDirectory(task);
+}
+
 TEST_P(OrderByTest, spillWithMemoryLimit) {
   if (GetParam().useGPU) {
     GTEST_SKIP() << "GPU OrderBy does not support spilling\n";
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/exec/PrefixSort.h"
+
+#include <gtest/gtest.h>
+
+#include "bolt/exec/tests/utils/AssertQueryBuilder.h"
+#include "bolt/exec/tests/utils/OperatorTestBase.h"
+#include "bolt/exec/tests/utils/PlanBuilder.h"
+#include "bolt/functions/prestosql/window/WindowFunctionsRegistration.h"
+namespace bytedance::bolt::exec::test {
+namespace {
+
+class PrefixSortTest : public OperatorTestBase {
+ protected:
+  void SetUp() override {
+    OperatorTestBase::SetUp();
+    window::prestosql::registerAllWindowFunctions();
+  }
+
+  // Stores 'data' in a RowContainer with all columns as keys, sorts the rows
+  // with prefix sort and with row comparisons and expects the same order of
+  // keys.
+  void testSort(
+      const RowVectorPtr& data,
+      const std::vector<CompareFlags>& flags,
+      const PrefixSortConfig& config = {}) {
+    const auto& types = asRowType(data->type())->children();
+    RowContainer container(types, {}, pool());
+    std::vector<DecodedVector> decoded(types.size());
+    for (auto column = 0; column < types.size(); ++column) {
+      decoded[column].decode(*data->childAt(column));
+    }
+    std::vector<char*> rows(data->size());
+    for (auto row = 0; row < data->size(); ++row) {
+      rows[row] = container.newRow();
+      for (auto column = 0; column < types.size(); ++column) {
+        container.store(decoded[column], row, rows[row], column);
+      }
+    }
+
+    auto expected = rows;
+    std::sort(
+        expected.begin(), expected.end(), [&](const char* l, const char* r) {
+          return container.compareRows(l, r, flags) < 0;
+        });
+    ASSERT_TRUE(PrefixSort::sort(
+        folly::Range(rows.data(), rows.size()),
+        &container,
+        container.keyIndices(),
+        flags,
+        config,
+        pool()));
+    for (auto i = 0; i < rows.size(); ++i) {
+      ASSERT_EQ(container.compareRows(rows[i], expected[i], flags), 0)
+          << "at " << i << ": " << container.toString(rows[i]) << " vs "
+          << container.toString(expected[i]);
+    }
+  }
+
+  static constexpr vector_size_t kSize = 1'000;
+};
+
+TEST_F(PrefixSortTest, fixedWidth) {
+  auto data = makeRowVector({
+      makeFlatVector<int32_t>(
+          kSize, [](auto row) { return row % 7 - 3; }, nullEvery(11)),
+      makeFlatVector<double>(
+          kSize,
+          [](auto row) {
+            switch (row % 5) {
+              case 0:
+                return std::numeric_limits<double>::quiet_NaN();
+              case 1:
+                return -0.0;
+              case 2:
+                return 0.0;
+              default:
+                return (row % 13) * (row % 2 == 0 ? -1.5 : 1.5);
+            }
+          },
+          nullEvery(17)),
+      makeFlatVector<Timestamp>(
+          kSize, [](auto row) { return Timestamp(row % 3 - 1, row % 4); }),
+      makeFlatVector<int8_t>(kSize, [](auto row) { return row % 256 - 128; }),
+  });
+  testSort(data, {{true, true}, {false, true}, {true, false}, {true, true}});
+  testSort(data, {{false, false}, {true, false}, {false, true}, {false, true}});
+}
+
+TEST_F(PrefixSortTest, strings) {
+  const std::string longPrefix(30, 'x');
+  auto data = makeRowVector({
+      makeFlatVector<int16_t>(kSize, [](auto row) { return row % 3; }),
+      makeFlatVector<std::string>(
+          kSize,
+          [&](auto row) {
+            // Strings that are prefixes of one another, share a prefix that
+            // is longer than the encoded prefix or are empty.
+            switch (row % 4) {
+              case 0:
+                return std::string(row % 20, 'a');
+              case 1:
+                return longPrefix + std::to_string(row % 9);
+              case 2:
+                return std::string();
+              default:
+                return std::string(1, '\0') + std::to_string(row);
+            }
+          },
+          nullEvery(13)),
+      makeFlatVector<int64_t>(kSize, [](auto row) { return row % 5; }),
+  });
+  testSort(data, {{true, true}, {true, true}, {true, true}});
+  testSort(data, {{true, false}, {false, false}, {true, false}});
+
+  PrefixSortConfig config;
+  config.maxStringPrefixLength = 0;
+  testSort(data, {{true, true}, {false, true}, {true, false}}, config);
+  // Only the first key fits in the normalized key.
+  config.maxNormalizedKeyBytes = 4;
+  testSort(data, {{true, true}, {false, true}, {true, false}}, config);
+}
+
+TEST_F(PrefixSortTest, notApplicable) {
+  // Too few rows.
+  RowContainer container({BIGINT()}, {}, pool());
+  std::vector<char*> rows(10);
+  for (auto& row : rows) {
+    row = container.newRow();
+  }
+  const auto original = rows;
+  ASSERT_FALSE(PrefixSort::sort(
+      folly::Range(rows.data(), rows.size()),
+      &container,
+      container.keyIndices(),
+      {CompareFlags{}},
+      PrefixSortConfig{},
+      pool()));
+  ASSERT_EQ(rows, original);
+
+  // The first key cannot be encoded.
+  RowContainer arrays({ARRAY(BIGINT())}, {}, pool());
+  PrefixSortConfig config;
+  config.minNumRows = 1;
+  ASSERT_FALSE(PrefixSort::sort(
+      folly::Range(rows.data(), rows.size()),
+      &arrays,
+      arrays.keyIndices(),
+      {CompareFlags{}},
+      config,
+      pool()));
+}
+
+TEST_F(PrefixSortTest, operators) {
+  std::vector<RowVectorPtr> data;
+  for (auto i = 0; i < 3; ++i) {
+    data.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            kSize, [&](auto row) { return (row + i) % 31; }, nullEvery(7)),
+        makeFlatVector<std::string>(
+            kSize,
+            [&](auto row) {
+              return std::string(20, 'p') + std::to_string((row * i) % 17);
+            }),
+    }));
+  }
+  createDuckDbTable(data);
+
+  const auto orderBy =
+      PlanBuilder().values(data).orderBy({"c1 DESC", "c0"}, false).planNode();
+  AssertQueryBuilder(orderBy, duckDbQueryRunner_)
+      .config(core::QueryConfig::kPrefixSortMinRows, "1")
+      .assertResults(
+          "SELECT * FROM tmp ORDER BY c1 DESC, c0 NULLS LAST",
+          std::vector<uint32_t>{1, 0});
+
+  const auto topN = PlanBuilder()
+                        .values(data)
+                        .topN({"c0 NULLS FIRST", "c1"}, 200, false)
+                        .planNode();
+  AssertQueryBuilder(topN, duckDbQueryRunner_)
+      .config(core::QueryConfig::kPrefixSortMinRows, "1")
+      .assertResults(
+          "SELECT * FROM tmp ORDER BY c0 NULLS FIRST, c1 LIMIT 200",
+          std::vector<uint32_t>{0, 1});
+
+  const auto window =
+      PlanBuilder()
+          .values(data)
+          .window({"rank() over (partition by c0 order by c1 desc)"})
+          .planNode();
+  AssertQueryBuilder(window, duckDbQueryRunner_)
+      .config(core::QueryConfig::kPrefixSortMinRows, "1")
+      .assertResults(
+          "SELECT *, rank() over (partition by c0 order by c1 desc) "
+          "FROM tmp");
+}
+
+} // namespace
+} // namespace bytedance::bolt::exec::test
@@ -54,6 +54,7 @@
 #include "bolt/type/Type.h"
 #include "bolt/type/tests/SubfieldFiltersBuilder.h"
 
+#include <folly/String.h>
 #include <folly/experimental/EventCount.h>
 #include <folly/synchronization/Baton.h>
 #include <folly/synchronization/Latch.h>
@@ -1761,6 +1762,119 @@ TEST_F(TableScanTest, splitOffsetAndLength) {
       "SELECT * FROM tmp LIMIT 0");
 }
 
+TEST_F(TableScanTest, subSplits) {
+  auto vectors = makeVectors(20, 1'000);
+  auto filePath = TempFilePath::create();
+  auto config = std::make_shared<dwrf::Config>();
+  // Writes a stripe per vector.
+  config->set<uint64_t>(dwrf::Config::STRIPE_SIZE, 1);
+  writeToFile(filePath->path, vectors, config);
+  createDuckDbTable(vectors);
+  const auto fileSize = fs::file_size(filePath->path);
+
+  for (const auto numPrefetchSplits : {0, 2}) {
+    SCOPED_TRACE(fmt::format("numPrefetchSplits {}", numPrefetchSplits));
+    auto task =
+        AssertQueryBuilder(tableScanNode(), duckDbQueryRunner_)
+            .maxDrivers(4)
+            .config(
+                core::QueryConfig::kMaxSplitPreloadPerDriver,
+                std::to_string(numPrefetchSplits))
+            .config(
+                core::QueryConfig::kTableScanSubSplitBytes,
+                std::to_string(fileSize / 8))
+            .split(makeHiveConnectorSplit(filePath->path, 0, fileSize))
+            .assertResults("SELECT * FROM tmp");
+    // The file is read in parts of an eighth, the last up to 1.5 times that.
+    EXPECT_GE(getTableScanStats(task).numSplits, 7);
+  }
+
+  // Splits are not divided by default.
+  auto task = assertQuery(
+      tableScanNode(),
+      makeHiveConnectorSplit(filePath->path, 0, fileSize),
+      "SELECT * FROM tmp");
+  EXPECT_EQ(getTableScanStats(task).numSplits, 1);
+
+  // The weight is divided by bytes.
+  auto split = HiveConnectorSplitBuilder(filePath->path)
+                   .start(100)
+                   .length(1'000)
+                   .splitWeight(50)
+                   .build();
+  auto parts = split->divide(200);
+  ASSERT_EQ(parts.size(), 2);
+  auto* first = dynamic_cast<HiveConnectorSplit*>(parts[0].get());
+  auto* rest = dynamic_cast<HiveConnectorSplit*>(parts[1].get());
+  EXPECT_EQ(first->start, 100);
+  EXPECT_EQ(first->length, 200);
+  EXPECT_EQ(first->splitWeight, 10);
+  EXPECT_EQ(rest->start, 300);
+  EXPECT_EQ(rest->length, 800);
+  EXPECT_EQ(rest->splitWeight, 40);
+  EXPECT_TRUE(split->divide(700).empty());
+}
+
+TEST_F(TableScanTest, topNDynamicFilter) {
+  constexpr int kNumFiles = 10;
+  constexpr int kRowsPerFile = 1'000;
+  std::vector<RowVectorPtr> vectors;
+  auto filePaths = makeFilePaths(kNumFiles);
+  for (auto i = 0; i < kNumFiles; ++i) {
+    // Each file holds a range of keys above the keys of the files before it.
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>(
+            kRowsPerFile,
+            [&](auto row) { return i * kRowsPerFile + row; },
+            nullEvery(13)),
+        makeFlatVector<std::string>(
+            kRowsPerFile,
+            [&](auto row) {
+              return fmt::format("{:05}", (kNumFiles - i) * kRowsPerFile - row);
+            }),
+    }));
+    writeToFile(filePaths[i]->path, vectors.back());
+  }
+  createDuckDbTable(vectors);
+  auto rowType = asRowType(vectors[0]->type());
+
+  auto runTopN = [&](const std::vector<std::string>& keys, bool enabled) {
+    auto plan =
+        PlanBuilder().tableScan(rowType).topN(keys, 10, false).planNode();
+    return AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kMaxSplitPreloadPerDriver, "0")
+        .config(core::QueryConfig::kTopNDynamicFilterEnabled, enabled)
+        .splits(makeHiveConnectorSplits(filePaths))
+        .assertResults(fmt::format(
+            "SELECT * FROM tmp ORDER BY {} LIMIT 10", folly::join(", ", keys)));
+  };
+
+  for (const auto& keys : std::vector<std::vector<std::string>>{
+           {"c0 NULLS LAST", "c1"},
+           {"c0 DESC NULLS LAST", "c1"},
+           {"c0 NULLS FIRST", "c1"},
+           {"c0 DESC NULLS FIRST", "c1"},
+           {"c1"},
+           {"c1 DESC"}}) {
+    SCOPED_TRACE(folly::join(", ", keys));
+    auto task = runTopN(keys, true);
+    EXPECT_LT(0, getTableScanRuntimeStats(task)["dynamicFiltersAccepted"].sum);
+  }
+
+  // The top keys are all in the first file, so the statistics of the other
+  // files rule them out.
+  auto task = runTopN({"c0 NULLS LAST", "c1"}, true);
+  EXPECT_EQ(
+      kNumFiles - 1, getTableScanRuntimeStats(task)["skippedSplits"].sum);
+  task = runTopN({"c1 DESC"}, true);
+  EXPECT_EQ(
+      kNumFiles - 1, getTableScanRuntimeStats(task)["skippedSplits"].sum);
+
+  task = runTopN({"c0 NULLS LAST", "c1"}, false);
+  EXPECT_EQ(0, getTableScanRuntimeStats(task)["skippedSplits"].sum);
+  EXPECT_EQ(0, getTableScanRuntimeStats(task)["dynamicFiltersAccepted"].sum);
+}
+
 TEST_F(TableScanTest, fileNotFound) {
   auto split = HiveConnectorSplitBuilder("/path/to/nowhere.orc").build();
   auto assertMissingFile = [&](bool ignoreMissingFiles) {
@@ -474,3 +474,47 @@ TEST_F(UnnestTest, batchSize) {
     ASSERT_EQ(1, stats.at(unnestId).outputVectors);
   }
 }
+
+TEST_F(UnnestTest, adaptiveBatchSize) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(10'000, [](auto row) { return row; }),
+  });
+  core::PlanNodeId unnestId;
+  auto plan = PlanBuilder()
+                  .values({data})
+                  .project({"sequence(1, 3) as s"})
+                  .unnest({}, {"s"})
+                  .capturePlanNodeId(unnestId)
+                  .planNode();
+  auto expected = makeRowVector({
+      makeFlatVector<int64_t>(10'000 * 3, [](auto row) { return 1 + row % 3; }),
+  });
+
+  auto runQuery = [&](bool adaptive) {
+    auto task = AssertQueryBuilder(plan)
+                    .config(core::QueryConfig::kPreferredOutputBatchRows, "17")
+                    .config(core::QueryConfig::kMaxOutputBatchRows, "17")
+                    .config(
+                        core::QueryConfig::kAdaptiveOutputBatchSizing,
+                        adaptive ? "true" : "false")
+                    .assertResults({expected});
+    return exec::toPlanStats(task->taskStats()).at(unnestId);
+  };
+
+  // 17 rows per output allows to unnest 6 input rows at a time.
+  auto stats = runQuery(false);
+  ASSERT_EQ(1 + 10'000 / 6, stats.outputVectors);
+  ASSERT_EQ(
+      stats.customStats.count(exec::Operator::kAdaptiveOutputBatchRows), 0);
+
+  // The query uses almost none of the memory it can get, so batches grow by
+  // at least 2x and by at most the default max scale of 4x.
+  stats = runQuery(true);
+  ASSERT_EQ(30'000, stats.outputRows);
+  ASSERT_LE(stats.outputVectors, 1 + 10'000 / 12);
+  ASSERT_GE(stats.outputVectors, 10'000 / 24);
+  const auto& batchRows =
+      stats.customStats.at(exec::Operator::kAdaptiveOutputBatchRows);
+  ASSERT_GE(batchRows.min, 2 * 17);
+  ASSERT_LE(batchRows.max, 4 * 17);
+}
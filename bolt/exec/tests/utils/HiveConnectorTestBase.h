@@ -262,6 +262,11 @@ class HiveConnectorSplitBuilder {
     return *this;
   }
 
+  HiveConnectorSplitBuilder& splitWeight(int64_t splitWeight) {
+    splitWeight_ = splitWeight;
+    return *this;
+  }
+
   HiveConnectorSplitBuilder& connectorId(const std::string& connectorId) {
     connectorId_ = connectorId;
     return *this;
@@ -282,7 +287,8 @@ class HiveConnectorSplitBuilder {
         serdeParameters_,
         0,
         std::nullopt,
-        infoColumns_);
+        infoColumns_,
+        splitWeight_);
   }
 
  private:
@@ -296,6 +302,7 @@ class HiveConnectorSplitBuilder {
   std::shared_ptr<std::string> extraFileInfo_ = {};
   std::unordered_map<std::string, std::string> serdeParameters_ = {};
   std::unordered_map<std::string, std::string> infoColumns_ = {};
+  int64_t splitWeight_{0};
   std::string connectorId_ = kHiveConnectorId;
 };
 
@@ -637,16 +637,31 @@ std::vector<std::shared_ptr<Expr>> compileExpressions(
   std::vector<std::shared_ptr<Expr>> exprs;
   exprs.reserve(sources.size());
 
+  // Rewrites that look at all the expressions together. The rewritten
+  // expressions must outlive compilation since 'scope' refers to them.
+  const auto& config = execCtx->queryCtx()->queryConfig();
+  std::vector<TypedExprPtr> rewrittenSources;
+  for (auto& rewrite : expressionSetRewrites()) {
+    auto rewritten =
+        rewrite(rewrittenSources.empty() ? sources : rewrittenSources, config);
+    if (!rewritten.empty()) {
+      BOLT_CHECK_EQ(rewritten.size(), sources.size());
+      rewrittenSources = std::move(rewritten);
+    }
+  }
+  const auto& compiledSources =
+      rewrittenSources.empty() ? sources : rewrittenSources;
+
   // Precompute a set of function calls that support flattening. This allows to
   // lock function registry once vs. locking for each function call.
-  auto flatteningCandidates = collectFlatteningCandidates(sources);
+  auto flatteningCandidates = collectFlatteningCandidates(compiledSources);
 
-  for (auto& source : sources) {
+  for (auto& source : compiledSources) {
 #ifdef ENABLE_BOLT_EXPR_JIT
     exprs.push_back(compileExpression(
         source,
         &scope,
-        execCtx->queryCtx()->queryConfig(),
+        config,
         execCtx->pool(),
         flatteningCandidates,
         enableConstantFolding,
@@ -655,7 +670,7 @@ std::vector<std::shared_ptr<Expr>> compileExpressions(
     exprs.push_back(compileExpression(
         source,
         &scope,
-        execCtx->queryCtx()->queryConfig(),
+        config,
         execCtx->pool(),
         flatteningCandidates,
         enableConstantFolding));
@@ -174,4 +174,13 @@ void registerExpressionRewrite(ExpressionRewrite rewrite) {
   expressionRewrites().push_front(rewrite);
 }
 
+std::deque<ExpressionSetRewrite>& expressionSetRewrites() {
+  static std::deque<ExpressionSetRewrite> rewrites;
+  return rewrites;
+}
+
+void registerExpressionSetRewrite(ExpressionSetRewrite rewrite) {
+  expressionSetRewrites().push_back(rewrite);
+}
+
 } // namespace bytedance::bolt::exec
@@ -325,6 +325,24 @@ std::deque<ExpressionRewrite>& expressionRewrites();
 /// non-null result terminates the re-write for this particular expression.
 void registerExpressionRewrite(ExpressionRewrite rewrite);
 
+/// A re-writer that takes all the expressions of an ExprSet and returns an
+/// equivalent list of the same size, or an empty list if re-write is not
+/// possible. Unlike ExpressionRewrite, it can combine sub-expressions of
+/// different expressions, e.g. to share work between them.
+using ExpressionSetRewrite = std::function<std::vector<core::TypedExprPtr>(
+    const std::vector<core::TypedExprPtr>&,
+    const core::QueryConfig&)>;
+
+/// Returns a list of registered expression set re-writes.
+std::deque<ExpressionSetRewrite>& expressionSetRewrites();
+
+/// Appends a 'rewrite' to 'expressionSetRewrites'.
+///
+/// Expression set rewrites run once per ExprSet before any expression is
+/// compiled and before the per-expression rewrites. They are applied in the
+/// order they were registered, each one to the output of the previous one.
+void registerExpressionSetRewrite(ExpressionSetRewrite rewrite);
+
 } // namespace bytedance::bolt::exec
 
 // Private. Return the external function name given a UDF tag.
@@ -115,6 +115,14 @@ DEFINE_bool(
 
 DEFINE_bool(bolt_memory_use_hugepages, true, "Use explicit huge pages");
 
+// Used in common/memory/NumaTopology.cpp
+DEFINE_string(
+    bolt_numa_topology,
+    "",
+    "Overrides the detected NUMA topology with one CPU list per node, "
+    "separated by ';', e.g. '0-3;4-7'. Lets NUMA placement be tested on a "
+    "single node host");
+
 DEFINE_int32(
     shuffle_zstd_compression_level,
     0,
@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/functions/lib/MultiPatternMatch.h"
+
+#include <algorithm>
+#include <deque>
+
+#include "bolt/expression/DecodedArgs.h"
+#include "bolt/functions/lib/Re2Functions.h"
+namespace bytedance::bolt::functions {
+namespace {
+
+using ::re2::RE2;
+
+re2::StringPiece toStringPiece(std::string_view string) {
+  return re2::StringPiece(string.data(), string.size());
+}
+
+// Appends the inputs of 'expr' to 'inputs', descending into nested OR calls.
+void collectOrInputs(
+    const core::TypedExprPtr& expr,
+    std::vector<core::TypedExprPtr>& inputs) {
+  auto call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+  if (call == nullptr || call->name() != "or") {
+    inputs.push_back(expr);
+    return;
+  }
+  for (const auto& input : call->inputs()) {
+    collectOrInputs(input, inputs);
+  }
+}
+
+// The rewrite registered by registerMultiLikeRewrite. A named type so that
+// registered instances can be found in exec::expressionRewrites().
+struct MultiLikeRewrite {
+  std::string likeName;
+  std::string rlikeName;
+  std::string multiLikeAnyName;
+  std::function<bool(const std::string&)> isSupportedRegex;
+
+  core::TypedExprPtr operator()(const core::TypedExprPtr& expr) const {
+    return rewriteMultiLikeCall(
+        likeName, rlikeName, multiLikeAnyName, isSupportedRegex, expr);
+  }
+};
+
+} // namespace
+
+MultiPatternMatcher::MultiPatternMatcher(
+    const std::vector<MultiPattern>& patterns,
+    int64_t maxRegexMemory)
+    : numPatterns_(patterns.size()), regexOptions_(RE2::Quiet) {
+  BOLT_USER_CHECK_LT(
+      patterns.size(),
+      std::numeric_limits<int32_t>::max(),
+      "Too many patterns");
+
+  // LIKE patterns are matched on the whole input, so '.' must also match a
+  // new line. The set shares one set of options, so the flag is set per LIKE
+  // pattern and the regexes keep the defaults of re2_search.
+  regexOptions_.set_max_mem(maxRegexMemory);
+  for (int32_t i = 0; i < patterns.size(); ++i) {
+    const auto& pattern = patterns[i];
+    std::string regex;
+    if (pattern.kind == MultiPattern::Kind::kLike) {
+      const auto metadata = determinePatternKind(pattern.pattern, std::nullopt);
+      if (!metadata.fixedPattern.empty()) {
+        switch (metadata.patternKind) {
+          case PatternKind::kFixed:
+            addLiteral(metadata.fixedPattern, i, Anchor::kBoth);
+            continue;
+          case PatternKind::kPrefix:
+            addLiteral(metadata.fixedPattern, i, Anchor::kStart);
+            continue;
+          case PatternKind::kSuffix:
+            addLiteral(metadata.fixedPattern, i, Anchor::kEnd);
+            continue;
+          case PatternKind::kSubstring:
+            addLiteral(metadata.fixedPattern, i, Anchor::kNone);
+            continue;
+          default:
+            break;
+        }
+      }
+      bool validPattern;
+      regex = fmt::format(
+          "(?s:{})",
+          likePatternToRe2(
+              StringView(pattern.pattern), std::nullopt, validPattern));
+    } else {
+      regex = pattern.pattern;
+    }
+
+    if (regexSet_ == nullptr) {
+      regexSet_ = std::make_unique<RE2::Set>(regexOptions_, RE2::UNANCHORED);
+    }
+    std::string error;
+    const auto regexIndex = regexSet_->Add(toStringPiece(regex), &error);
+    if (regexIndex < 0) {
+      BOLT_USER_FAIL("invalid regular expression:{}", error);
+    }
+    BOLT_CHECK_EQ(regexIndex, static_cast<int>(regexPatternIndices_.size()));
+    regexPatternIndices_.push_back(i);
+    regexStrings_.push_back(std::move(regex));
+    minRegexIndex_ = std::min(minRegexIndex_, i);
+  }
+
+  if (regexSet_ != nullptr && !regexSet_->Compile()) {
+    BOLT_USER_FAIL("Patterns are too large to compile into one regex set");
+  }
+  buildAutomaton();
+}
+
+void MultiPatternMatcher::addLiteral(
+    const std::string& literal,
+    int32_t patternIndex,
+    Anchor anchor) {
+  if (transitions_.empty()) {
+    // Bytes are assigned to classes on the fly, so the root starts with room
+    // for every possible class and the table is compacted in
+    // buildAutomaton().
+    transitions_.assign(257, -1);
+    outputs_.emplace_back();
+  }
+  int32_t state = 0;
+  for (const char c : literal) {
+    auto& byteClass = byteClass_[static_cast<uint8_t>(c)];
+    if (byteClass == 0) {
+      byteClass = numClasses_++;
+    }
+    auto next = transitions_[state * 257 + byteClass];
+    if (next == -1) {
+      next = outputs_.size();
+      transitions_[state * 257 + byteClass] = next;
+      transitions_.resize(transitions_.size() + 257, -1);
+      outputs_.emplace_back();
+    }
+    state = next;
+  }
+  outputs_[state].push_back(
+      {patternIndex, static_cast<uint32_t>(literal.size()), anchor});
+  minLiteralIndex_ = std::min(minLiteralIndex_, patternIndex);
+}
+
+void MultiPatternMatcher::buildAutomaton() {
+  if (transitions_.empty()) {
+    return;
+  }
+  const auto numStates = outputs_.size();
+
+  // Compact the trie from 257 columns per state down to 'numClasses_'.
+  std::vector<int32_t> transitions(numStates * numClasses_);
+  for (auto state = 0; state < numStates; ++state) {
+    std::copy_n(
+        transitions_.begin() + state * 257,
+        numClasses_,
+        transitions.begin() + state * numClasses_);
+  }
+  transitions_ = std::move(transitions);
+
+  // Replace the missing trie edges with the transitions of the failure state,
+  // visiting states in breadth first order so that the failure state of each
+  // state is complete before the state itself.
+  std::vector<int32_t> failure(numStates, 0);
+  outputLinks_.assign(numStates, -1);
+  std::deque<int32_t> queue;
+  for (auto byteClass = 0; byteClass < numClasses_; ++byteClass) {
+    auto& next = transitions_[byteClass];
+    if (next == -1) {
+      next = 0;
+    } else {
+      queue.push_back(next);
+    }
+  }
+  while (!queue.empty()) {
+    const auto state = queue.front();
+    queue.pop_front();
+    const auto* stateFailure = &transitions_[failure[state] * numClasses_];
+    for (auto byteClass = 0; byteClass < numClasses_; ++byteClass) {
+      auto& next = transitions_[state * numClasses_ + byteClass];
+      if (next == -1) {
+        next = stateFailure[byteClass];
+        continue;
+      }
+      failure[next] = stateFailure[byteClass];
+      outputLinks_[next] = outputs_[failure[next]].empty()
+          ? outputLinks_[failure[next]]
+          : failure[next];
+      queue.push_back(next);
+    }
+  }
+}
+
+int32_t MultiPatternMatcher::firstLiteralMatch(
+    std::string_view input,
+    int32_t bound) const {
+  if (minLiteralIndex_ >= bound) {
+    return bound;
+  }
+  const auto size = input.size();
+  int32_t state = 0;
+  for (size_t i = 0; i < size; ++i) {
+    state = transitions_
+        [state * numClasses_ + byteClass_[static_cast<uint8_t>(input[i])]];
+    for (auto match = outputs_[state].empty() ? outputLinks_[state] : state;
+         match != -1;
+         match = outputLinks_[match]) {
+      for (const auto& literal : outputs_[match]) {
+        if (literal.patternIndex >= bound) {
+          continue;
+        }
+        const bool atStart = i + 1 == literal.length;
+        const bool atEnd = i + 1 == size;
+        switch (literal.anchor) {
+          case Anchor::kNone:
+            break;
+          case Anchor::kStart:
+            if (!atStart) {
+              continue;
+            }
+            break;
+          case Anchor::kEnd:
+            if (!atEnd) {
+              continue;
+            }
+            break;
+          case Anchor::kBoth:
+            if (!atStart || !atEnd) {
+              continue;
+            }
+            break;
+        }
+        bound = literal.patternIndex;
+      }
+    }
+    if (bound == minLiteralIndex_) {
+      break;
+    }
+  }
+  return bound;
+}
+
+int32_t MultiPatternMatcher::firstRegexMatch(
+    std::string_view input,
+    int32_t bound) const {
+  if (minRegexIndex_ >= bound) {
+    return bound;
+  }
+  std::vector<int> matches;
+  RE2::Set::ErrorInfo errorInfo;
+  if (!regexSet_->Match(toStringPiece(input), &matches, &errorInfo)) {
+    if (errorInfo.kind == RE2::Set::kOutOfMemory) {
+      return firstRegexMatchOneByOne(input, bound);
+    }
+    BOLT_CHECK(
+        errorInfo.kind == RE2::Set::kNoError,
+        "Regex set match failed with error {}",
+        static_cast<int>(errorInfo.kind));
+    return bound;
+  }
+  for (const auto match : matches) {
+    bound = std::min(bound, regexPatternIndices_[match]);
+  }
+  return bound;
+}
+
+int32_t MultiPatternMatcher::firstRegexMatchOneByOne(
+    std::string_view input,
+    int32_t bound) const {
+  std::call_once(regexesCompiled_, [&]() {
+    regexes_.reserve(regexStrings_.size());
+    for (const auto& regex : regexStrings_) {
+      regexes_.push_back(
+          std::make_unique<RE2>(toStringPiece(regex), regexOptions_));
+    }
+  });
+  // The regexes are in pattern order, so the first match is the smallest.
+  for (auto i = 0; i < regexes_.size() && regexPatternIndices_[i] < bound;
+       ++i) {
+    if (RE2::PartialMatch(toStringPiece(input), *regexes_[i])) {
+      return regexPatternIndices_[i];
+    }
+  }
+  return bound;
+}
+
+int32_t MultiPatternMatcher::firstMatch(std::string_view input) const {
+  const int32_t noMatch = numPatterns_;
+  const auto index = firstRegexMatch(input, firstLiteralMatch(input, noMatch));
+  return index == noMatch ? -1 : index;
+}
+
+namespace {
+
+// Implements multi_like_index and multi_like_any. T is the result type, the
+// 1-based index of the first matching pattern or whether any pattern matches.
+template <typename T>
+class MultiLikeFunction final : public exec::VectorFunction {
+ public:
+  explicit MultiLikeFunction(
+      std::shared_ptr<const MultiPatternMatcher> matcher)
+      : matcher_(std::move(matcher)) {}
+
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const final {
+    exec::DecodedArgs decodedArgs(rows, {args[0]}, context);
+    auto* input = decodedArgs.at(0);
+    context.ensureWritable(rows, outputType, result);
+    auto* flatResult = result->asUnchecked<FlatVector<T>>();
+
+    if (input->isConstantMapping()) {
+      const auto value = toResult(input->valueAt<StringView>(0));
+      context.applyToSelectedNoThrow(
+          rows, [&](vector_size_t row) { flatResult->set(row, value); });
+      return;
+    }
+    context.applyToSelectedNoThrow(rows, [&](vector_size_t row) {
+      flatResult->set(row, toResult(input->valueAt<StringView>(row)));
+    });
+  }
+
+ private:
+  T toResult(StringView input) const {
+    const auto index =
+        matcher_->firstMatch(std::string_view(input.data(), input.size()));
+    if constexpr (std::is_same_v<T, bool>) {
+      return index >= 0;
+    } else {
+      return index + 1;
+    }
+  }
+
+  const std::shared_ptr<const MultiPatternMatcher> matcher_;
+};
+
+template <typename T>
+std::shared_ptr<exec::VectorFunction> makeMultiLike(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs) {
+  BOLT_CHECK_GE(inputArgs.size(), 3);
+  for (auto i = 1; i < inputArgs.size(); ++i) {
+    const auto& constant = inputArgs[i].constantValue;
+    if (constant == nullptr) {
+      BOLT_USER_FAIL("{} requires constant patterns.", name);
+    }
+    if (constant->isNullAt(0)) {
+      return std::make_shared<exec::ApplyNeverCalled>();
+    }
+  }
+
+  auto constantString = [&](size_t i) {
+    return inputArgs[i]
+        .constantValue->as<ConstantVector<StringView>>()
+        ->valueAt(0)
+        .str();
+  };
+
+  try {
+    const auto kinds = constantString(1);
+    BOLT_USER_CHECK_EQ(
+        kinds.size(),
+        inputArgs.size() - 2,
+        "{} requires one pattern kind per pattern",
+        name);
+    std::vector<MultiPattern> patterns;
+    patterns.reserve(kinds.size());
+    for (auto i = 0; i < kinds.size(); ++i) {
+      MultiPattern::Kind kind;
+      switch (kinds[i]) {
+        case 'L':
+          kind = MultiPattern::Kind::kLike;
+          break;
+        case 'R':
+          kind = MultiPattern::Kind::kRegex;
+          break;
+        default:
+          BOLT_USER_FAIL("Unknown pattern kind '{}' in {}", kinds[i], name);
+      }
+      patterns.push_back({kind, constantString(i + 2)});
+    }
+    return std::make_shared<MultiLikeFunction<T>>(
+        std::make_shared<const MultiPatternMatcher>(patterns));
+  } catch (...) {
+    return std::make_shared<exec::AlwaysFailingVectorFunction>(
+        std::current_exception());
+  }
+}
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> multiLikeSignatures(
+    const std::string& returnType) {
+  // varchar, constant varchar, constant varchar... -> returnType
+  return {exec::FunctionSignatureBuilder()
+              .returnType(returnType)
+              .argumentType("varchar")
+              .constantArgumentType("varchar")
+              .constantArgumentType("varchar")
+              .variableArity()
+              .build()};
+}
+
+// Returns the constant non-null string value of 'expr' or std::nullopt if
+// 'expr' is not such a constant.
+std::optional<std::string> toConstantString(const core::TypedExprPtr& expr) {
+  auto constant = dynamic_cast<const core::ConstantTypedExpr*>(expr.get());
+  if (constant == nullptr || !constant->type()->isVarchar()) {
+    return std::nullopt;
+  }
+  if (constant->hasValueVector()) {
+    const auto& vector = constant->valueVector();
+    if (vector->isNullAt(0)) {
+      return std::nullopt;
+    }
+    return vector->as<SimpleVector<StringView>>()->valueAt(0).str();
+  }
+  if (constant->value().isNull()) {
+    return std::nullopt;
+  }
+  return constant->value().value<TypeKind::VARCHAR>();
+}
+
+} // namespace
+
+std::shared_ptr<exec::VectorFunction> makeMultiLikeIndex(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& /*config*/) {
+  return makeMultiLike<int32_t>(name, inputArgs);
+}
+
+std::vector<std::shared_ptr<exec::FunctionSignature>>
+multiLikeIndexSignatures() {
+  return multiLikeSignatures("integer");
+}
+
+std::shared_ptr<exec::VectorFunction> makeMultiLikeAny(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& /*config*/) {
+  return makeMultiLike<bool>(name, inputArgs);
+}
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> multiLikeAnySignatures() {
+  return multiLikeSignatures("boolean");
+}
+
+core::TypedExprPtr rewriteMultiLikeCall(
+    const std::string& likeName,
+    const std::string& rlikeName,
+    const std::string& multiLikeAnyName,
+    const std::function<bool(const std::string&)>& isSupportedRegex,
+    const core::TypedExprPtr& expr) {
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(expr);
+  if (call == nullptr || call->name() != "or" || call->inputs().size() < 2) {
+    return nullptr;
+  }
+  // Parsers produce binary OR trees, e.g. or(or(a, b), c). Combine the calls
+  // across the whole tree.
+  std::vector<core::TypedExprPtr> inputs;
+  collectOrInputs(expr, inputs);
+
+  // Calls to combine, grouped by their string argument in order of the first
+  // call of each group.
+  struct Group {
+    core::TypedExprPtr input;
+    std::string kinds;
+    std::vector<core::TypedExprPtr> patterns;
+  };
+  std::vector<Group> groups;
+  std::vector<int32_t> inputGroups(inputs.size(), -1);
+
+  for (auto i = 0; i < inputs.size(); ++i) {
+    auto patternCall =
+        dynamic_cast<const core::CallTypedExpr*>(inputs[i].get());
+    if (patternCall == nullptr || patternCall->inputs().size() != 2 ||
+        !patternCall->inputs()[0]->type()->isVarchar()) {
+      continue;
+    }
+    char kind;
+    if (!likeName.empty() && patternCall->name() == likeName) {
+      kind = 'L';
+    } else if (!rlikeName.empty() && patternCall->name() == rlikeName) {
+      kind = 'R';
+    } else {
+      continue;
+    }
+    const auto& patternExpr = patternCall->inputs()[1];
+    const auto pattern = toConstantString(patternExpr);
+    if (!pattern.has_value()) {
+      continue;
+    }
+    // Invalid regexes keep their own call so that they fail as before.
+    if (kind == 'R' &&
+        (!isSupportedRegex(pattern.value()) ||
+         !RE2(toStringPiece(pattern.value()), RE2::Quiet).ok())) {
+      continue;
+    }
+
+    const auto& stringExpr = patternCall->inputs()[0];
+    auto group =
+        std::find_if(groups.begin(), groups.end(), [&](const auto& existing) {
+          return *existing.input == *stringExpr;
+        });
+    if (group == groups.end()) {
+      group = groups.insert(groups.end(), Group{stringExpr, "", {}});
+    }
+    group->kinds.push_back(kind);
+    group->patterns.push_back(patternExpr);
+    inputGroups[i] = group - groups.begin();
+  }
+
+  if (std::none_of(groups.begin(), groups.end(), [](const auto& group) {
+        return group.patterns.size() > 1;
+      })) {
+    return nullptr;
+  }
+
+  std::vector<core::TypedExprPtr> newInputs;
+  std::vector<bool> groupAdded(groups.size(), false);
+  for (auto i = 0; i < inputs.size(); ++i) {
+    const auto groupIndex = inputGroups[i];
+    if (groupIndex == -1 || groups[groupIndex].patterns.size() == 1) {
+      newInputs.push_back(inputs[i]);
+      continue;
+    }
+    if (groupAdded[groupIndex]) {
+      continue;
+    }
+    groupAdded[groupIndex] = true;
+    auto& group = groups[groupIndex];
+    std::vector<core::TypedExprPtr> args;
+    args.reserve(group.patterns.size() + 2);
+    args.push_back(group.input);
+    args.push_back(
+        std::make_shared<core::ConstantTypedExpr>(
+            VARCHAR(), variant(group.kinds)));
+    args.insert(args.end(), group.patterns.begin(), group.patterns.end());
+    newInputs.push_back(std::make_shared<core::CallTypedExpr>(
+        BOOLEAN(), std::move(args), multiLikeAnyName));
+  }
+
+  if (newInputs.size() == 1) {
+    return newInputs[0];
+  }
+  return std::make_shared<core::CallTypedExpr>(
+      call->type(), std::move(newInputs), call->name());
+}
+
+void registerMultiLikeRewrite(
+    const std::string& likeName,
+    const std::string& rlikeName,
+    const std::string& multiLikeAnyName,
+    std::function<bool(const std::string&)> isSupportedRegex) {
+  for (const auto& rewrite : exec::expressionRewrites()) {
+    auto existing = rewrite.target<MultiLikeRewrite>();
+    if (existing != nullptr && existing->multiLikeAnyName == multiLikeAnyName) {
+      return;
+    }
+  }
+  exec::registerExpressionRewrite(MultiLikeRewrite{
+      likeName, rlikeName, multiLikeAnyName, std::move(isSupportedRegex)});
+}
+
+void unregisterMultiLikeRewrites() {
+  auto& rewrites = exec::expressionRewrites();
+  rewrites.erase(
+      std::remove_if(
+          rewrites.begin(),
+          rewrites.end(),
+          [](const auto& rewrite) {
+            return rewrite.template target<MultiLikeRewrite>() != nullptr;
+          }),
+      rewrites.end());
+}
+
+} // namespace bytedance::bolt::functions
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <re2/re2.h>
+#include <re2/set.h>
+
+#include "bolt/core/Expressions.h"
+#include "bolt/expression/VectorFunction.h"
+namespace bytedance::bolt::functions {
+
+/// One pattern of a MultiPatternMatcher.
+struct MultiPattern {
+  enum class Kind {
+    /// SQL LIKE pattern without an escape character. Must match the whole
+    /// input.
+    kLike,
+    /// RE2 regular expression. Matches if it matches any substring of the
+    /// input, as in re2_search and rlike.
+    kRegex,
+  };
+
+  Kind kind;
+  std::string pattern;
+};
+
+/// Evaluates a list of constant LIKE and regex patterns against one string in
+/// a single pass.
+///
+/// LIKE patterns that reduce to a fixed, prefix, suffix or substring literal
+/// are compiled into one byte-level Aho-Corasick automaton. Every literal
+/// occurrence found by the automaton is checked against the anchoring of its
+/// pattern. All remaining patterns are compiled into one RE2::Set, which is
+/// consulted only when a regex pattern precedes the best literal match. If
+/// the DFA of the set runs out of memory on an input, the regexes are matched
+/// one at a time instead.
+class MultiPatternMatcher {
+ public:
+  /// Default memory budget of the regex set. Same as the default of RE2.
+  static constexpr int64_t kDefaultMaxRegexMemory = 8 << 20;
+
+  /// Throws a user error if a regex is not valid RE2 syntax. 'maxRegexMemory'
+  /// is the memory budget of the regex set and of each regex, see
+  /// RE2::Options::max_mem.
+  explicit MultiPatternMatcher(
+      const std::vector<MultiPattern>& patterns,
+      int64_t maxRegexMemory = kDefaultMaxRegexMemory);
+
+  /// Returns the 0-based index of the first pattern in declaration order that
+  /// matches 'input', or -1 if none does.
+  int32_t firstMatch(std::string_view input) const;
+
+  size_t numPatterns() const {
+    return numPatterns_;
+  }
+
+ private:
+  // Anchoring a literal occurrence must satisfy for the pattern to match.
+  enum class Anchor : uint8_t {
+    kNone,
+    kStart,
+    kEnd,
+    kBoth,
+  };
+
+  struct Literal {
+    int32_t patternIndex;
+    uint32_t length;
+    Anchor anchor;
+  };
+
+  void addLiteral(
+      const std::string& literal,
+      int32_t patternIndex,
+      Anchor anchor);
+
+  void buildAutomaton();
+
+  // Returns the smallest pattern index among the literal patterns matching
+  // 'input' that is less than 'bound', or 'bound' if there is none.
+  int32_t firstLiteralMatch(std::string_view input, int32_t bound) const;
+
+  int32_t firstRegexMatch(std::string_view input, int32_t bound) const;
+
+  // Same as firstRegexMatch but matches the regexes one at a time. Used when
+  // the DFA of 'regexSet_' runs out of memory. A single RE2 then falls back
+  // to its NFA.
+  int32_t firstRegexMatchOneByOne(std::string_view input, int32_t bound) const;
+
+  size_t numPatterns_;
+
+  // Maps each input byte to its column in 'transitions_'. Bytes that do not
+  // occur in any literal share column 0.
+  std::array<uint16_t, 256> byteClass_{};
+  uint16_t numClasses_{1};
+
+  // Dense goto function of the automaton, 'numClasses_' entries per state.
+  // Built from the trie by following failure links, so matching never
+  // backtracks.
+  std::vector<int32_t> transitions_;
+
+  // Literals ending at each state.
+  std::vector<std::vector<Literal>> outputs_;
+
+  // Nearest state on the failure chain with a non-empty output, or -1.
+  std::vector<int32_t> outputLinks_;
+
+  // Smallest pattern index of any literal. Scanning stops once found.
+  int32_t minLiteralIndex_{std::numeric_limits<int32_t>::max()};
+
+  re2::RE2::Options regexOptions_;
+
+  std::unique_ptr<re2::RE2::Set> regexSet_;
+
+  // Pattern index of each regex in 'regexSet_'.
+  std::vector<int32_t> regexPatternIndices_;
+
+  // Each regex of 'regexSet_'. Compiled into 'regexes_' on the first match
+  // that needs them.
+  std::vector<std::string> regexStrings_;
+  mutable std::once_flag regexesCompiled_;
+  mutable std::vector<std::unique_ptr<re2::RE2>> regexes_;
+
+  // Smallest pattern index of any regex.
+  int32_t minRegexIndex_{std::numeric_limits<int32_t>::max()};
+};
+
+/// multi_like_index(string, kinds, pattern1, pattern2, ...) -> integer
+///
+/// Returns the 1-based position of the first pattern matching 'string', or 0
+/// if none matches. 'kinds' is a constant string with one character per
+/// pattern: 'L' for a LIKE pattern and 'R' for a regex searched anywhere in
+/// the string. All the patterns must be constant.
+std::shared_ptr<exec::VectorFunction> makeMultiLikeIndex(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& config);
+
+std::vector<std::shared_ptr<exec::FunctionSignature>>
+multiLikeIndexSignatures();
+
+/// multi_like_any(string, kinds, pattern1, pattern2, ...) -> boolean
+///
+/// Returns whether any of the patterns matches 'string'. Arguments are the
+/// same as for multi_like_index.
+std::shared_ptr<exec::VectorFunction> makeMultiLikeAny(
+    const std::string& name,
+    const std::vector<exec::VectorFunctionArg>& inputArgs,
+    const core::QueryConfig& config);
+
+std::vector<std::shared_ptr<exec::FunctionSignature>> multiLikeAnySignatures();
+
+/// Rewrites the 'likeName' and 'rlikeName' calls inside an OR that share the
+/// same string argument and have constant, non-null patterns into a single
+/// 'multiLikeAnyName' call, e.g.
+///     like(c0, 'a%') OR c1 > 0 OR rlike(c0, 'b+c') OR like(c0, '%d%')
+/// becomes
+///     multi_like_any(c0, 'LRL', 'a%', 'b+c', '%d%') OR c1 > 0
+///
+/// Nested OR calls are flattened, so that the calls of a binary tree such as
+/// or(or(like(c0, 'a%'), like(c0, 'b%')), like(c0, 'c%')) form one group and
+/// the result is a single OR over all the remaining inputs.
+///
+/// LIKE calls with an escape argument are left as is. Regex patterns are only
+/// grouped if 'isSupportedRegex' accepts them. Returns nullptr if no group of
+/// at least two calls is found. Either name may be empty to skip that function.
+core::TypedExprPtr rewriteMultiLikeCall(
+    const std::string& likeName,
+    const std::string& rlikeName,
+    const std::string& multiLikeAnyName,
+    const std::function<bool(const std::string&)>& isSupportedRegex,
+    const core::TypedExprPtr& expr);
+
+/// Registers an expression rewrite that applies rewriteMultiLikeCall with
+/// these names. Does nothing if a rewrite producing 'multiLikeAnyName' calls
+/// is already registered, so registering a function set twice is harmless.
+void registerMultiLikeRewrite(
+    const std::string& likeName,
+    const std::string& rlikeName,
+    const std::string& multiLikeAnyName,
+    std::function<bool(const std::string&)> isSupportedRegex);
+
+/// Removes all the rewrites added by registerMultiLikeRewrite, e.g. to
+/// evaluate OR chains as written. Other rewrites are kept.
+void unregisterMultiLikeRewrites();
+
+} // namespace bytedance::bolt::functions
@@ -138,6 +138,8 @@ bool re2Extract(
   }
 }
 
+} // namespace
+
 std::string likePatternToRe2(
     StringView pattern,
     std::optional<char> escapeChar,
@@ -194,6 +196,8 @@ std::string likePatternToRe2(
   return regex;
 }
 
+namespace {
+
 template <bool (*Fn)(StringView, const RE2&)>
 class Re2MatchConstantPattern final : public VectorFunction {
  public:
@@ -136,6 +136,14 @@ PatternMetadata determinePatternKind(
     std::string_view pattern,
     std::optional<char> escapeChar);
 
+/// Converts a LIKE pattern into an RE2 pattern anchored at both ends. Sets
+/// 'validPattern' to false if 'escapeChar' is followed by a character other
+/// than '%', '_' or itself, or ends the pattern.
+std::string likePatternToRe2(
+    StringView pattern,
+    std::optional<char> escapeChar,
+    bool& validPattern);
+
 std::shared_ptr<exec::VectorFunction> makeLike(
     const std::string& name,
     const std::vector<exec::VectorFunctionArg>& inputArgs,
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/functions/lib/MultiPatternMatch.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "bolt/common/base/tests/GTestUtils.h"
+#include "bolt/functions/lib/Re2Functions.h"
+#include "bolt/functions/prestosql/tests/utils/FunctionBaseTest.h"
+namespace bytedance::bolt::functions {
+namespace {
+
+class MultiPatternMatchTest : public test::FunctionBaseTest {
+ public:
+  static void SetUpTestCase() {
+    test::FunctionBaseTest::SetUpTestCase();
+    exec::registerStatefulVectorFunction("like", likeSignatures(), makeLike);
+    exec::registerStatefulVectorFunction(
+        "rlike", re2SearchSignatures(), makeRe2Search);
+    exec::registerStatefulVectorFunction(
+        "multi_like_index", multiLikeIndexSignatures(), makeMultiLikeIndex);
+    exec::registerStatefulVectorFunction(
+        "multi_like_any", multiLikeAnySignatures(), makeMultiLikeAny);
+  }
+
+ protected:
+  static MultiPattern like(const std::string& pattern) {
+    return {MultiPattern::Kind::kLike, pattern};
+  }
+
+  static MultiPattern regex(const std::string& pattern) {
+    return {MultiPattern::Kind::kRegex, pattern};
+  }
+
+  core::TypedExprPtr rewrite(const std::string& expression) {
+    return rewriteMultiLikeCall(
+        "like",
+        "rlike",
+        "multi_like_any",
+        [](const std::string& pattern) {
+          return pattern.find('[') == std::string::npos;
+        },
+        makeTypedExpr(expression, ROW({"c0", "c1"}, {VARCHAR(), VARCHAR()})));
+  }
+};
+
+TEST_F(MultiPatternMatchTest, literals) {
+  MultiPatternMatcher matcher({
+      like("abc"),
+      like("ab%"),
+      like("%bc"),
+      like("%b%"),
+      like("%%he%%"),
+  });
+  EXPECT_EQ(matcher.firstMatch("abc"), 0);
+  EXPECT_EQ(matcher.firstMatch("abd"), 1);
+  EXPECT_EQ(matcher.firstMatch("xbc"), 2);
+  EXPECT_EQ(matcher.firstMatch("xbx"), 3);
+  EXPECT_EQ(matcher.firstMatch("she"), 4);
+  EXPECT_EQ(matcher.firstMatch("shx"), -1);
+  EXPECT_EQ(matcher.firstMatch(""), -1);
+  // Literals that overlap or are suffixes of each other.
+  MultiPatternMatcher overlapping({like("%aab"), like("%ab%"), like("b%")});
+  EXPECT_EQ(overlapping.firstMatch("aaab"), 0);
+  EXPECT_EQ(overlapping.firstMatch("aaba"), 1);
+  EXPECT_EQ(overlapping.firstMatch("bbb"), 2);
+}
+
+TEST_F(MultiPatternMatchTest, regexes) {
+  MultiPatternMatcher matcher({
+      like("a_c"),
+      regex("x+y"),
+      like("%needle%"),
+      regex("^\\d{3}$"),
+      like(""),
+      like("%"),
+  });
+  EXPECT_EQ(matcher.firstMatch("abc"), 0);
+  EXPECT_EQ(matcher.firstMatch("a\nc"), 0);
+  EXPECT_EQ(matcher.firstMatch("--xxy--needle"), 1);
+  EXPECT_EQ(matcher.firstMatch("a needle"), 2);
+  EXPECT_EQ(matcher.firstMatch("123"), 3);
+  EXPECT_EQ(matcher.firstMatch(""), 4);
+  EXPECT_EQ(matcher.firstMatch("1234"), 5);
+
+  BOLT_ASSERT_USER_THROW(
+      MultiPatternMatcher({regex("(a")}), "invalid regular expression");
+}
+
+TEST_F(MultiPatternMatchTest, regexSetOutOfMemory) {
+  // The DFA of the set needs a state for each combination of the positions
+  // of the last 'a's, so it runs out of a small budget on a long input and
+  // the regexes are matched one at a time.
+  std::vector<MultiPattern> patterns;
+  std::vector<std::unique_ptr<re2::RE2>> regexes;
+  for (auto i = 0; i < 16; ++i) {
+    patterns.push_back(regex(fmt::format("a[ab]{{{}}}x{}", 8 + i, i % 10)));
+    regexes.push_back(std::make_unique<re2::RE2>(patterns.back().pattern));
+  }
+  MultiPatternMatcher matcher(patterns, 1 << 20);
+
+  std::mt19937 rng(1);
+  for (auto digit = 0; digit < 10; ++digit) {
+    std::string input;
+    for (auto i = 0; i < 100'000; ++i) {
+      input.push_back(rng() % 2 == 0 ? 'a' : 'b');
+    }
+    input += fmt::format("x{}", digit);
+    int32_t expected = -1;
+    for (auto i = 0; i < regexes.size(); ++i) {
+      if (re2::RE2::PartialMatch(input, *regexes[i])) {
+        expected = i;
+        break;
+      }
+    }
+    EXPECT_EQ(matcher.firstMatch(input), expected) << "digit " << digit;
+  }
+}
+
+TEST_F(MultiPatternMatchTest, multiLikeIndex) {
+  auto data = makeRowVector({makeNullableFlatVector<std::string>(
+      {"apple", "banana", "cherry", std::nullopt, "date", "fig"})});
+  auto result = evaluate(
+      "multi_like_index(c0, 'LRLL', '%an%', 'e.r', 'a%', '%e')", data);
+  assertEqualVectors(
+      makeNullableFlatVector<int32_t>({3, 1, 2, std::nullopt, 4, 0}), result);
+
+  result =
+      evaluate("multi_like_any(c0, 'LRLL', '%an%', 'e.r', 'a%', '%e')", data);
+  assertEqualVectors(
+      makeNullableFlatVector<bool>(
+          {true, true, true, std::nullopt, true, false}),
+      result);
+
+  BOLT_ASSERT_THROW(
+      evaluate("multi_like_index(c0, 'LR', 'a%', 'b%', 'c%')", data),
+      "multi_like_index requires one pattern kind per pattern");
+  BOLT_ASSERT_THROW(
+      evaluate("multi_like_index(c0, 'LX', 'a%', 'b%')", data),
+      "Unknown pattern kind 'X' in multi_like_index");
+}
+
+TEST_F(MultiPatternMatchTest, rewrite) {
+  auto rewritten = rewrite(
+      "c0 like 'a%' or c1 like 'b%' or rlike(c0, 'c+d') or c0 like '%e'");
+  ASSERT_NE(rewritten, nullptr);
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(rewritten);
+  ASSERT_NE(call, nullptr);
+  EXPECT_EQ(call->name(), "or");
+  ASSERT_EQ(call->inputs().size(), 2);
+  auto multiLike =
+      std::dynamic_pointer_cast<const core::CallTypedExpr>(call->inputs()[0]);
+  EXPECT_EQ(multiLike->name(), "multi_like_any");
+  EXPECT_EQ(multiLike->inputs().size(), 5);
+  EXPECT_EQ(
+      std::dynamic_pointer_cast<const core::CallTypedExpr>(call->inputs()[1])
+          ->name(),
+      "like");
+
+  // All the inputs of the OR are combined.
+  rewritten = rewrite("c0 like 'a%' or c0 like '%b'");
+  ASSERT_NE(rewritten, nullptr);
+  call = std::dynamic_pointer_cast<const core::CallTypedExpr>(rewritten);
+  EXPECT_EQ(call->name(), "multi_like_any");
+  EXPECT_EQ(call->inputs().size(), 4);
+
+  // Nothing to combine.
+  EXPECT_EQ(rewrite("c0 like 'a%' or c1 like 'b%'"), nullptr);
+  EXPECT_EQ(rewrite("c0 like 'a%' and c0 like 'b%'"), nullptr);
+  EXPECT_EQ(rewrite("c0 like 'a%' or c0 like c1"), nullptr);
+  EXPECT_EQ(rewrite("c0 like 'a%' or like(c0, 'b%', '#')"), nullptr);
+  // Invalid and unsupported regexes keep their own call.
+  EXPECT_EQ(rewrite("c0 like 'a%' or rlike(c0, '(a')"), nullptr);
+  EXPECT_EQ(rewrite("c0 like 'a%' or rlike(c0, '[a[b]]')"), nullptr);
+
+  // The rewritten expression returns the same results.
+  auto data = makeRowVector({
+      makeNullableFlatVector<std::string>(
+          {"apple", "xccd", "blue", "ace", std::nullopt, "cde"}),
+      makeNullableFlatVector<std::string>(
+          {"x", "bb", "b", "x", "b", std::nullopt}),
+  });
+  const std::string expression =
+      "c0 like 'a%' or c1 like 'b%' or rlike(c0, 'c+d') or c0 like '%e'";
+  assertEqualVectors(
+      evaluate(expression, data), evaluate(rewrite(expression), data));
+}
+
+TEST_F(MultiPatternMatchTest, rewriteNestedOr) {
+  auto input = std::make_shared<core::FieldAccessTypedExpr>(VARCHAR(), "c0");
+  auto like = [&](const std::string& pattern) -> core::TypedExprPtr {
+    return std::make_shared<core::CallTypedExpr>(
+        BOOLEAN(),
+        std::vector<core::TypedExprPtr>{
+            input,
+            std::make_shared<core::ConstantTypedExpr>(
+                VARCHAR(), variant(pattern))},
+        "like");
+  };
+  auto makeOr = [](core::TypedExprPtr left, core::TypedExprPtr right) {
+    return std::make_shared<core::CallTypedExpr>(
+        BOOLEAN(),
+        std::vector<core::TypedExprPtr>{std::move(left), std::move(right)},
+        "or");
+  };
+  auto rewriteExpr = [](const core::TypedExprPtr& expr) {
+    return rewriteMultiLikeCall(
+        "like",
+        "rlike",
+        "multi_like_any",
+        [](const std::string& /*pattern*/) { return true; },
+        expr);
+  };
+  auto constantString = [](const core::TypedExprPtr& expr) {
+    return std::dynamic_pointer_cast<const core::ConstantTypedExpr>(expr)
+        ->value()
+        .value<std::string>();
+  };
+
+  // or(or(or(like(c0, p1), like(c0, p2)), like(c0, p3)), like(c0, p4))
+  const core::TypedExprPtr expr = makeOr(
+      makeOr(makeOr(like("a%"), like("%b")), like("%c%")), like("d_"));
+  auto rewritten = rewriteExpr(expr);
+  auto call = std::dynamic_pointer_cast<const core::CallTypedExpr>(rewritten);
+  ASSERT_NE(call, nullptr);
+  EXPECT_EQ(call->name(), "multi_like_any");
+  ASSERT_EQ(call->inputs().size(), 6);
+  EXPECT_EQ(constantString(call->inputs()[1]), "LLLL");
+  EXPECT_EQ(constantString(call->inputs()[2]), "a%");
+  EXPECT_EQ(constantString(call->inputs()[3]), "%b");
+  EXPECT_EQ(constantString(call->inputs()[4]), "%c%");
+  EXPECT_EQ(constantString(call->inputs()[5]), "d_");
+
+  auto data = makeRowVector({makeNullableFlatVector<std::string>(
+      {"apple", "xb", "xcx", "dd", std::nullopt, "zzz"})});
+  assertEqualVectors(evaluate(expr, data), evaluate(rewritten, data));
+
+  // Inputs that are not combined end up in one flat OR.
+  auto other = std::make_shared<core::FieldAccessTypedExpr>(BOOLEAN(), "c1");
+  call = std::dynamic_pointer_cast<const core::CallTypedExpr>(rewriteExpr(
+      makeOr(makeOr(like("a%"), other), makeOr(like("%b"), like("%c%")))));
+  ASSERT_NE(call, nullptr);
+  EXPECT_EQ(call->name(), "or");
+  ASSERT_EQ(call->inputs().size(), 2);
+  EXPECT_EQ(
+      std::dynamic_pointer_cast<const core::CallTypedExpr>(call->inputs()[0])
+          ->name(),
+      "multi_like_any");
+  EXPECT_EQ(call->inputs()[1], other);
+}
+
+TEST_F(MultiPatternMatchTest, registerRewrite) {
+  // The Presto functions registered by the fixture include the rewrite.
+  auto isSupported = [](const std::string& /*pattern*/) { return true; };
+  unregisterMultiLikeRewrites();
+  const auto numRewrites = exec::expressionRewrites().size();
+  registerMultiLikeRewrite("like", "rlike", "multi_like_any", isSupported);
+  EXPECT_EQ(exec::expressionRewrites().size(), numRewrites + 1);
+  // Registering the same rewrite again does nothing.
+  registerMultiLikeRewrite("like", "rlike", "multi_like_any", isSupported);
+  EXPECT_EQ(exec::expressionRewrites().size(), numRewrites + 1);
+
+  const auto rowType = ROW({"c0"}, {VARCHAR()});
+  auto exprSet = compileExpression("c0 like 'a%' or c0 like '%b'", rowType);
+  EXPECT_EQ(exprSet->exprs()[0]->name(), "multi_like_any");
+
+  unregisterMultiLikeRewrites();
+  EXPECT_EQ(exec::expressionRewrites().size(), numRewrites);
+  exprSet = compileExpression("c0 like 'a%' or c0 like '%b'", rowType);
+  EXPECT_EQ(exprSet->exprs()[0]->name(), "or");
+
+  registerMultiLikeRewrite("like", "rlike", "multi_like_any", isSupported);
+}
+
+} // namespace
+} // namespace bytedance::bolt::functions
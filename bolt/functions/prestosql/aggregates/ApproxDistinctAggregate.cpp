@@ -28,6 +28,8 @@
  * --------------------------------------------------------------------------
  */
 
+#include <array>
+
 #define XXH_INLINE_ALL
 #include <xxhash.h>
 
@@ -68,6 +70,16 @@ struct HllAccumulator {
     }
   }
 
+  void append(const uint64_t* hashes, int32_t numHashes) {
+    int32_t i = 0;
+    for (; isSparse_ && i < numHashes; ++i) {
+      append(hashes[i]);
+    }
+    if (i < numHashes) {
+      denseHll_.insertHashes(hashes + i, numHashes - i);
+    }
+  }
+
   int64_t cardinality() const {
     return isSparse_ ? sparseHll_.cardinality() : denseHll_.cardinality();
   }
@@ -286,18 +298,29 @@ class ApproxDistinctAggregate : public exec::Aggregate {
     } else {
       decodeArguments(rows, args);
 
+      // Hash a block of rows at a time and insert the hashes together, which
+      // keeps the hashing loop free of sketch updates.
+      std::array<uint64_t, kHashBlockSize> hashes;
+      int32_t numHashes = 0;
+      auto flush = [&]() {
+        auto accumulator = value<HllAccumulator>(group);
+        clearNull(group);
+        accumulator->setIndexBitLength(indexBitLength_);
+        accumulator->append(hashes.data(), numHashes);
+        numHashes = 0;
+      };
       rows.applyToSelected([&](auto row) {
         if (decodedValue_.isNullAt(row)) {
           return;
         }
-
-        auto accumulator = value<HllAccumulator>(group);
-        clearNull(group);
-        accumulator->setIndexBitLength(indexBitLength_);
-
-        auto hash = hashOne(decodedValue_.valueAt<T>(row));
-        accumulator->append(hash);
+        hashes[numHashes++] = hashOne(decodedValue_.valueAt<T>(row));
+        if (numHashes == kHashBlockSize) {
+          flush();
+        }
       });
+      if (numHashes > 0) {
+        flush();
+      }
     }
   }
 
@@ -423,6 +446,9 @@ class ApproxDistinctAggregate : public exec::Aggregate {
   int8_t indexBitLength_{
       common::hll::toIndexBitLength(common::hll::kDefaultStandardError)};
   double maxStandardError_{-1};
+  // Number of hashes addSingleGroupRawInput() computes before inserting them.
+  static constexpr int32_t kHashBlockSize = 256;
+
   DecodedVector decodedValue_;
   DecodedVector decodedMaxStandardError_;
   DecodedVector decodedHll_;
@@ -174,8 +174,6 @@ class JsonExtractor {
                                              buffer_.size(),
                                              /*realloc_if_needed=*/false)
                                          .get(root);
-      ans_.clear();
-
       if (simdErr) {
         if (throwExceptionWhenEncounterBadJson) {
           std::stringstream ss;
@@ -184,26 +182,7 @@ class JsonExtractor {
         }
         return folly::none;
       }
-
-      if (root.is_null() && path_ == "$") {
-        return std::string_view{"null"};
-      }
-
-      // The kGetJsonObjectEscapeEmoji option has no effect on
-      // the domElement scene, and regardless of the option, the domElement
-      // scene will still escape emoji and unescape ascii
-      if (!traversingByTokens(
-              root,
-              tokens_,
-              /*tokenIdx=*/0,
-              ans_,
-              boltToJsonString<true, domElement>,
-              /*wildcardCount=*/0)) {
-        return folly::none;
-      }
-
-      return std::string_view{ans_};
-
+      return extractFromDom(root);
     } else {
       simdjson::ondemand::document doc;
       auto simdErr = simdParser_
@@ -221,31 +200,78 @@ class JsonExtractor {
         }
         return folly::none;
       }
+      return extractFromDocument(doc, getJsonObjectEscapeEmoji);
+    }
+  }
+
+  // Evaluates the path against a document parsed by the caller. The result
+  // is valid until the next call on 'this'.
+  [[nodiscard]] folly::Optional<std::string_view> extractFromDom(
+      domElement root) {
+    if (!isJsonPathValid_) {
+      return folly::none;
+    }
+    ans_.clear();
+    if (root.is_null() && path_ == "$") {
+      return std::string_view{"null"};
+    }
 
-      ans_.clear();
-      ondemandElement value;
-      auto error = doc.get(value);
+    // The kGetJsonObjectEscapeEmoji option has no effect on
+    // the domElement scene, and regardless of the option, the domElement
+    // scene will still escape emoji and unescape ascii
+    if (!traversingByTokens(
+            root,
+            tokens_,
+            /*tokenIdx=*/0,
+            ans_,
+            boltToJsonString<true, domElement>,
+            /*wildcardCount=*/0)) {
+      return folly::none;
+    }
+    return std::string_view{ans_};
+  }
 
-      if (error) {
-        if (error == simdjson::SCALAR_DOCUMENT_AS_VALUE && path_ == "$") {
-          return simdExtractScale(doc);
+  // On-demand counterpart of extractFromDom(). 'doc' must be positioned at
+  // its start, e.g. freshly iterated or rewound.
+  [[nodiscard]] folly::Optional<std::string_view> extractFromDocument(
+      simdjson::ondemand::document& doc,
+      const bool getJsonObjectEscapeEmoji) {
+    if (!isJsonPathValid_) {
+      return folly::none;
+    }
+    ans_.clear();
+    ondemandElement value;
+    auto error = doc.get(value);
+
+    if (error) {
+      if (error == simdjson::SCALAR_DOCUMENT_AS_VALUE && path_ == "$") {
+        // Unescaped strings live in the parser's string buffer, which a
+        // rewind of 'doc' reuses. Copy so the result survives other paths.
+        auto scalar = simdExtractScale(doc);
+        if (!scalar.has_value()) {
+          return folly::none;
         }
-        return folly::none;
+        ans_.assign(scalar->data(), scalar->size());
+        return std::string_view{ans_};
       }
+      return folly::none;
+    }
 
-      if (!traversingByTokens(
-              value,
-              tokens_,
-              /*tokenIdx=*/0,
-              ans_,
-              getJsonObjectEscapeEmoji
-                  ? boltToJsonString<true, ondemandElement>
-                  : boltToJsonString<false, ondemandElement>,
-              /*wildcardCount=*/0)) {
-        return folly::none;
-      }
-      return std::string_view{ans_};
+    if (!traversingByTokens(
+            value,
+            tokens_,
+            /*tokenIdx=*/0,
+            ans_,
+            getJsonObjectEscapeEmoji ? boltToJsonString<true, ondemandElement>
+                                     : boltToJsonString<false, ondemandElement>,
+            /*wildcardCount=*/0)) {
+      return folly::none;
     }
+    return std::string_view{ans_};
+  }
+
+  [[nodiscard]] bool isJsonPathValid() const {
+    return isJsonPathValid_;
   }
 
   template <bool isOnlyForArrayLen>
@@ -396,6 +422,99 @@ thread_local std::unordered_map<std::string, std::shared_ptr<JsonExtractor>>
     JsonExtractor::kExtractorCache;
 thread_local JsonPathTokenizer JsonExtractor::kTokenizer;
 
+struct JsonMultiPathExtractor::Parsers {
+  simdjson::ondemand::parser ondemand;
+  simdjson::dom::parser dom;
+};
+
+JsonMultiPathExtractor::JsonMultiPathExtractor(
+    const std::vector<std::string>& paths)
+    : parsers_(std::make_unique<Parsers>()) {
+  extractors_.reserve(paths.size());
+  for (const auto& path : paths) {
+    // Not taken from the thread local cache: the results of all paths must
+    // stay valid together and the cache may evict or share an extractor.
+    extractors_.push_back(std::make_shared<JsonExtractor>(path));
+    anyPathValid_ |= extractors_.back()->isJsonPathValid();
+  }
+  buffer_.reserve(kInitCapacity);
+}
+
+JsonMultiPathExtractor::~JsonMultiPathExtractor() = default;
+
+void JsonMultiPathExtractor::extract(
+    folly::StringPiece json,
+    bool throwExceptionWhenEncounterBadJson,
+    bool useDOMParserInGetJsonObject,
+    bool getJsonObjectEscapeEmoji,
+    std::vector<folly::Optional<std::string_view>>& results) {
+  results.assign(extractors_.size(), folly::none);
+  if (!anyPathValid_ || json.size() == 0) {
+    return;
+  }
+
+  simdJsonPaddingJson(buffer_, json);
+
+  if (useDOMParserInGetJsonObject) {
+    domElement root;
+    simdjson::error_code simdErr =
+        parsers_->dom
+            .parse(
+                buffer_.c_str(), buffer_.size(), /*realloc_if_needed=*/false)
+            .get(root);
+    if (simdErr) {
+      if (throwExceptionWhenEncounterBadJson) {
+        std::stringstream ss;
+        ss << "Parse json error, detail=" << simdErr;
+        BOLT_USER_FAIL(ss.str());
+      }
+      return;
+    }
+    for (auto i = 0; i < extractors_.size(); ++i) {
+      try {
+        results[i] = extractors_[i]->extractFromDom(root);
+      } catch (simdjson::simdjson_error& e) {
+        VLOG(100) << "simdjson error: " << e.what();
+      }
+    }
+    return;
+  }
+
+  simdjson::ondemand::document doc;
+  auto simdErr = parsers_->ondemand
+                     .iterate(
+                         buffer_.c_str(),
+                         buffer_.size(),
+                         buffer_.size() + simdjson::SIMDJSON_PADDING)
+                     .get(doc);
+  if (UNLIKELY(simdErr)) {
+    if (throwExceptionWhenEncounterBadJson) {
+      std::stringstream ss;
+      ss << "Parse json error, detail=" << simdErr;
+      BOLT_USER_FAIL(ss.str());
+    }
+    return;
+  }
+  // The structural index is built once by iterate(). Each further path only
+  // rewinds the document and walks the index again.
+  bool first = true;
+  for (auto i = 0; i < extractors_.size(); ++i) {
+    if (!extractors_[i]->isJsonPathValid()) {
+      continue;
+    }
+    if (!first) {
+      doc.rewind();
+    }
+    first = false;
+    try {
+      results[i] =
+          extractors_[i]->extractFromDocument(doc, getJsonObjectEscapeEmoji);
+    } catch (simdjson::simdjson_error& e) {
+      VLOG(100) << "simdjson error: " << e.what();
+    }
+  }
+}
+
 [[deprecated("Use simdjson")]] void extractObject(
     const folly::dynamic* jsonObj,
     const std::string& key,
@@ -640,15 +759,17 @@ folly::Optional<bool> jsonArrayContains(folly::StringPiece json, const T& t) {
 
 std::vector<folly::Optional<std::string>> jsonExtractTuple(
     folly::StringPiece json,
-    std::vector<folly::Optional<folly::StringPiece>> paths,
+    const std::vector<folly::Optional<folly::StringPiece>>& paths,
     bool legacy,
     const bool useSonicLibrary) {
   std::vector<folly::Optional<std::string>> ret{paths.size(), folly::none};
-  std::string json_str;
-  simdJsonPaddingJson(json_str, json);
+  // Reused across calls so that a row does not allocate a parser and a padded
+  // copy of its document.
+  thread_local std::string jsonStr;
+  thread_local simdjson::ondemand::parser parser;
+  simdJsonPaddingJson(jsonStr, json);
   simdjson::ondemand::document doc;
-  simdjson::ondemand::parser parser;
-  auto error = parser.iterate(json_str).get(doc);
+  auto error = parser.iterate(jsonStr).get(doc);
 
   if (UNLIKELY(error)) {
     VLOG(100) << "simdjson error: " << error << " json is: " << json;
@@ -660,12 +781,17 @@ std::vector<folly::Optional<std::string>> jsonExtractTuple(
     VLOG(100) << "simdjson error: " << error << " json is: " << json;
     return ret;
   }
-  std::map<std::string_view, std::vector<size_t>> pathIndex;
-  for (size_t i = 0; i < paths.size(); i++) {
-    if (paths[i].has_value()) {
-      pathIndex[paths[i].value()].push_back(i);
+  // There are only a few paths, so a linear scan beats building an index for
+  // every document.
+  auto findPath = [&](std::string_view key, size_t from) {
+    for (auto i = from; i < paths.size(); ++i) {
+      if (paths[i].has_value() &&
+          std::string_view(paths[i]->data(), paths[i]->size()) == key) {
+        return i;
+      }
     }
-  }
+    return paths.size();
+  };
   for (auto&& pair : value.get_object()) {
     if (UNLIKELY(pair.error())) {
       VLOG(100) << "simdjson error: " << pair.error() << " json is: " << json;
@@ -678,38 +804,38 @@ std::vector<folly::Optional<std::string>> jsonExtractTuple(
         return ret;
       }
     }
-    auto it = pathIndex.find(pair.unescaped_key(true));
-    if (it != pathIndex.end()) {
-      simdjson::ondemand::value child;
-      error = pair.value().get(child);
-      if (error) {
-        if (legacy) {
-          continue;
-        } else {
-          for (size_t i = 0; i < paths.size(); i++) {
-            ret[i] = folly::none;
-          }
-          return ret;
-        }
-      }
-      std::string resultValue;
-      bool resultIsNull = false;
-      bool hasError = boltToJsonString<true, simdjson::ondemand::value>(
-          child, resultValue, true, 0, resultIsNull);
-      if (hasError && !legacy) {
+    std::string_view key = pair.unescaped_key(true);
+    auto pathIndex = findPath(key, 0);
+    if (pathIndex == paths.size()) {
+      continue;
+    }
+    simdjson::ondemand::value child;
+    error = pair.value().get(child);
+    if (error) {
+      if (legacy) {
+        continue;
+      } else {
         for (size_t i = 0; i < paths.size(); i++) {
           ret[i] = folly::none;
         }
         return ret;
       }
-      if (!resultIsNull) {
-        for (auto i : it->second) {
-          ret[i] = folly::make_optional<std::string>(std::move(resultValue));
-        }
+    }
+    std::string resultValue;
+    bool resultIsNull = false;
+    bool hasError = boltToJsonString<true, simdjson::ondemand::value>(
+        child, resultValue, true, 0, resultIsNull);
+    if (hasError && !legacy) {
+      for (size_t i = 0; i < paths.size(); i++) {
+        ret[i] = folly::none;
+      }
+      return ret;
+    }
+    for (; pathIndex < paths.size(); pathIndex = findPath(key, pathIndex + 1)) {
+      if (resultIsNull) {
+        ret[pathIndex] = folly::none;
       } else {
-        for (auto i : it->second) {
-          ret[i] = folly::none;
-        }
+        ret[pathIndex] = resultValue;
       }
     }
   }
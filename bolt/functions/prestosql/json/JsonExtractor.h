@@ -30,8 +30,10 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "folly/Range.h"
 #include "folly/dynamic.h"
@@ -75,7 +77,7 @@ folly::Optional<folly::dynamic> jsonExtract(
 // false, all fields will return null
 std::vector<folly::Optional<std::string>> jsonExtractTuple(
     folly::StringPiece json,
-    std::vector<folly::Optional<folly::StringPiece>> paths,
+    const std::vector<folly::Optional<folly::StringPiece>>& paths,
     bool legacy = true,
     const bool useSonicLibrary = true);
 
@@ -83,6 +85,46 @@ folly::Optional<folly::dynamic> jsonExtract(
     const folly::dynamic& json,
     folly::StringPiece path);
 
+class JsonExtractor;
+
+/// Evaluates several json paths against the same document while parsing it
+/// only once. Each path behaves as in jsonExtractScalar(). Used when one
+/// column is queried by several get_json_object calls with constant paths.
+class JsonMultiPathExtractor {
+ public:
+  explicit JsonMultiPathExtractor(const std::vector<std::string>& paths);
+
+  ~JsonMultiPathExtractor();
+
+  size_t numPaths() const {
+    return extractors_.size();
+  }
+
+  /// Fills 'results' with one entry per path. The string views stay valid
+  /// until the next call to extract(). Throws on malformed 'json' only if
+  /// 'throwExceptionWhenEncounterBadJson' is set.
+  void extract(
+      folly::StringPiece json,
+      bool throwExceptionWhenEncounterBadJson,
+      bool useDOMParserInGetJsonObject,
+      bool getJsonObjectEscapeEmoji,
+      std::vector<folly::Optional<std::string_view>>& results);
+
+ private:
+  static constexpr size_t kInitCapacity{1024};
+
+  struct Parsers;
+
+  std::vector<std::shared_ptr<JsonExtractor>> extractors_;
+
+  bool anyPathValid_{false};
+
+  std::unique_ptr<Parsers> parsers_;
+
+  // Padded copy of the current document.
+  std::string buffer_;
+};
+
 // Currently, bolt does not throw exception,
 folly::Optional<std::string_view> jsonExtractScalar(
     folly::StringPiece json,
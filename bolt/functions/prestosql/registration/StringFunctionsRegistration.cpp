@@ -29,6 +29,7 @@
  */
 
 #include "bolt/functions/Registerer.h"
+#include "bolt/functions/lib/MultiPatternMatch.h"
 #include "bolt/functions/lib/Re2Functions.h"
 #include "bolt/functions/lib/StringUtil.h"
 #include "bolt/functions/prestosql/FromUtf8.h"
@@ -144,6 +145,18 @@ void registerStringFunctions(const std::string& prefix) {
   exec::registerStatefulVectorFunction(
       prefix + "rlike", re2SearchSignatures(), makeRe2Search);
 
+  exec::registerStatefulVectorFunction(
+      prefix + "multi_like_index",
+      multiLikeIndexSignatures(),
+      makeMultiLikeIndex);
+  exec::registerStatefulVectorFunction(
+      prefix + "multi_like_any", multiLikeAnySignatures(), makeMultiLikeAny);
+  registerMultiLikeRewrite(
+      prefix + "like",
+      prefix + "rlike",
+      prefix + "multi_like_any",
+      [](const std::string& /*pattern*/) { return true; });
+
   registerFunction<StrLPosFunction, int64_t, Varchar, Varchar>(
       {prefix + "strpos"});
   registerFunction<StrLPosFunction, int64_t, Varchar, Varchar, int64_t>(
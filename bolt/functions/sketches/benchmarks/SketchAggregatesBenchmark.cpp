@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+#include <string>
+
+#include "bolt/exec/tests/utils/OperatorTestBase.h"
+#include "bolt/exec/tests/utils/PlanBuilder.h"
+#include "bolt/functions/sketches/RegistrationAggregateFunctions.h"
+#include "bolt/functions/sketches/RegistrationFunctions.h"
+#include "bolt/vector/fuzzer/VectorFuzzer.h"
+
+DEFINE_int64(fuzzer_seed, 99887766, "Seed for random input dataset generator");
+using namespace bytedance::bolt;
+using namespace bytedance::bolt::exec::test;
+
+static constexpr int32_t kNumVectors = 100;
+static constexpr int32_t kRowsPerVector = 10'000;
+
+namespace {
+
+// Measures the distinct count and quantile sketch aggregates, including the
+// merge of many intermediate HLLs in the final aggregation.
+class SketchAggregatesBenchmark : public OperatorTestBase {
+ public:
+  static void SetUpTestCase() {
+    OperatorTestBase::SetUpTestCase();
+  }
+
+  static void TearDownTestCase() {
+    OperatorTestBase::TearDownTestCase();
+  }
+
+  explicit SketchAggregatesBenchmark() {
+    aggregate::sketches::registerAllAggregateFunctions();
+    functions::sketches::registerAllScalarFunctions();
+
+    VectorFuzzer::Options opts;
+    opts.vectorSize = kRowsPerVector;
+    opts.nullRatio = 0;
+    VectorFuzzer fuzzer(opts, pool(), FLAGS_fuzzer_seed);
+
+    for (auto i = 0; i < kNumVectors; ++i) {
+      vectors_.emplace_back(makeRowVector(
+          {"k_small", "k_large", "i64", "f64"},
+          {
+              // 100 groups.
+              makeFlatVector<int32_t>(
+                  kRowsPerVector, [](auto row) { return row % 100; }),
+              // 10K groups.
+              makeFlatVector<int32_t>(
+                  kRowsPerVector,
+                  [i](auto row) { return (row * 7 + i) % 10'000; }),
+              fuzzer.fuzzFlat(BIGINT()),
+              fuzzer.fuzzFlat(DOUBLE()),
+          }));
+    }
+  }
+
+  void TestBody() override {}
+
+  void runGlobal(const std::string& aggregate) {
+    run(PlanBuilder()
+            .values(vectors_)
+            .partialAggregation({}, {aggregate})
+            .finalAggregation()
+            .planFragment());
+  }
+
+  void runGroupBy(const std::string& key, const std::string& aggregate) {
+    run(PlanBuilder()
+            .values(vectors_)
+            .partialAggregation({key}, {aggregate})
+            .finalAggregation()
+            .planFragment());
+  }
+
+  // Builds one HLL per 'k_large' group and merges them into one HLL per
+  // 'k_small' group, then estimates the cardinality of the merged HLLs.
+  void runMerge() {
+    run(PlanBuilder()
+            .values(vectors_)
+            .singleAggregation({"k_small", "k_large"}, {"approx_set(i64) as s"})
+            .singleAggregation({"k_small"}, {"merge(s) as m"})
+            .project({"cardinality(m)"})
+            .planFragment());
+  }
+
+ private:
+  void run(core::PlanFragment plan) {
+    folly::BenchmarkSuspender suspender;
+    auto task = exec::Task::create(
+        "t",
+        std::move(plan),
+        0,
+        core::QueryCtx::create(executor_.get()),
+        exec::Task::ExecutionMode::kSerial);
+    suspender.dismiss();
+
+    vector_size_t numResultRows = 0;
+    while (auto result = task->next()) {
+      numResultRows += result->size();
+    }
+    folly::doNotOptimizeAway(numResultRows);
+  }
+
+  std::vector<RowVectorPtr> vectors_;
+};
+
+std::unique_ptr<SketchAggregatesBenchmark> benchmark;
+
+void doRunGlobal(uint32_t, const std::string& aggregate) {
+  benchmark->runGlobal(aggregate);
+}
+
+void doRunGroupBy(
+    uint32_t,
+    const std::string& key,
+    const std::string& aggregate) {
+  benchmark->runGroupBy(key, aggregate);
+}
+
+BENCHMARK_NAMED_PARAM(doRunGlobal, approx_distinct, "approx_distinct(i64)");
+BENCHMARK_NAMED_PARAM(doRunGlobal, hll, "hll(i64, 11, 0)");
+BENCHMARK_NAMED_PARAM(doRunGlobal, cpc, "cpc(i64, 11)");
+BENCHMARK_NAMED_PARAM(doRunGlobal, theta, "theta(i64, 11, 1.0)");
+BENCHMARK_NAMED_PARAM(doRunGlobal, kll, "kll(f64, 200, 0.5)");
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK_NAMED_PARAM(
+    doRunGroupBy,
+    approx_distinct_k_small,
+    "k_small",
+    "approx_distinct(i64)");
+BENCHMARK_NAMED_PARAM(
+    doRunGroupBy,
+    approx_distinct_k_large,
+    "k_large",
+    "approx_distinct(i64)");
+BENCHMARK_NAMED_PARAM(doRunGroupBy, hll_k_small, "k_small", "hll(i64, 11, 0)");
+BENCHMARK_NAMED_PARAM(doRunGroupBy, hll_k_large, "k_large", "hll(i64, 11, 0)");
+BENCHMARK_NAMED_PARAM(doRunGroupBy, cpc_k_small, "k_small", "cpc(i64, 11)");
+BENCHMARK_NAMED_PARAM(
+    doRunGroupBy,
+    theta_k_small,
+    "k_small",
+    "theta(i64, 11, 1.0)");
+BENCHMARK_NAMED_PARAM(
+    doRunGroupBy,
+    kll_k_small,
+    "k_small",
+    "kll(f64, 200, 0.5)");
+BENCHMARK_DRAW_LINE();
+
+BENCHMARK(approx_set_merge) {
+  benchmark->runMerge();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+  SketchAggregatesBenchmark::SetUpTestCase();
+  benchmark = std::make_unique<SketchAggregatesBenchmark>();
+  folly::runBenchmarks();
+  benchmark.reset();
+  SketchAggregatesBenchmark::TearDownTestCase();
+  return 0;
+}
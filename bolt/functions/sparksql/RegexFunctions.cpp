@@ -28,6 +28,7 @@
  * --------------------------------------------------------------------------
  */
 
+#include "bolt/functions/lib/MultiPatternMatch.h"
 #include "bolt/functions/lib/Re2Functions.h"
 #include "bolt/functions/lib/string/StringCore.h"
 
@@ -267,4 +268,25 @@ void registerRegexpReplace(const std::string& prefix) {
       int64_t>({prefix + "REGEXP_REPLACE"});
 }
 
+void registerMultiLike(const std::string& prefix) {
+  exec::registerStatefulVectorFunction(
+      prefix + "multi_like_index",
+      multiLikeIndexSignatures(),
+      makeMultiLikeIndex);
+  exec::registerStatefulVectorFunction(
+      prefix + "multi_like_any", multiLikeAnySignatures(), makeMultiLikeAny);
+  registerMultiLikeRewrite(
+      prefix + "like",
+      prefix + "rlike",
+      prefix + "multi_like_any",
+      [](const std::string& pattern) {
+        try {
+          checkForCompatiblePattern(pattern, "RLIKE");
+          return true;
+        } catch (const BoltUserError&) {
+          return false;
+        }
+      });
+}
+
 } // namespace bytedance::bolt::functions::sparksql
@@ -88,4 +88,10 @@ std::shared_ptr<exec::VectorFunction> makeRegexExtract(
 /// If position > length string, return string.
 void registerRegexpReplace(const std::string& prefix);
 
+/// Registers multi_like_index and multi_like_any, and an expression rewrite
+/// that evaluates the LIKE and RLIKE calls on the same column inside an OR with
+/// a single multi_like_any call. RLIKE patterns that are incompatible with
+/// java.util.regex keep their own call.
+void registerMultiLike(const std::string& prefix);
+
 } // namespace bytedance::bolt::functions::sparksql
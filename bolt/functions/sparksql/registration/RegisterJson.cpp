@@ -22,6 +22,7 @@
 #include "bolt/functions/sparksql/JsonTuple.h"
 #include "bolt/functions/sparksql/SIMDJsonFunctions.h"
 #include "bolt/functions/sparksql/specialforms/FromJson.h"
+#include "bolt/functions/sparksql/specialforms/GetJsonObjectMulti.h"
 #include "bolt/functions/sparksql/specialforms/JsonSplit.h"
 namespace bytedance::bolt::functions {
 static void registerSparkJsonFunctions(const std::string& prefix) {
@@ -49,6 +50,10 @@ void registerJsonFunctions(const std::string& prefix) {
 
   registerFunction<JsonExtractScalarFunction, Varchar, Varchar, Varchar>(
       {prefix + "get_json_object"});
+  registerFunctionCallToSpecialForm(
+      GetJsonObjectMultiCallToSpecialForm::kGetJsonObjectMulti,
+      std::make_unique<GetJsonObjectMultiCallToSpecialForm>());
+  registerGetJsonObjectRewrite(prefix + "get_json_object");
 
   registerFunction<JsonObjectKeysFunction, Array<Varchar>, Varchar>(
       {prefix + "json_object_keys"});
@@ -25,6 +25,9 @@ void registerRegexpFunctions(const std::string& prefix) {
       prefix + "regexp_extract", re2ExtractSignatures(), makeRegexExtract);
   exec::registerStatefulVectorFunction(
       prefix + "rlike", re2SearchSignatures(), makeRLike);
+  exec::registerStatefulVectorFunction(
+      prefix + "like", likeSignatures(), makeLike);
+  registerMultiLike(prefix);
 
   // using ICU
   exec::registerStatefulVectorFunction(
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bolt/functions/sparksql/specialforms/GetJsonObjectMulti.h"
+
+#include <algorithm>
+#include <deque>
+#include <optional>
+
+#include "bolt/expression/ConstantExpr.h"
+#include "bolt/expression/SpecialForm.h"
+#include "bolt/expression/VectorFunction.h"
+#include "bolt/functions/prestosql/json/JsonExtractor.h"
+#include "bolt/vector/ComplexVector.h"
+
+using namespace bytedance::bolt::exec;
+
+namespace bytedance::bolt::functions::sparksql {
+namespace {
+class GetJsonObjectMultiExpr : public SpecialForm {
+ public:
+  GetJsonObjectMultiExpr(
+      TypePtr type,
+      std::vector<ExprPtr>&& inputs,
+      const std::vector<std::string>& paths,
+      const core::QueryConfig& config,
+      bool trackCpuUsage)
+      : SpecialForm(
+            std::move(type),
+            std::move(inputs),
+            GetJsonObjectMultiCallToSpecialForm::kGetJsonObjectMulti,
+            false /* supportsFlatNoNullsFastPath */,
+            trackCpuUsage),
+        extractor_(paths),
+        throwExceptionWhenEncounterBadJson_(
+            config.throwExceptionWhenEncounterBadJson()),
+        useDOMParserInGetJsonObject_(config.useDOMParserInGetJsonObject()),
+        getJsonObjectEscapeEmoji_(config.getJsonObjectEscapeEmoji()) {}
+
+  void evalSpecialForm(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result) override {
+    VectorPtr input;
+    inputs_[0]->eval(rows, context, input);
+    LocalDecodedVector decoded(context, *input, rows);
+
+    auto* pool = context.pool();
+    const auto numPaths = extractor_.numPaths();
+    std::vector<VectorPtr> children(numPaths);
+    std::vector<FlatVector<StringView>*> flatChildren(numPaths);
+    for (auto i = 0; i < numPaths; ++i) {
+      children[i] = BaseVector::create(VARCHAR(), rows.end(), pool);
+      flatChildren[i] = children[i]->asFlatVector<StringView>();
+    }
+    auto nulls = allocateNulls(rows.end(), pool);
+    auto* rawNulls = nulls->asMutable<uint64_t>();
+
+    context.applyToSelectedNoThrow(rows, [&](auto row) {
+      if (decoded->isNullAt(row)) {
+        bits::setNull(rawNulls, row);
+        for (auto* child : flatChildren) {
+          child->setNull(row, true);
+        }
+        return;
+      }
+      const auto json = decoded->valueAt<StringView>(row);
+      extractor_.extract(
+          folly::StringPiece(json.data(), json.size()),
+          throwExceptionWhenEncounterBadJson_,
+          useDOMParserInGetJsonObject_,
+          getJsonObjectEscapeEmoji_,
+          results_);
+      for (auto i = 0; i < numPaths; ++i) {
+        if (results_[i].has_value()) {
+          flatChildren[i]->set(
+              row, StringView(results_[i]->data(), results_[i]->size()));
+        } else {
+          flatChildren[i]->setNull(row, true);
+        }
+      }
+    });
+
+    VectorPtr localResult = std::make_shared<RowVector>(
+        pool, type(), std::move(nulls), rows.end(), std::move(children));
+    context.moveOrCopyResult(localResult, rows, result);
+    context.releaseVector(input);
+  }
+
+ private:
+  void computePropagatesNulls() override {
+    propagatesNulls_ = false;
+  }
+
+  JsonMultiPathExtractor extractor_;
+  const bool throwExceptionWhenEncounterBadJson_;
+  const bool useDOMParserInGetJsonObject_;
+  const bool getJsonObjectEscapeEmoji_;
+
+  // Reused across rows. Points into 'extractor_'.
+  std::vector<folly::Optional<std::string_view>> results_;
+};
+
+// Returns the constant non-null string value of 'expr' or std::nullopt if
+// 'expr' is not such a constant.
+std::optional<std::string> toConstantString(const core::TypedExprPtr& expr) {
+  auto constant = dynamic_cast<const core::ConstantTypedExpr*>(expr.get());
+  if (constant == nullptr || !constant->type()->isVarchar()) {
+    return std::nullopt;
+  }
+  if (constant->hasValueVector()) {
+    const auto& vector = constant->valueVector();
+    if (vector->isNullAt(0)) {
+      return std::nullopt;
+    }
+    return vector->as<SimpleVector<StringView>>()->valueAt(0).str();
+  }
+  if (constant->value().isNull()) {
+    return std::nullopt;
+  }
+  return constant->value().value<TypeKind::VARCHAR>();
+}
+
+// All the constant paths applied to one json input.
+struct PathGroup {
+  core::TypedExprPtr input;
+  std::vector<std::string> paths;
+  // Shared get_json_object_multi call. Created on first use.
+  core::TypedExprPtr multiCall;
+};
+
+class GetJsonObjectRewriter {
+ public:
+  explicit GetJsonObjectRewriter(const std::string& getJsonObjectName)
+      : getJsonObjectName_(getJsonObjectName) {}
+
+  void collect(const core::TypedExprPtr& expr) {
+    if (dynamic_cast<const core::LambdaTypedExpr*>(expr.get())) {
+      return;
+    }
+    if (auto path = constantPath(expr)) {
+      auto& paths = findOrAddGroup(expr->inputs()[0]).paths;
+      if (std::find(paths.begin(), paths.end(), *path) == paths.end()) {
+        paths.push_back(*path);
+      }
+    }
+    for (const auto& input : expr->inputs()) {
+      collect(input);
+    }
+  }
+
+  bool hasFusableGroup() const {
+    for (const auto& group : groups_) {
+      if (group.paths.size() > 1) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Returns the rewritten 'expr' or 'expr' itself if it has nothing to
+  // rewrite.
+  core::TypedExprPtr rewrite(const core::TypedExprPtr& expr) {
+    if (dynamic_cast<const core::LambdaTypedExpr*>(expr.get())) {
+      return expr;
+    }
+    if (auto path = constantPath(expr)) {
+      auto& group = findOrAddGroup(expr->inputs()[0]);
+      if (group.paths.size() > 1) {
+        const auto index = std::distance(
+            group.paths.begin(),
+            std::find(group.paths.begin(), group.paths.end(), *path));
+        return std::make_shared<core::DereferenceTypedExpr>(
+            VARCHAR(), multiCall(group), index);
+      }
+    }
+
+    std::vector<core::TypedExprPtr> newInputs;
+    bool changed = false;
+    newInputs.reserve(expr->inputs().size());
+    for (const auto& input : expr->inputs()) {
+      newInputs.push_back(rewrite(input));
+      changed |= newInputs.back() != input;
+    }
+    if (!changed) {
+      return expr;
+    }
+    return withInputs(expr, std::move(newInputs));
+  }
+
+ private:
+  // Returns the path if 'expr' is a get_json_object call with a constant,
+  // non-null path.
+  std::optional<std::string> constantPath(const core::TypedExprPtr& expr) {
+    auto call = dynamic_cast<const core::CallTypedExpr*>(expr.get());
+    if (call == nullptr || call->name() != getJsonObjectName_ ||
+        call->inputs().size() != 2 ||
+        !call->inputs()[0]->type()->isVarchar()) {
+      return std::nullopt;
+    }
+    return toConstantString(call->inputs()[1]);
+  }
+
+  PathGroup& findOrAddGroup(const core::TypedExprPtr& input) {
+    for (auto& group : groups_) {
+      if (*group.input == *input) {
+        return group;
+      }
+    }
+    groups_.push_back({input, {}, nullptr});
+    return groups_.back();
+  }
+
+  const core::TypedExprPtr& multiCall(PathGroup& group) {
+    if (group.multiCall == nullptr) {
+      std::vector<core::TypedExprPtr> args;
+      args.reserve(group.paths.size() + 1);
+      // The input may itself contain get_json_object calls of another group.
+      args.push_back(rewrite(group.input));
+      for (const auto& path : group.paths) {
+        args.push_back(std::make_shared<core::ConstantTypedExpr>(
+            VARCHAR(), variant(path)));
+      }
+      group.multiCall = std::make_shared<core::CallTypedExpr>(
+          ROW(std::vector<TypePtr>(group.paths.size(), VARCHAR())),
+          std::move(args),
+          GetJsonObjectMultiCallToSpecialForm::kGetJsonObjectMulti);
+    }
+    return group.multiCall;
+  }
+
+  static core::TypedExprPtr withInputs(
+      const core::TypedExprPtr& expr,
+      std::vector<core::TypedExprPtr>&& inputs) {
+    if (auto call = dynamic_cast<const core::CallTypedExpr*>(expr.get())) {
+      return std::make_shared<core::CallTypedExpr>(
+          call->type(), std::move(inputs), call->name());
+    }
+    if (auto cast = dynamic_cast<const core::CastTypedExpr*>(expr.get())) {
+      return std::make_shared<core::CastTypedExpr>(
+          cast->type(), inputs, cast->nullOnFailure());
+    }
+    if (auto field =
+            dynamic_cast<const core::FieldAccessTypedExpr*>(expr.get())) {
+      return std::make_shared<core::FieldAccessTypedExpr>(
+          field->type(), inputs[0], field->name());
+    }
+    if (auto dereference =
+            dynamic_cast<const core::DereferenceTypedExpr*>(expr.get())) {
+      return std::make_shared<core::DereferenceTypedExpr>(
+          dereference->type(), inputs[0], dereference->index());
+    }
+    if (auto concat = dynamic_cast<const core::ConcatTypedExpr*>(expr.get())) {
+      return std::make_shared<core::ConcatTypedExpr>(
+          concat->type()->asRow().names(), inputs);
+    }
+    BOLT_UNREACHABLE("Unexpected expression with inputs: {}", expr->toString());
+  }
+
+  const std::string getJsonObjectName_;
+  // Few distinct json inputs are expected, so groups are searched linearly.
+  std::deque<PathGroup> groups_;
+};
+// The rewrite registered by registerGetJsonObjectRewrite. A named type so
+// that registered instances can be found in exec::expressionSetRewrites().
+struct GetJsonObjectRewrite {
+  std::string getJsonObjectName;
+
+  std::vector<core::TypedExprPtr> operator()(
+      const std::vector<core::TypedExprPtr>& exprs,
+      const core::QueryConfig& config) const {
+    if (!config.fuseGetJsonObject()) {
+      return {};
+    }
+    return rewriteGetJsonObjectCalls(getJsonObjectName, exprs);
+  }
+};
+
+} // namespace
+
+TypePtr GetJsonObjectMultiCallToSpecialForm::resolveType(
+    const std::vector<TypePtr>& argTypes) {
+  BOLT_USER_CHECK_GE(
+      argTypes.size(),
+      2,
+      "{} expects a json and at least one path.",
+      kGetJsonObjectMulti);
+  return ROW(std::vector<TypePtr>(argTypes.size() - 1, VARCHAR()));
+}
+
+ExprPtr GetJsonObjectMultiCallToSpecialForm::constructSpecialForm(
+    const TypePtr& type,
+    std::vector<ExprPtr>&& compiledChildren,
+    bool trackCpuUsage,
+    const core::QueryConfig& config) {
+  BOLT_USER_CHECK_GE(
+      compiledChildren.size(),
+      2,
+      "{} expects a json and at least one path.",
+      kGetJsonObjectMulti);
+  BOLT_USER_CHECK(
+      compiledChildren[0]->type()->isVarchar(),
+      "The json input of {} should be VARCHAR but got {}.",
+      kGetJsonObjectMulti,
+      compiledChildren[0]->type()->toString());
+  std::vector<std::string> paths;
+  paths.reserve(compiledChildren.size() - 1);
+  for (auto i = 1; i < compiledChildren.size(); ++i) {
+    auto constantExpr =
+        std::dynamic_pointer_cast<exec::ConstantExpr>(compiledChildren[i]);
+    BOLT_USER_CHECK(
+        constantExpr != nullptr && constantExpr->type()->isVarchar() &&
+            !constantExpr->value()->isNullAt(0),
+        "The paths of {} should be constant non-null strings.",
+        kGetJsonObjectMulti);
+    paths.push_back(constantExpr->value()
+                        ->as<SimpleVector<StringView>>()
+                        ->valueAt(0)
+                        .str());
+  }
+  BOLT_CHECK_EQ(type->size(), paths.size());
+  return std::make_shared<GetJsonObjectMultiExpr>(
+      type, std::move(compiledChildren), paths, config, trackCpuUsage);
+}
+
+std::vector<core::TypedExprPtr> rewriteGetJsonObjectCalls(
+    const std::string& getJsonObjectName,
+    const std::vector<core::TypedExprPtr>& exprs) {
+  GetJsonObjectRewriter rewriter(getJsonObjectName);
+  for (const auto& expr : exprs) {
+    rewriter.collect(expr);
+  }
+  if (!rewriter.hasFusableGroup()) {
+    return {};
+  }
+  std::vector<core::TypedExprPtr> rewritten;
+  rewritten.reserve(exprs.size());
+  for (const auto& expr : exprs) {
+    rewritten.push_back(rewriter.rewrite(expr));
+  }
+  return rewritten;
+}
+
+
+void registerGetJsonObjectRewrite(const std::string& getJsonObjectName) {
+  for (const auto& rewrite : exec::expressionSetRewrites()) {
+    auto existing = rewrite.target<GetJsonObjectRewrite>();
+    if (existing != nullptr &&
+        existing->getJsonObjectName == getJsonObjectName) {
+      return;
+    }
+  }
+  exec::registerExpressionSetRewrite(GetJsonObjectRewrite{getJsonObjectName});
+}
+
+} // namespace bytedance::bolt::functions::sparksql
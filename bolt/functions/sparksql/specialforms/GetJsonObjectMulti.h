@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) ByteDance Ltd. and/or its affiliates
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "bolt/core/Expressions.h"
+#include "bolt/expression/FunctionCallToSpecialForm.h"
+namespace bytedance::bolt::functions::sparksql {
+
+/// get_json_object_multi(json, path1, path2, ...) -> row(varchar, ...)
+///
+/// Field i of the result is get_json_object(json, path<i+1>). The document is
+/// parsed once for all the paths, which must be constant. Produced by
+/// rewriteGetJsonObjectCalls() rather than written in queries.
+class GetJsonObjectMultiCallToSpecialForm
+    : public exec::FunctionCallToSpecialForm {
+ public:
+  TypePtr resolveType(const std::vector<TypePtr>& argTypes) override;
+
+  exec::ExprPtr constructSpecialForm(
+      const TypePtr& type,
+      std::vector<exec::ExprPtr>&& compiledChildren,
+      bool trackCpuUsage,
+      const core::QueryConfig& config) override;
+
+  static constexpr const char* kGetJsonObjectMulti = "get_json_object_multi";
+};
+
+/// Finds the 'getJsonObjectName' calls with a constant path across all of
+/// 'exprs' and groups them by json input. Each input queried with at least two
+/// distinct paths gets one get_json_object_multi call that all of its calls
+/// dereference, e.g.
+///     get_json_object(c0, '$.a'), upper(get_json_object(c0, '$.b'))
+/// becomes
+///     m[0], upper(m[1]) with m = get_json_object_multi(c0, '$.a', '$.b')
+/// The compiler evaluates the shared call once per batch. Lambda bodies are
+/// left as is. Returns an empty list if nothing was rewritten.
+std::vector<core::TypedExprPtr> rewriteGetJsonObjectCalls(
+    const std::string& getJsonObjectName,
+    const std::vector<core::TypedExprPtr>& exprs);
+
+/// Registers rewriteGetJsonObjectCalls() for 'getJsonObjectName' as an
+/// expression set rewrite that runs if fuse_get_json_object is set. Does
+/// nothing if it is already registered for 'getJsonObjectName'.
+void registerGetJsonObjectRewrite(const std::string& getJsonObjectName);
+
+} // namespace bytedance::bolt::functions::sparksql
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include "bolt/functions/sparksql/specialforms/GetJsonObjectMulti.h"
 #include "bolt/functions/sparksql/tests/SparkFunctionBaseTest.h"
 namespace bytedance::bolt::functions::sparksql::test {
 using namespace bytedance::bolt::test;
@@ -534,6 +535,65 @@ TEST_F(JsonFucntionTest, jsonInfiniteLoop) {
   }
 }
 
+TEST_F(JsonFucntionTest, fusedGetJsonObject) {
+  auto data = makeRowVector({
+      makeNullableFlatVector<std::string>(
+          {R"({"a": 1, "b": {"c": "x\ty", "d": [1, 2]}})",
+           std::nullopt,
+           R"({"a": "s", "b": null})",
+           "not json",
+           R"("scalar")",
+           R"([{"a": 1}, {"a": 2}])",
+           ""}),
+      makeNullableFlatVector<std::string>(
+          {R"({"a": 5})", "{}", std::nullopt, "[]", "1", "{}", "{}"}),
+  });
+  const std::vector<std::string> expressions = {
+      "get_json_object(c0, '$.a')",
+      "upper(get_json_object(c0, '$.b.c'))",
+      "get_json_object(c0, '$.b.d[1]')",
+      "get_json_object(c0, '$')",
+      "get_json_object(c0, '$[*].a')",
+      "get_json_object(c0, '$.a')",
+      "get_json_object(c1, '$.a')",
+      "get_json_object(c0, 'invalid')",
+  };
+
+  auto evaluateAll = [&](bool fuse) {
+    queryCtx_->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kFuseGetJsonObject, fuse ? "true" : "false"}});
+    auto exprSet = compileExpressions(expressions, asRowType(data->type()));
+    EXPECT_EQ(
+        exprSet->toString().find(
+            GetJsonObjectMultiCallToSpecialForm::kGetJsonObjectMulti) !=
+            std::string::npos,
+        fuse);
+    exec::EvalCtx evalCtx(&execCtx_, exprSet.get(), data.get());
+    SelectivityVector rows(data->size());
+    std::vector<VectorPtr> results(expressions.size());
+    exprSet->eval(rows, evalCtx, results);
+    return results;
+  };
+
+  for (auto useDom : {"true", "false"}) {
+    queryCtx_->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kUseDOMParserInGetJsonObject, useDom}});
+    auto expected = evaluateAll(false);
+    auto actual = evaluateAll(true);
+    for (auto i = 0; i < expressions.size(); ++i) {
+      SCOPED_TRACE(expressions[i]);
+      assertEqualVectors(expected[i], actual[i]);
+    }
+    // Repeated calls share one field of the fused call.
+    assertEqualVectors(actual[0], actual[5]);
+  }
+
+  // Registering the rewrite again for the same function does nothing.
+  const auto numRewrites = exec::expressionSetRewrites().size();
+  registerGetJsonObjectRewrite("get_json_object");
+  EXPECT_EQ(exec::expressionSetRewrites().size(), numRewrites);
+}
+
 } // namespace
 
 } // namespace bytedance::bolt::functions::sparksql::test
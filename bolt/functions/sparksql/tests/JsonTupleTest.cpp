@@ -196,5 +196,13 @@ TEST_F(JsonTupleTest, invalidArrayInJson) {
       {{core::QueryConfig::kUseSonicJson, "false"}});
   testJsonTuple({json}, paths, true, "[0, null, null]");
 }
+
+TEST_F(JsonTupleTest, duplicatePaths) {
+  std::string json = R"({"a":"x","b":2})";
+  std::vector<std::string> paths{"a", "b", "a", "c"};
+  std::string expectedOutput = R"(["x", "2", "x", null])";
+  testJsonTuple({json}, paths, true, expectedOutput);
+  testJsonTuple({json}, paths, false, expectedOutput);
+}
 } // namespace
 } // namespace bytedance::bolt::functions::sparksql::test
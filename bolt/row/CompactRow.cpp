@@ -493,6 +493,173 @@ int32_t CompactRow::serializeVariableWidth(vector_size_t index, char* buffer) {
 
 namespace {
 
+// Returns the rows of the fields for top-level rows [offset, offset + size).
+std::vector<vector_size_t> fieldRows(
+    const DecodedVector& decoded,
+    vector_size_t offset,
+    vector_size_t size) {
+  std::vector<vector_size_t> rows(size);
+  for (auto i = 0; i < size; ++i) {
+    rows[i] = decoded.index(offset + i);
+  }
+  return rows;
+}
+
+// Writes one fixed-width column at 'valuesOffsets[i]' of each row. Null
+// values take up space too. The type is resolved once per column, so this is
+// a plain strided store loop.
+template <typename T>
+void writeFixedWidthColumn(
+    const DecodedVector& decoded,
+    const vector_size_t* rows,
+    vector_size_t size,
+    column_index_t field,
+    const size_t* bufferOffsets,
+    char* buffer,
+    int32_t* valuesOffsets) {
+  constexpr int32_t kValueBytes =
+      std::is_same_v<T, Timestamp> ? sizeof(int64_t) : sizeof(T);
+  const bool mayHaveNulls = decoded.mayHaveNulls();
+  for (auto i = 0; i < size; ++i) {
+    auto* row = buffer + bufferOffsets[i];
+    if (mayHaveNulls && decoded.isNullAt(rows[i])) {
+      bits::setBit(reinterpret_cast<uint8_t*>(row), field, true);
+    } else if constexpr (std::is_same_v<T, Timestamp>) {
+      const auto micros = decoded.valueAt<Timestamp>(rows[i]).toMicros();
+      memcpy(row + valuesOffsets[i], &micros, kValueBytes);
+    } else {
+      const T value = decoded.valueAt<T>(rows[i]);
+      memcpy(row + valuesOffsets[i], &value, kValueBytes);
+    }
+    valuesOffsets[i] += kValueBytes;
+  }
+}
+} // namespace
+
+void CompactRow::rowSizes(
+    vector_size_t offset,
+    vector_size_t size,
+    int32_t* sizes) {
+  const auto rows = fieldRows(decoded_, offset, size);
+  int32_t fixedSize = rowNullBytes_;
+  for (auto i = 0; i < children_.size(); ++i) {
+    if (childIsFixedWidth_[i]) {
+      fixedSize += children_[i].valueBytes_;
+    }
+  }
+  std::fill_n(sizes, size, fixedSize);
+  for (auto i = 0; i < children_.size(); ++i) {
+    if (!childIsFixedWidth_[i]) {
+      children_[i].addVariableWidthSizes(rows.data(), size, sizes);
+    }
+  }
+}
+
+void CompactRow::serialize(
+    vector_size_t offset,
+    vector_size_t size,
+    const size_t* bufferOffsets,
+    char* buffer) {
+  const auto rows = fieldRows(decoded_, offset, size);
+  // Fields are laid out back to back, so the position of a field in a row
+  // depends on the variable-width fields before it.
+  std::vector<int32_t> valuesOffsets(size, rowNullBytes_);
+  for (auto i = 0; i < children_.size(); ++i) {
+    children_[i].serializeColumn(
+        rows.data(), size, i, bufferOffsets, buffer, valuesOffsets.data());
+  }
+}
+
+void CompactRow::addVariableWidthSizes(
+    const vector_size_t* rows,
+    vector_size_t size,
+    int32_t* sizes) {
+  const bool mayHaveNulls = decoded_.mayHaveNulls();
+  if (typeKind_ == TypeKind::VARCHAR || typeKind_ == TypeKind::VARBINARY) {
+    for (auto i = 0; i < size; ++i) {
+      if (!mayHaveNulls || !decoded_.isNullAt(rows[i])) {
+        sizes[i] += kSizeBytes + decoded_.valueAt<StringView>(rows[i]).size();
+      }
+    }
+    return;
+  }
+  for (auto i = 0; i < size; ++i) {
+    if (!mayHaveNulls || !decoded_.isNullAt(rows[i])) {
+      sizes[i] += variableWidthRowSize(rows[i]);
+    }
+  }
+}
+
+void CompactRow::serializeColumn(
+    const vector_size_t* rows,
+    vector_size_t size,
+    column_index_t field,
+    const size_t* bufferOffsets,
+    char* buffer,
+    int32_t* valuesOffsets) {
+  switch (typeKind_) {
+    case TypeKind::BOOLEAN:
+      return writeFixedWidthColumn<bool>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::TINYINT:
+      return writeFixedWidthColumn<int8_t>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::SMALLINT:
+      return writeFixedWidthColumn<int16_t>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::INTEGER:
+      return writeFixedWidthColumn<int32_t>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::BIGINT:
+      return writeFixedWidthColumn<int64_t>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::HUGEINT:
+      return writeFixedWidthColumn<int128_t>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::REAL:
+      return writeFixedWidthColumn<float>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::DOUBLE:
+      return writeFixedWidthColumn<double>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::TIMESTAMP:
+      return writeFixedWidthColumn<Timestamp>(
+          decoded_, rows, size, field, bufferOffsets, buffer, valuesOffsets);
+    case TypeKind::UNKNOWN:
+      // UNKNOWN values are always nulls and take up no space.
+      for (auto i = 0; i < size; ++i) {
+        bits::setBit(
+            reinterpret_cast<uint8_t*>(buffer + bufferOffsets[i]), field, true);
+      }
+      return;
+    default:
+      break;
+  }
+
+  const bool isString =
+      typeKind_ == TypeKind::VARCHAR || typeKind_ == TypeKind::VARBINARY;
+  for (auto i = 0; i < size; ++i) {
+    auto* row = buffer + bufferOffsets[i];
+    if (decoded_.isNullAt(rows[i])) {
+      bits::setBit(reinterpret_cast<uint8_t*>(row), field, true);
+      continue;
+    }
+    if (isString) {
+      const auto value = decoded_.valueAt<StringView>(rows[i]);
+      writeInt32(row + valuesOffsets[i], value.size());
+      if (!value.empty()) {
+        memcpy(row + valuesOffsets[i] + kSizeBytes, value.data(), value.size());
+      }
+      valuesOffsets[i] += kSizeBytes + value.size();
+    } else {
+      valuesOffsets[i] +=
+          serializeVariableWidth(rows[i], row + valuesOffsets[i]);
+    }
+  }
+}
+
+namespace {
+
 // Reads single fixed-width value from buffer into flatVector[index].
 template <typename T>
 void readFixedWidthValue(
@@ -542,10 +709,32 @@ VectorPtr deserializeFixedWidth(
 
   auto* rawNulls = nulls->as<uint64_t>();
 
+  if constexpr (std::is_same_v<T, bool>) {
+    for (auto i = 0; i < numRows; ++i) {
+      const bool isNull = bits::isBitNull(rawNulls, i);
+      readFixedWidthValue<T>(
+          isNull, data[i].data() + offsets[i], flatVector.get(), i);
+    }
+    return flatVector;
+  }
+
+  // Reads the values into the values buffer and takes over the field nulls as
+  // a whole instead of setting the null flag of each row.
+  auto* rawValues = flatVector->mutableRawValues();
   for (auto i = 0; i < numRows; ++i) {
-    const bool isNull = bits::isBitNull(rawNulls, i);
-    readFixedWidthValue<T>(
-        isNull, data[i].data() + offsets[i], flatVector.get(), i);
+    if (bits::isBitNull(rawNulls, i)) {
+      continue;
+    }
+    if constexpr (std::is_same_v<T, Timestamp>) {
+      int64_t micros;
+      memcpy(&micros, data[i].data() + offsets[i], sizeof(int64_t));
+      rawValues[i] = Timestamp::fromMicros(micros);
+    } else {
+      memcpy(&rawValues[i], data[i].data() + offsets[i], sizeof(T));
+    }
+  }
+  if (!bits::isAllSet(rawNulls, 0, numRows)) {
+    flatVector->setNulls(nulls);
   }
 
   return flatVector;
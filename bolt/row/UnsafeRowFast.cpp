@@ -417,4 +417,195 @@ int32_t UnsafeRowFast::serializeRow(vector_size_t index, char* buffer) {
 
   return variableWidthOffset;
 }
+
+namespace {
+
+// Returns the rows of the fields for top-level rows [offset, offset + size).
+std::vector<vector_size_t> fieldRows(
+    const DecodedVector& decoded,
+    vector_size_t offset,
+    vector_size_t size) {
+  std::vector<vector_size_t> rows(size);
+  for (auto i = 0; i < size; ++i) {
+    rows[i] = decoded.index(offset + i);
+  }
+  return rows;
+}
+
+// Writes one fixed-width column to the field slot at 'fieldOffset' of each
+// row. The type is resolved once per column, so this is a plain strided store
+// loop.
+template <typename T>
+void writeFixedWidthColumn(
+    const DecodedVector& decoded,
+    const vector_size_t* rows,
+    vector_size_t size,
+    column_index_t field,
+    int32_t fieldOffset,
+    const size_t* bufferOffsets,
+    char* buffer) {
+  const bool mayHaveNulls = decoded.mayHaveNulls();
+  for (auto i = 0; i < size; ++i) {
+    auto* row = buffer + bufferOffsets[i];
+    if (mayHaveNulls && decoded.isNullAt(rows[i])) {
+      bits::setBit(row, field, true);
+    } else if constexpr (std::is_same_v<T, Timestamp>) {
+      *reinterpret_cast<int64_t*>(row + fieldOffset) =
+          decoded.valueAt<Timestamp>(rows[i]).toMicros();
+    } else {
+      *reinterpret_cast<T*>(row + fieldOffset) = decoded.valueAt<T>(rows[i]);
+    }
+  }
+}
+} // namespace
+
+void UnsafeRowFast::rowSizes(
+    vector_size_t offset,
+    vector_size_t size,
+    int32_t* sizes) {
+  const auto rows = fieldRows(decoded_, offset, size);
+  const int32_t fixedSize = rowNullBytes_ + children_.size() * kFieldWidth;
+  std::fill_n(sizes, size, fixedSize);
+  for (auto i = 0; i < children_.size(); ++i) {
+    if (!childIsFixedWidth_[i]) {
+      children_[i].addVariableWidthSizes(rows.data(), size, sizes);
+    }
+  }
+}
+
+void UnsafeRowFast::serialize(
+    vector_size_t offset,
+    vector_size_t size,
+    const size_t* bufferOffsets,
+    char* buffer) {
+  const auto rows = fieldRows(decoded_, offset, size);
+  std::vector<int64_t> variableWidthOffsets(
+      size, rowNullBytes_ + children_.size() * kFieldWidth);
+  for (auto i = 0; i < children_.size(); ++i) {
+    if (childIsFixedWidth_[i]) {
+      children_[i].serializeFixedWidthColumn(
+          rows.data(), size, i, rowNullBytes_, bufferOffsets, buffer);
+    } else {
+      children_[i].serializeVariableWidthColumn(
+          rows.data(),
+          size,
+          i,
+          rowNullBytes_,
+          bufferOffsets,
+          buffer,
+          variableWidthOffsets.data());
+    }
+  }
+}
+
+void UnsafeRowFast::addVariableWidthSizes(
+    const vector_size_t* rows,
+    vector_size_t size,
+    int32_t* sizes) {
+  const bool mayHaveNulls = decoded_.mayHaveNulls();
+  if (typeKind_ == TypeKind::VARCHAR || typeKind_ == TypeKind::VARBINARY) {
+    for (auto i = 0; i < size; ++i) {
+      if (!mayHaveNulls || !decoded_.isNullAt(rows[i])) {
+        sizes[i] += alignBytes(decoded_.valueAt<StringView>(rows[i]).size());
+      }
+    }
+    return;
+  }
+  for (auto i = 0; i < size; ++i) {
+    if (!mayHaveNulls || !decoded_.isNullAt(rows[i])) {
+      sizes[i] += alignBytes(variableWidthRowSize(rows[i]));
+    }
+  }
+}
+
+void UnsafeRowFast::serializeFixedWidthColumn(
+    const vector_size_t* rows,
+    vector_size_t size,
+    column_index_t field,
+    int32_t nullBytes,
+    const size_t* bufferOffsets,
+    char* buffer) {
+  const int32_t fieldOffset = nullBytes + field * kFieldWidth;
+  switch (typeKind_) {
+    case TypeKind::BOOLEAN:
+      writeFixedWidthColumn<bool>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::TINYINT:
+      writeFixedWidthColumn<int8_t>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::SMALLINT:
+      writeFixedWidthColumn<int16_t>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::INTEGER:
+      writeFixedWidthColumn<int32_t>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::BIGINT:
+      writeFixedWidthColumn<int64_t>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::REAL:
+      writeFixedWidthColumn<float>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::DOUBLE:
+      writeFixedWidthColumn<double>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::TIMESTAMP:
+      writeFixedWidthColumn<Timestamp>(
+          decoded_, rows, size, field, fieldOffset, bufferOffsets, buffer);
+      break;
+    case TypeKind::UNKNOWN:
+      // UNKNOWN values are always null.
+      for (auto i = 0; i < size; ++i) {
+        if (decoded_.isNullAt(rows[i])) {
+          bits::setBit(buffer + bufferOffsets[i], field, true);
+        }
+      }
+      break;
+    default:
+      BOLT_UNREACHABLE(
+          "Unexpected type kind: {}", mapTypeKindToName(typeKind_));
+  }
+}
+
+void UnsafeRowFast::serializeVariableWidthColumn(
+    const vector_size_t* rows,
+    vector_size_t size,
+    column_index_t field,
+    int32_t nullBytes,
+    const size_t* bufferOffsets,
+    char* buffer,
+    int64_t* variableWidthOffsets) {
+  const bool isString =
+      typeKind_ == TypeKind::VARCHAR || typeKind_ == TypeKind::VARBINARY;
+  for (auto i = 0; i < size; ++i) {
+    auto* row = buffer + bufferOffsets[i];
+    if (decoded_.isNullAt(rows[i])) {
+      bits::setBit(row, field, true);
+      continue;
+    }
+
+    auto& variableWidthOffset = variableWidthOffsets[i];
+    int32_t serializedBytes;
+    if (isString) {
+      const auto value = decoded_.valueAt<StringView>(rows[i]);
+      memcpy(row + variableWidthOffset, value.data(), value.size());
+      serializedBytes = value.size();
+    } else {
+      serializedBytes =
+          serializeVariableWidth(rows[i], row + variableWidthOffset);
+    }
+
+    // Write size and offset.
+    uint64_t sizeAndOffset = variableWidthOffset << 32 | serializedBytes;
+    reinterpret_cast<uint64_t*>(row + nullBytes)[field] = sizeAndOffset;
+
+    variableWidthOffset += alignBytes(serializedBytes);
+  }
+}
 } // namespace bytedance::bolt::row
@@ -50,6 +50,21 @@ class UnsafeRowFast {
   /// 'buffer' must have sufficient capacity and set to all zeros.
   int32_t serialize(vector_size_t index, char* buffer);
 
+  /// Writes the serialized sizes of rows [offset, offset + size) to 'sizes'.
+  /// Goes over the input one column at a time, which avoids the per-field
+  /// type dispatch of calling 'rowSize' for each row.
+  void rowSizes(vector_size_t offset, vector_size_t size, int32_t* sizes);
+
+  /// Serializes rows [offset, offset + size) one column at a time. Row
+  /// 'offset + i' is written to 'buffer + bufferOffsets[i]', which must have
+  /// room for the size returned by 'rowSizes' and be set to all zeros. The
+  /// result is the same as calling 'serialize' for each row.
+  void serialize(
+      vector_size_t offset,
+      vector_size_t size,
+      const size_t* bufferOffsets,
+      char* buffer);
+
  protected:
   explicit UnsafeRowFast(const VectorPtr& vector);
 
@@ -115,6 +130,35 @@ class UnsafeRowFast {
   /// Serializes struct value to buffer. Value must not be null.
   int32_t serializeRow(vector_size_t index, char* buffer);
 
+  /// Adds the serialized sizes of the non-null values at 'rows' to 'sizes'.
+  /// Variable-width types only.
+  void addVariableWidthSizes(
+      const vector_size_t* rows,
+      vector_size_t size,
+      int32_t* sizes);
+
+  /// Writes the values at 'rows' to field 'field' of the rows at 'buffer +
+  /// bufferOffsets[i]', or sets the null bit of the field. Fixed-width types
+  /// only.
+  void serializeFixedWidthColumn(
+      const vector_size_t* rows,
+      vector_size_t size,
+      column_index_t field,
+      int32_t nullBytes,
+      const size_t* bufferOffsets,
+      char* buffer);
+
+  /// Same as above for variable-width types. The values are appended at
+  /// 'variableWidthOffsets[i]' of each row, which is advanced past them.
+  void serializeVariableWidthColumn(
+      const vector_size_t* rows,
+      vector_size_t size,
+      column_index_t field,
+      int32_t nullBytes,
+      const size_t* bufferOffsets,
+      char* buffer,
+      int64_t* variableWidthOffsets);
+
   const TypeKind typeKind_;
   DecodedVector decoded_;
 
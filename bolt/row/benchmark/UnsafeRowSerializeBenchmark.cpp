@@ -54,6 +54,16 @@ class SerializeBenchmark {
     BOLT_CHECK_EQ(serialized.size(), data->size());
   }
 
+  void serializeUnsafeBatch(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    auto data = makeData(rowType);
+    suspender.dismiss();
+
+    UnsafeRowFast fast(data);
+    auto serialized = serializeBatch(fast, data->size());
+    BOLT_CHECK_EQ(serialized.size(), data->size());
+  }
+
   void deserializeUnsafe(const RowTypePtr& rowType) {
     folly::BenchmarkSuspender suspender;
     auto data = makeData(rowType);
@@ -79,6 +89,16 @@ class SerializeBenchmark {
     BOLT_CHECK_EQ(serialized.size(), data->size());
   }
 
+  void serializeCompactBatch(const RowTypePtr& rowType) {
+    folly::BenchmarkSuspender suspender;
+    auto data = makeData(rowType);
+    suspender.dismiss();
+
+    CompactRow compact(data);
+    auto serialized = serializeBatch(compact, data->size());
+    BOLT_CHECK_EQ(serialized.size(), data->size());
+  }
+
   void deserializeCompact(const RowTypePtr& rowType) {
     folly::BenchmarkSuspender suspender;
     auto data = makeData(rowType);
@@ -198,6 +218,32 @@ class SerializeBenchmark {
     return serialized;
   }
 
+  // Computes the row sizes and serializes all rows one column at a time.
+  template <typename Row>
+  std::vector<std::string_view>
+  serializeBatch(Row& row, vector_size_t numRows) {
+    std::vector<int32_t> rowSizes(numRows);
+    row.rowSizes(0, numRows, rowSizes.data());
+    std::vector<size_t> offsets(numRows);
+    size_t totalSize = 0;
+    for (auto i = 0; i < numRows; ++i) {
+      offsets[i] = totalSize;
+      totalSize += rowSizes[i];
+    }
+
+    buffer_ = AlignedBuffer::allocate<char>(totalSize, pool(), 0);
+    auto rawBuffer = buffer_->asMutable<char>();
+    row.serialize(0, numRows, offsets.data(), rawBuffer);
+
+    std::vector<std::string_view> serialized;
+    serialized.reserve(numRows);
+    for (auto i = 0; i < numRows; ++i) {
+      serialized.push_back(
+          std::string_view(rawBuffer + offsets[i], rowSizes[i]));
+    }
+    return serialized;
+  }
+
   HashStringAllocator::Position serialize(
       const RowVectorPtr& data,
       HashStringAllocator& allocator) {
@@ -216,37 +262,48 @@ class SerializeBenchmark {
 
   std::shared_ptr<memory::MemoryPool> pool_{
       memory::memoryManager()->addLeafPool()};
+  BufferPtr buffer_;
 };
 
-#define SERDE_BENCHMARKS(name, rowType)      \
-  BENCHMARK(unsafe_serialize_##name) {       \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeUnsafe(rowType);      \
-  }                                          \
-                                             \
-  BENCHMARK(compact_serialize_##name) {      \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeCompact(rowType);     \
-  }                                          \
-                                             \
-  BENCHMARK(container_serialize_##name) {    \
-    SerializeBenchmark benchmark;            \
-    benchmark.serializeContainer(rowType);   \
-  }                                          \
-                                             \
-  BENCHMARK(unsafe_deserialize_##name) {     \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeUnsafe(rowType);    \
-  }                                          \
-                                             \
-  BENCHMARK(compact_deserialize_##name) {    \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeCompact(rowType);   \
-  }                                          \
-                                             \
-  BENCHMARK(container_deserialize_##name) {  \
-    SerializeBenchmark benchmark;            \
-    benchmark.deserializeContainer(rowType); \
+#define SERDE_BENCHMARKS(name, rowType)       \
+  BENCHMARK(unsafe_serialize_##name) {        \
+    SerializeBenchmark benchmark;             \
+    benchmark.serializeUnsafe(rowType);       \
+  }                                           \
+                                              \
+  BENCHMARK(unsafe_serialize_batch_##name) {  \
+    SerializeBenchmark benchmark;             \
+    benchmark.serializeUnsafeBatch(rowType);  \
+  }                                           \
+                                              \
+  BENCHMARK(compact_serialize_##name) {       \
+    SerializeBenchmark benchmark;             \
+    benchmark.serializeCompact(rowType);      \
+  }                                           \
+                                              \
+  BENCHMARK(compact_serialize_batch_##name) { \
+    SerializeBenchmark benchmark;             \
+    benchmark.serializeCompactBatch(rowType); \
+  }                                           \
+                                              \
+  BENCHMARK(container_serialize_##name) {     \
+    SerializeBenchmark benchmark;             \
+    benchmark.serializeContainer(rowType);    \
+  }                                           \
+                                              \
+  BENCHMARK(unsafe_deserialize_##name) {      \
+    SerializeBenchmark benchmark;             \
+    benchmark.deserializeUnsafe(rowType);     \
+  }                                           \
+                                              \
+  BENCHMARK(compact_deserialize_##name) {     \
+    SerializeBenchmark benchmark;             \
+    benchmark.deserializeCompact(rowType);    \
+  }                                           \
+                                              \
+  BENCHMARK(container_deserialize_##name) {   \
+    SerializeBenchmark benchmark;             \
+    benchmark.deserializeContainer(rowType);  \
   }
 
 SERDE_BENCHMARKS(
@@ -299,6 +356,22 @@ SERDE_BENCHMARKS(
         VARCHAR(),
     }));
 
+// Wide schemas as seen at Spark row boundaries, where the per-field type
+// dispatch of row-at-a-time serialization dominates.
+RowTypePtr wideRowType(int32_t numGroups) {
+  std::vector<TypePtr> types;
+  for (auto i = 0; i < numGroups; ++i) {
+    types.insert(
+        types.end(),
+        {BIGINT(), INTEGER(), DOUBLE(), VARCHAR(), BOOLEAN(), DECIMAL(12, 2)});
+  }
+  return ROW(std::move(types));
+}
+
+SERDE_BENCHMARKS(wide60, wideRowType(10));
+
+SERDE_BENCHMARKS(wide120, wideRowType(20));
+
 SERDE_BENCHMARKS(arrays, ROW({BIGINT(), ARRAY(BIGINT())}));
 
 SERDE_BENCHMARKS(nestedArrays, ROW({BIGINT(), ARRAY(ARRAY(BIGINT()))}));
@@ -88,6 +88,19 @@ class CompactRowTest : public ::testing::Test, public VectorTestBase {
 
     BOLT_CHECK_EQ(offset, totalSize);
 
+    // Serializing one column at a time must produce the same bytes.
+    std::vector<int32_t> rowSizes(numRows);
+    row.rowSizes(0, numRows, rowSizes.data());
+    std::vector<size_t> bufferOffsets(numRows);
+    for (auto i = 0; i < numRows; ++i) {
+      ASSERT_EQ(rowSizes[i], serialized[i].size());
+      bufferOffsets[i] = serialized[i].data() - rawBuffer;
+    }
+    BufferPtr batchBuffer = AlignedBuffer::allocate<char>(totalSize, pool(), 0);
+    row.serialize(
+        0, numRows, bufferOffsets.data(), batchBuffer->asMutable<char>());
+    ASSERT_EQ(0, memcmp(rawBuffer, batchBuffer->as<char>(), totalSize));
+
     auto copy = CompactRow::deserialize(serialized, rowType, pool());
     assertEqualVectors(data, copy);
   }
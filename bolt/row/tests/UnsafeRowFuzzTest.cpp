@@ -191,5 +191,50 @@ TEST_F(UnsafeRowFuzzTests, fast) {
   });
 }
 
+TEST_F(UnsafeRowFuzzTests, fastBatch) {
+  auto rowType = ROW({
+      BOOLEAN(),
+      TINYINT(),
+      SMALLINT(),
+      INTEGER(),
+      VARCHAR(),
+      BIGINT(),
+      REAL(),
+      DOUBLE(),
+      VARBINARY(),
+      UNKNOWN(),
+      DECIMAL(20, 2),
+      DECIMAL(12, 4),
+      TIMESTAMP(),
+      DATE(),
+      ARRAY(BIGINT()),
+      ARRAY(VARCHAR()),
+      MAP(BIGINT(), VARCHAR()),
+      ROW({BOOLEAN(), INTEGER(), VARCHAR(), ARRAY(BIGINT())}),
+  });
+
+  doTest(rowType, [&](const RowVectorPtr& data) {
+    const auto numRows = data->size();
+    UnsafeRowFast fast(data);
+
+    std::vector<int32_t> rowSizes(numRows);
+    fast.rowSizes(0, numRows, rowSizes.data());
+    std::vector<size_t> bufferOffsets(numRows);
+    for (auto i = 0; i < numRows; ++i) {
+      BOLT_CHECK_LE(rowSizes[i], kBufferSize);
+      EXPECT_EQ(rowSizes[i], fast.rowSize(i)) << i << ", " << data->toString(i);
+      bufferOffsets[i] = buffers_[i] - buffers_[0];
+    }
+    fast.serialize(0, numRows, bufferOffsets.data(), buffers_[0]);
+
+    std::vector<std::optional<std::string_view>> serialized;
+    serialized.reserve(numRows);
+    for (auto i = 0; i < numRows; ++i) {
+      serialized.push_back(std::string_view(buffers_[i], rowSizes[i]));
+    }
+    return serialized;
+  });
+}
+
 } // namespace
 } // namespace bytedance::bolt::row
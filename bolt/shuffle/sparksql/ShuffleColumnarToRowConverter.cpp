@@ -54,10 +54,13 @@ ShuffleColumnarToRowConverter::getWithStats(
   stats.totalMemorySize = 0;
   auto numRows = rowVector->size();
   if (fixedRowSize_) {
+    stats.rowSizes.assign(numRows, fixedRowSize_);
     stats.totalMemorySize = fixedRowSize_ * numRows;
   } else {
-    for (auto i = 0; i < numRows; ++i) {
-      stats.totalMemorySize += stats.compactRow->rowSize(i);
+    stats.rowSizes.resize(numRows);
+    stats.compactRow->rowSizes(0, numRows, stats.rowSizes.data());
+    for (auto rowSize : stats.rowSizes) {
+      stats.totalMemorySize += rowSize;
     }
   }
   // layout : rowSize | unsafeRow
@@ -77,10 +80,13 @@ void ShuffleColumnarToRowConverter::convert(
   bufferAddress_ = boltBuffers_.back()->mutable_data();
   memset(bufferAddress_, 0, sizeof(int8_t) * rowVector.totalMemorySize);
   averageRowSize_ = numRows ? (rowVector.totalMemorySize / numRows) : 0;
+  // The row sizes are known up front, so the rows are laid out first and then
+  // written one column at a time.
+  std::vector<size_t> rowOffsets(numRows);
   size_t offset = kSizeOfRowHeader;
   for (auto i = 0; i < numRows; ++i) {
-    auto rowSize =
-        rowVector.compactRow->serialize(i, (char*)(bufferAddress_ + offset));
+    auto rowSize = rowVector.rowSizes[i];
+    rowOffsets[i] = offset;
     // set rowSize
     *(int32_t*)(bufferAddress_ + offset - kSizeOfRowHeader) = rowSize;
     sortedRows[indexes[i]].push_back(
@@ -88,6 +94,8 @@ void ShuffleColumnarToRowConverter::convert(
     partitionBytes[indexes[i]] += rowSize + kSizeOfRowHeader;
     offset += rowSize + kSizeOfRowHeader;
   }
+  rowVector.compactRow->serialize(
+      0, numRows, rowOffsets.data(), (char*)bufferAddress_);
 }
 
 void ShuffleRowToRowConverter::convert(
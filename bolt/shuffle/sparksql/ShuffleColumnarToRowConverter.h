@@ -99,6 +99,8 @@ class ShuffleColumnarToRowConverter {
     std::shared_ptr<bytedance::bolt::row::CompactRow> compactRow;
     int64_t numRows;
     int64_t totalMemorySize;
+    // Serialized size of each row, without the row header.
+    std::vector<int32_t> rowSizes;
   };
 
   RowVectorWithStats getWithStats(
@@ -100,11 +100,19 @@ RowVectorPtr OperatorReplayerBase::run(bool copyResults) {
   auto [task, result] =
       traceTaskRunner.maxDrivers(driverIds_.size())
           .spillDirectory(spillDirectory ? spillDirectory->getPath() : "")
+          .serialExecution(serialExecution_)
           .run(copyResults);
-  printStats(task);
+  recordStats(task);
   return result;
 }
 
+void OperatorReplayerBase::setQueryConfigs(
+    const std::unordered_map<std::string, std::string>& configs) {
+  for (const auto& [key, value] : configs) {
+    queryConfigs_[key] = value;
+  }
+}
+
 core::PlanNodePtr OperatorReplayerBase::createPlan() {
   const auto* replayNode = core::PlanNode::findFirstNode(
       planFragment_.get(),
@@ -139,8 +147,9 @@ std::shared_ptr<core::QueryCtx> OperatorReplayerBase::createQueryCtx() {
     connectorConfigs.emplace(
         connectorId, std::make_shared<config::ConfigBase>(std::move(configs)));
   }
+  // A serial replay task must not have an executor.
   return core::QueryCtx::create(
-      executor_,
+      serialExecution_ ? nullptr : executor_,
       core::QueryConfig{queryConfigs_},
       std::move(connectorConfigs),
       nullptr,
@@ -157,14 +166,15 @@ OperatorReplayerBase::replayNodeFactory(const core::PlanNode* node) const {
   };
 }
 
-void OperatorReplayerBase::printStats(
-    const std::shared_ptr<exec::Task>& task) const {
-  const auto planStats = exec::toPlanStats(task->taskStats());
-  const auto& stats = planStats.at(replayPlanNodeId_);
+void OperatorReplayerBase::recordStats(
+    const std::shared_ptr<exec::Task>& task) {
+  auto planStats = exec::toPlanStats(task->taskStats());
+  auto& stats = planStats.at(replayPlanNodeId_);
   for (const auto& [name, operatorStats] : stats.operatorStats) {
     LOG(INFO) << "Stats of replaying operator " << name << " : "
               << operatorStats->toString();
   }
   LOG(INFO) << "Memory usage: " << task->pool()->treeMemoryUsage(false);
+  lastRunStats_ = std::make_unique<exec::PlanNodeStats>(std::move(stats));
 }
 } // namespace bytedance::bolt::tool::trace
@@ -33,6 +33,7 @@
 #include "bolt/common/file/FileSystems.h"
 #include "bolt/core/PlanNode.h"
 #include "bolt/core/QueryCtx.h"
+#include "bolt/exec/PlanNodeStats.h"
 #include "bolt/parse/PlanNodeIdGenerator.h"
 namespace bytedance::bolt::exec {
 class Task;
@@ -59,6 +60,22 @@ class OperatorReplayerBase {
 
   virtual RowVectorPtr run(bool copyResults = true);
 
+  /// Overrides the traced query configs with 'configs' in the following runs.
+  void setQueryConfigs(
+      const std::unordered_map<std::string, std::string>& configs);
+
+  /// If true, the following runs execute the replay task on the calling
+  /// thread instead of on 'executor'.
+  void setSerialExecution(bool serialExecution) {
+    serialExecution_ = serialExecution;
+  }
+
+  /// Returns the stats of the replayed plan node in the last run, or nullptr
+  /// if there was no run.
+  const exec::PlanNodeStats* lastRunStats() const {
+    return lastRunStats_.get();
+  }
+
  protected:
   virtual core::PlanNodePtr createPlanNode(
       const core::PlanNode* node,
@@ -88,11 +105,16 @@ class OperatorReplayerBase {
       connectorConfigs_;
   core::PlanNodePtr planFragment_;
   core::PlanNodeId replayPlanNodeId_;
+  bool serialExecution_{false};
 
-  void printStats(const std::shared_ptr<exec::Task>& task) const;
+  // Logs the stats of the replayed plan node in 'task' and keeps them for
+  // lastRunStats().
+  void recordStats(const std::shared_ptr<exec::Task>& task);
 
  private:
   std::function<core::PlanNodePtr(std::string, core::PlanNodePtr)>
   replayNodeFactory(const core::PlanNode* node) const;
+
+  std::unique_ptr<exec::PlanNodeStats> lastRunStats_;
 };
 } // namespace bytedance::bolt::tool::trace
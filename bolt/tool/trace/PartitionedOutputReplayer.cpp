@@ -162,7 +162,7 @@ RowVectorPtr PartitionedOutputReplayer::run(bool /*unused*/) {
       executor_.get(),
       consumerExecutor_.get(),
       consumerCb_);
-  printStats(task);
+  recordStats(task);
   return nullptr;
 }
 
@@ -45,8 +45,9 @@ RowVectorPtr TableScanReplayer::run(bool copyResults) {
   TraceReplayTaskRunner traceTaskRunner(createPlan(), createQueryCtx());
   auto [task, result] = traceTaskRunner.maxDrivers(driverIds_.size())
                             .splits(replayPlanNodeId_, getSplits())
+                            .serialExecution(serialExecution_)
                             .run(copyResults);
-  printStats(task);
+  recordStats(task);
   return result;
 }
 
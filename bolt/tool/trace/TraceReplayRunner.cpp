@@ -30,10 +30,18 @@
 
 #include "bolt/tool/trace/TraceReplayRunner.h"
 
+#include <folly/String.h>
+#include <folly/json.h>
 #include <gflags/gflags.h>
 
+#include <algorithm>
+#include <optional>
+
+#include "bolt/common/base/SuccinctPrinter.h"
 #include "bolt/common/file/FileSystems.h"
 #include "bolt/common/memory/Memory.h"
+#include "bolt/common/testutil/Perf.h"
+#include "bolt/common/time/Timer.h"
 #include "bolt/connectors/hive/HiveConnector.h"
 #include "bolt/connectors/hive/HiveConnectorSplit.h"
 #include "bolt/connectors/hive/HiveDataSink.h"
@@ -118,6 +126,35 @@ DEFINE_string(
     function_prefix,
     "",
     "Prefix for the scalar and aggregate functions.");
+DEFINE_int32(
+    replay_runs,
+    1,
+    "Number of measured replays under each query config variant.");
+DEFINE_int32(
+    replay_warmup_runs,
+    0,
+    "Number of unmeasured replays under each query config variant before the "
+    "measured ones.");
+DEFINE_string(
+    replay_config_variants,
+    "",
+    "Semicolon-separated query config variants to replay under, each a "
+    "comma-separated list of key=value overrides of the traced query configs, "
+    "e.g. 'k1=v1,k2=v2;k1=v3'. An empty variant replays the traced configs.");
+DEFINE_bool(
+    replay_perf_counters,
+    false,
+    "Collect hardware perf counters of each measured replay. The replay then "
+    "runs on the calling thread.");
+DEFINE_string(
+    replay_report_path,
+    "",
+    "Path of the JSON report of the measured replays.");
+DEFINE_bool(
+    replay_resume,
+    false,
+    "Keep the variants already measured in --replay_report_path and only "
+    "replay the others.");
 namespace bytedance::bolt::tool::trace {
 namespace {
 VectorSerde::Kind getVectorSerdeKind() {
@@ -241,6 +278,91 @@ void printSummary(
   }
   LOG(INFO) << summary.str();
 }
+
+// Returns true if any of the flags of TraceReplayRunner::profile() is set.
+bool profileRequested() {
+  return FLAGS_replay_runs != 1 || FLAGS_replay_warmup_runs != 0 ||
+      !FLAGS_replay_config_variants.empty() || FLAGS_replay_perf_counters ||
+      !FLAGS_replay_report_path.empty();
+}
+
+std::vector<std::unordered_map<std::string, std::string>> parseConfigVariants(
+    const std::string& variants) {
+  std::vector<folly::StringPiece> variantStrings;
+  folly::split(';', variants, variantStrings);
+  std::vector<std::unordered_map<std::string, std::string>> configVariants;
+  for (const auto variant : variantStrings) {
+    std::vector<folly::StringPiece> overrides;
+    folly::split(',', variant, overrides, /*ignoreEmpty=*/true);
+    std::unordered_map<std::string, std::string> configs;
+    for (const auto configOverride : overrides) {
+      folly::StringPiece key;
+      folly::StringPiece value;
+      BOLT_USER_CHECK(
+          folly::split('=', configOverride, key, value),
+          "Invalid query config override in --replay_config_variants: {}",
+          configOverride);
+      configs[folly::trimWhitespace(key).str()] =
+          folly::trimWhitespace(value).str();
+    }
+    configVariants.push_back(std::move(configs));
+  }
+  return configVariants;
+}
+
+folly::dynamic toJson(const exec::PlanNodeStats& stats) {
+  return folly::dynamic::object("cpu_nanos", stats.cpuWallTiming.cpuNanos)(
+      "wall_nanos", stats.cpuWallTiming.wallNanos)(
+      "add_input_cpu_nanos", stats.addInputTiming.cpuNanos)(
+      "get_output_cpu_nanos", stats.getOutputTiming.cpuNanos)(
+      "finish_cpu_nanos", stats.finishTiming.cpuNanos)(
+      "background_cpu_nanos", stats.backgroundTiming.cpuNanos)(
+      "blocked_wall_nanos", stats.blockedWallNanos)(
+      "input_rows", stats.inputRows)("output_rows", stats.outputRows)(
+      "peak_memory_bytes", stats.peakMemoryBytes)(
+      "num_memory_allocations", stats.numMemoryAllocations)(
+      "spilled_input_bytes", stats.spilledInputBytes)(
+      "spilled_bytes", stats.spilledBytes)("spilled_rows", stats.spilledRows)(
+      "spilled_partitions", stats.spilledPartitions)(
+      "spilled_files", stats.spilledFiles)(
+      "spill_total_time", stats.spillTotalTime);
+}
+
+int64_t medianOf(const folly::dynamic& runs, const std::string& key) {
+  std::vector<int64_t> values;
+  for (const auto& run : runs) {
+    values.push_back(run[key].asInt());
+  }
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+// Returns the report at 'path' or null if there is none.
+folly::dynamic readReport(const std::string& path) {
+  const auto fs = filesystems::getFileSystem(path, nullptr);
+  if (!fs->exists(path)) {
+    return nullptr;
+  }
+  const auto file = fs->openFileForRead(path);
+  return folly::parseJson(file->pread(0, file->size()));
+}
+
+// Writes 'report' next to 'path' and renames it over 'path' so that an
+// interrupted write leaves the previous report intact.
+void writeReport(const std::string& path, const folly::dynamic& report) {
+  folly::json::serialization_opts opts;
+  opts.pretty_formatting = true;
+  opts.sort_keys = true;
+  const auto fs = filesystems::getFileSystem(path, nullptr);
+  const auto tmpPath = path + ".tmp";
+  if (fs->exists(tmpPath)) {
+    fs->remove(tmpPath);
+  }
+  const auto file = fs->openFileForWrite(tmpPath);
+  file->append(folly::json::serialize(report, opts));
+  file->close();
+  fs->rename(tmpPath, path, /*overwrite=*/true);
+}
 } // namespace
 
 TraceReplayRunner::TraceReplayRunner()
@@ -435,6 +557,114 @@ void TraceReplayRunner::run() {
     return;
   }
   BOLT_USER_CHECK(!FLAGS_task_id.empty(), "--task_id must be provided");
+  if (profileRequested()) {
+    profile();
+    return;
+  }
   createReplayer()->run(FLAGS_copy_results);
 }
+
+void TraceReplayRunner::profile() {
+  BOLT_USER_CHECK_GT(FLAGS_replay_runs, 0, "--replay_runs must be positive");
+  BOLT_USER_CHECK_GE(
+      FLAGS_replay_warmup_runs, 0, "--replay_warmup_runs must not be negative");
+  const auto traceNodeName = taskTraceMetadataReader_->nodeName(FLAGS_node_id);
+  // The counters only see the calling thread and PartitionedOutputReplayer
+  // does not run its task there.
+  BOLT_USER_CHECK(
+      !FLAGS_replay_perf_counters || traceNodeName != "PartitionedOutput",
+      "--replay_perf_counters is not supported for PartitionedOutput");
+
+  folly::dynamic report = nullptr;
+  if (FLAGS_replay_resume && !FLAGS_replay_report_path.empty()) {
+    report = readReport(FLAGS_replay_report_path);
+  }
+  if (report.isNull()) {
+    report = folly::dynamic::object("query_id", FLAGS_query_id)(
+        "task_id", FLAGS_task_id)("node_id", FLAGS_node_id)(
+        "operator", traceNodeName)("variants", folly::dynamic::array());
+  }
+  BOLT_USER_CHECK_EQ(
+      report["node_id"].asString(),
+      FLAGS_node_id,
+      "--replay_report_path has the report of another node");
+
+  const auto configVariants =
+      parseConfigVariants(FLAGS_replay_config_variants);
+  for (const auto& configs : configVariants) {
+    folly::dynamic configsJson = folly::dynamic::object;
+    for (const auto& [key, value] : configs) {
+      configsJson[key] = value;
+    }
+    auto& variants = report["variants"];
+    const auto measured = std::find_if(
+        variants.begin(), variants.end(), [&](const folly::dynamic& variant) {
+          return variant["configs"] == configsJson;
+        });
+    if (measured != variants.end()) {
+      if ((*measured)["runs"].size() >=
+          static_cast<size_t>(FLAGS_replay_runs)) {
+        LOG(INFO) << "Skipping measured query config variant "
+                  << folly::toJson(configsJson);
+        continue;
+      }
+      variants.erase(measured);
+    }
+
+    auto replayer = createReplayer();
+    replayer->setQueryConfigs(configs);
+    replayer->setSerialExecution(FLAGS_replay_perf_counters);
+    for (auto i = 0; i < FLAGS_replay_warmup_runs; ++i) {
+      replayer->run(false);
+    }
+    folly::dynamic runs = folly::dynamic::array;
+    for (auto i = 0; i < FLAGS_replay_runs; ++i) {
+      std::optional<common::testutil::Perf> perf;
+      if (FLAGS_replay_perf_counters) {
+        perf.emplace(/*autoStart=*/false);
+        perf->start();
+      }
+      uint64_t replayWallNanos{0};
+      {
+        NanosecondTimer timer(&replayWallNanos);
+        replayer->run(FLAGS_copy_results);
+      }
+      if (perf.has_value()) {
+        perf->stop();
+      }
+      const auto* stats = replayer->lastRunStats();
+      BOLT_CHECK_NOT_NULL(stats);
+      auto run = toJson(*stats);
+      run["replay_wall_nanos"] = replayWallNanos;
+      folly::dynamic operators = folly::dynamic::object;
+      for (const auto& [name, operatorStats] : stats->operatorStats) {
+        operators[name] = toJson(*operatorStats);
+      }
+      run["operators"] = std::move(operators);
+      if (perf.has_value()) {
+        folly::dynamic counters = folly::dynamic::object;
+        for (const auto& [name, value] : perf->counters()) {
+          counters[name] = value;
+        }
+        run["perf_counters"] = std::move(counters);
+      }
+      runs.push_back(std::move(run));
+    }
+
+    const auto medianWallNanos = medianOf(runs, "replay_wall_nanos");
+    const auto medianCpuNanos = medianOf(runs, "cpu_nanos");
+    LOG(INFO) << "Query config variant " << folly::toJson(configsJson)
+              << ": median replay wall time "
+              << succinctNanos(medianWallNanos) << ", median operator cpu time "
+              << succinctNanos(medianCpuNanos);
+    variants.push_back(
+        folly::dynamic::object("configs", std::move(configsJson))(
+            "warmup_runs", FLAGS_replay_warmup_runs)("runs", std::move(runs))(
+            "median_replay_wall_nanos", medianWallNanos)(
+            "median_cpu_nanos", medianCpuNanos));
+    if (!FLAGS_replay_report_path.empty()) {
+      writeReport(FLAGS_replay_report_path, report);
+    }
+  }
+}
 } // namespace bytedance::bolt::tool::trace
@@ -53,6 +53,12 @@ DECLARE_double(driver_cpu_executor_hw_multiplier);
 DECLARE_string(memory_arbitrator_type);
 DECLARE_bool(copy_results);
 DECLARE_string(function_prefix);
+DECLARE_int32(replay_runs);
+DECLARE_int32(replay_warmup_runs);
+DECLARE_string(replay_config_variants);
+DECLARE_bool(replay_perf_counters);
+DECLARE_string(replay_report_path);
+DECLARE_bool(replay_resume);
 namespace bytedance::bolt::tool::trace {
 
 /// The trace replay runner. It is configured through a set of gflags passed
@@ -72,6 +78,13 @@ class TraceReplayRunner {
  protected:
   std::unique_ptr<tool::trace::OperatorReplayerBase> createReplayer() const;
 
+  // Replays the traced operator --replay_runs times after
+  // --replay_warmup_runs unmeasured replays under each of
+  // --replay_config_variants, and writes the stats of the measured replays to
+  // --replay_report_path. The report is rewritten after each variant so that
+  // an interrupted profile can be resumed with --replay_resume.
+  void profile();
+
   const std::unique_ptr<folly::CPUThreadPoolExecutor> cpuExecutor_;
   const std::unique_ptr<folly::IOThreadPoolExecutor> ioExecutor_;
   std::shared_ptr<filesystems::FileSystem> fs_;
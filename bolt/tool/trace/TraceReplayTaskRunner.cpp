@@ -80,6 +80,12 @@ TraceReplayTaskRunner& TraceReplayTaskRunner::spillDirectory(
   return *this;
 }
 
+TraceReplayTaskRunner& TraceReplayTaskRunner::serialExecution(
+    bool serialExecution) {
+  cursorParams_.serialExecution = serialExecution;
+  return *this;
+}
+
 TraceReplayTaskRunner& TraceReplayTaskRunner::splits(
     const core::PlanNodeId& planNodeId,
     std::vector<exec::Split> splits) {
@@ -57,6 +57,10 @@ class TraceReplayTaskRunner {
   /// be built from it.
   TraceReplayTaskRunner& spillDirectory(const std::string& dir);
 
+  /// If true, runs the task on the calling thread. The query context must not
+  /// have an executor then. Default is false.
+  TraceReplayTaskRunner& serialExecution(bool serialExecution);
+
   /// Splits of this task.
   TraceReplayTaskRunner& splits(
       const core::PlanNodeId& planNodeId,
@@ -34,6 +34,7 @@
 #include <string>
 
 #include <folly/experimental/EventCount.h>
+#include <folly/json.h>
 
 #include "bolt/common/file/FileSystems.h"
 #include "bolt/common/file/Utils.h"
@@ -394,6 +395,89 @@ TEST_F(HashJoinReplayerTest, runner) {
   }
 }
 
+TEST_F(HashJoinReplayerTest, profile) {
+  gflags::FlagSaver flagSaver;
+  const auto testDir = TempDirectoryPath::create();
+  const auto traceRoot = fmt::format("{}/{}", testDir->getPath(), "traceRoot");
+  std::shared_ptr<Task> task;
+  auto tracePlanWithSplits = createPlan(
+      tableDir_,
+      core::JoinType::kInner,
+      probeKeys_,
+      buildKeys_,
+      probeInput_,
+      buildInput_);
+  AssertQueryBuilder traceBuilder(tracePlanWithSplits.plan);
+  traceBuilder.config(core::QueryConfig::kQueryTraceEnabled, true)
+      .config(core::QueryConfig::kQueryTraceDir, traceRoot)
+      .config(core::QueryConfig::kQueryTraceMaxBytes, 100UL << 30)
+      .config(core::QueryConfig::kQueryTraceTaskRegExp, ".*")
+      .config(core::QueryConfig::kQueryTraceNodeIds, traceNodeId_);
+  for (const auto& [planNodeId, nodeSplits] : tracePlanWithSplits.splits) {
+    traceBuilder.splits(planNodeId, nodeSplits);
+  }
+  traceBuilder.copyResults(pool(), task);
+
+  const auto reportPath = fmt::format("{}/report.json", testDir->getPath());
+  const auto readReport = [&]() {
+    const auto file = filesystems::getFileSystem(reportPath, nullptr)
+                          ->openFileForRead(reportPath);
+    return folly::parseJson(file->pread(0, file->size()));
+  };
+  const std::string batchRows = core::QueryConfig::kPreferredOutputBatchRows;
+
+  FLAGS_root_dir = traceRoot;
+  FLAGS_query_id = task->queryCtx()->queryId();
+  FLAGS_task_id = task->taskId();
+  FLAGS_node_id = traceNodeId_;
+  FLAGS_driver_ids = "";
+  FLAGS_replay_warmup_runs = 1;
+  FLAGS_replay_runs = 2;
+  FLAGS_replay_config_variants =
+      fmt::format("{}=10;{}=100", batchRows, batchRows);
+  FLAGS_replay_perf_counters = true;
+  FLAGS_replay_report_path = reportPath;
+  {
+    TraceReplayRunner runner;
+    runner.init();
+    runner.run();
+  }
+  auto report = readReport();
+  ASSERT_EQ(report["node_id"].asString(), traceNodeId_);
+  ASSERT_EQ(report["operator"].asString(), "HashJoin");
+  ASSERT_EQ(report["variants"].size(), 2);
+  ASSERT_EQ(report["variants"][1]["configs"][batchRows].asString(), "100");
+  for (const auto& variant : report["variants"]) {
+    ASSERT_EQ(variant["runs"].size(), 2);
+    for (const auto& run : variant["runs"]) {
+      ASSERT_GT(run["replay_wall_nanos"].asInt(), 0);
+      ASSERT_GT(run["input_rows"].asInt(), 0);
+      ASSERT_GT(run["peak_memory_bytes"].asInt(), 0);
+      ASSERT_EQ(run["operators"].count("HashBuild"), 1);
+      ASSERT_EQ(run["operators"].count("HashProbe"), 1);
+      ASSERT_EQ(run.count("perf_counters"), 1);
+    }
+  }
+
+  // Resuming keeps the measured variants and only replays the new one.
+  const auto measuredVariants = report["variants"];
+  FLAGS_replay_resume = true;
+  FLAGS_replay_perf_counters = false;
+  FLAGS_replay_config_variants =
+      fmt::format("{}=10;{}=100;{}=1000", batchRows, batchRows, batchRows);
+  {
+    TraceReplayRunner runner;
+    runner.init();
+    runner.run();
+  }
+  report = readReport();
+  ASSERT_EQ(report["variants"].size(), 3);
+  ASSERT_EQ(report["variants"][0], measuredVariants[0]);
+  ASSERT_EQ(report["variants"][1], measuredVariants[1]);
+  ASSERT_EQ(report["variants"][2]["configs"][batchRows].asString(), "1000");
+  ASSERT_EQ(report["variants"][2]["runs"][0].count("perf_counters"), 0);
+}
+
 DEBUG_ONLY_TEST_F(HashJoinReplayerTest, hashBuildSpill) {
   const auto planWithSplits = createPlan(
       tableDir_,
@@ -155,16 +155,8 @@ TypePtr TypeCast(const caffe2::TypeMeta& type) {
   }
 }
 
-Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
-  // This will throw if the table type is not compatible with tensor types.
-  auto torch_type = TypeCast(type_);
-  if (type_->cppSizeInBytes() != torch_type.itemsize()) {
-    BOLT_FAIL(fmt::format(
-        "Bolt dtype equivalent ({}) to tensor dtype ({}) do not have the same item size.",
-        type_->name(),
-        torch_type.name()));
-  }
-
+void BoltRowVectorToTorchTensor::checkConvertible(
+    const RowVector& table) const {
   // We don't support conversion of null values into a tensor value.
   // TODO, we should add a field to the protobuf message to allow null to
   // type conversion and fields with conversion values with reasonable
@@ -174,21 +166,13 @@ Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
         "Conversion from RowVector to Tensor cannot contain nulls. mayHaveNullsRecursive() returned true.");
   }
 
-  // If we convert an empty table, we return a default empty tensor.
-  const auto& bolt_columns = table.children();
-  const long int num_rows = table.size();
-  if (bolt_columns.empty() || num_rows == 0) {
-    return Tensor(torch_type);
-  }
-
   // Invariant check.
   // 1. A tensor can only have one data type.
   // 2. Every element of the tensor need to have the same size.
   // We check that columns have the same size.
-  const auto column_size = num_rows * type_->cppSizeInBytes();
-  const long int num_columns = table.childrenSize();
-  for (size_t i = 0; i < bolt_columns.size(); i++) {
-    const auto& column = *bolt_columns[i];
+  const long int num_rows = table.size();
+  for (const auto& child : table.children()) {
+    const auto& column = *child;
     if (!column.type()->equivalent(*type_)) {
       BOLT_FAIL(fmt::format(
           "Cannot convert bolt RowVector with children of different types to "
@@ -205,10 +189,29 @@ Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
           column.size()));
     }
   }
+}
+
+::caffe2::TypeMeta BoltRowVectorToTorchTensor::torchType() const {
+  // This will throw if the table type is not compatible with tensor types.
+  auto torch_type = TypeCast(type_);
+  if (type_->cppSizeInBytes() != torch_type.itemsize()) {
+    BOLT_FAIL(fmt::format(
+        "Bolt dtype equivalent ({}) to tensor dtype ({}) do not have the same item size.",
+        type_->name(),
+        torch_type.name()));
+  }
+  return torch_type;
+}
 
+Tensor BoltRowVectorToTorchTensor::copyColumns(
+    const std::vector<const RowVector*>& tables,
+    ::caffe2::TypeMeta torch_type,
+    long int num_rows,
+    long int num_columns) {
   // Make a contiguous storage large enough to store the columns.
   // And create uninitialized tensor.
-  const size_t torch_storage_size = column_size * num_columns;
+  const auto item_size = type_->cppSizeInBytes();
+  const size_t torch_storage_size = num_rows * num_columns * item_size;
   void* ptr = pool_->allocate(torch_storage_size);
   char* memory = reinterpret_cast<char*>(ptr);
   if (memory == nullptr) {
@@ -216,14 +219,16 @@ Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
         "Tensor allocation of {} bytes failed.", torch_storage_size));
   }
 
-  // Materialize table in memory.
-  [[maybe_unused]] auto _ = table.loadedVector();
-
-  // Copy columns to the storage.
-  for (auto c = bolt_columns.cbegin(); c != bolt_columns.cend(); ++c) {
-    const auto& column = *c->get()->loadedVector();
-    std::memcpy(memory, column.values()->asMutable<char>(), column_size);
-    memory += column_size;
+  // Copy columns to the storage. The tensor is column major, so column 'c' of
+  // every table goes after column 'c' of the previous tables.
+  for (long int c = 0; c < num_columns; ++c) {
+    for (const auto* table : tables) {
+      // Materialize table in memory.
+      const auto& column = *table->childAt(c)->loadedVector();
+      const auto column_size = table->size() * item_size;
+      std::memcpy(memory, column.values()->as<char>(), column_size);
+      memory += column_size;
+    }
   }
 
   // Build tensor.
@@ -235,6 +240,60 @@ Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
       pool_);
 }
 
+Tensor BoltRowVectorToTorchTensor::operator()(const RowVector& table) {
+  auto torch_type = torchType();
+  checkConvertible(table);
+
+  // If we convert an empty table, we return a default empty tensor.
+  const long int num_rows = table.size();
+  const long int num_columns = table.childrenSize();
+  if (num_columns == 0 || num_rows == 0) {
+    return Tensor(torch_type);
+  }
+  return copyColumns({&table}, torch_type, num_rows, num_columns);
+}
+
+Tensor BoltRowVectorToTorchTensor::operator()(
+    std::vector<RowVectorPtr>&& tables) {
+  auto torch_type = torchType();
+  long int num_rows = 0;
+  for (const auto& table : tables) {
+    checkConvertible(*table);
+    if (table->childrenSize() != tables[0]->childrenSize()) {
+      BOLT_FAIL(fmt::format(
+          "Cannot convert RowVectors with {} and {} columns into one tensor.",
+          tables[0]->childrenSize(),
+          table->childrenSize()));
+    }
+    num_rows += table->size();
+  }
+  if (tables.empty() || tables[0]->childrenSize() == 0 || num_rows == 0) {
+    return Tensor(torch_type);
+  }
+  const long int num_columns = tables[0]->childrenSize();
+
+  // A single flat column that nothing else references is wrapped as is. The
+  // exclusive ownership matters as the script may modify its input in place.
+  if (tables.size() == 1 && num_columns == 1 && tables[0].use_count() == 1) {
+    auto& column = tables[0]->childAt(0);
+    if (column.use_count() == 1 && column->isFlatEncoding() &&
+        column->values() != nullptr && column->values()->refCount() == 1 &&
+        !column->values()->isView()) {
+      auto values = column->values();
+      tables.clear();
+      return Tensor(
+          std::move(values), torch_type, ::c10::IntArrayRef{num_rows, 1});
+    }
+  }
+
+  std::vector<const RowVector*> rawTables;
+  rawTables.reserve(tables.size());
+  for (const auto& table : tables) {
+    rawTables.push_back(table.get());
+  }
+  return copyColumns(rawTables, torch_type, num_rows, num_columns);
+}
+
 template <TypeKind kind>
 char* getFlatBufferRawValues(VectorPtr ptr) {
   using T = typename ::bytedance::bolt::TypeTraits<kind>::NativeType;
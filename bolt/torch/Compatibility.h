@@ -95,7 +95,24 @@ class BoltRowVectorToTorchTensor : public CopyConverter<
   ::bytedance::bolt::torch::Tensor operator()(
       const ::bytedance::bolt::RowVector&);
 
+  /// Converts the rows of 'tables' one after another into a single tensor,
+  /// copying each value once. A lone table with one flat column that is not
+  /// referenced elsewhere is wrapped by the tensor without a copy. 'tables'
+  /// may be cleared by the call.
+  ::bytedance::bolt::torch::Tensor operator()(
+      std::vector<::bytedance::bolt::RowVectorPtr>&& tables);
+
  private:
+  ::caffe2::TypeMeta torchType() const;
+
+  void checkConvertible(const ::bytedance::bolt::RowVector& table) const;
+
+  ::bytedance::bolt::torch::Tensor copyColumns(
+      const std::vector<const ::bytedance::bolt::RowVector*>& tables,
+      ::caffe2::TypeMeta torch_type,
+      long int num_rows,
+      long int num_columns);
+
   ::bytedance::bolt::memory::MemoryPool* pool_;
   const ::bytedance::bolt::TypePtr type_;
 };
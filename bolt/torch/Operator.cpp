@@ -28,6 +28,7 @@
 #include "bolt/vector/ComplexVector.h"
 
 using ::bytedance::bolt::BoltUserError;
+using ::bytedance::bolt::ContinuePromise;
 using ::bytedance::bolt::RowTypePtr;
 using ::bytedance::bolt::RowVectorPtr;
 using ::bytedance::bolt::common::SpillConfig;
@@ -51,7 +52,14 @@ TorchOperator::TorchOperator(
           std::string("TorchOperator::") +
               get_function(*load(module_script))->name(),
           std::move(spillConfig)),
+      batchRows_(driverCtx->queryConfig().torchOperatorBatchRows()),
+      maxPendingBatches_(
+          driverCtx->queryConfig().torchOperatorMaxPendingBatches()),
+      executor_(std::make_unique<::folly::CPUThreadPoolExecutor>(
+          driverCtx->queryConfig().torchOperatorNumThreads())),
       module_(load(module_script)) {
+  BOLT_USER_CHECK_GE(batchRows_, 0);
+  BOLT_USER_CHECK_GT(maxPendingBatches_, 0);
   // Set tensors input/output type.
   if (outputType->children().empty()) {
     boltTensorType_ = kDefaultType_;
@@ -78,7 +86,7 @@ TorchOperator::~TorchOperator() {
   std::unique_lock lock(mtx_);
   cv_.wait(lock, [this]() {
     return tensorInputs_.empty() && tensorOutputs_.empty() &&
-        numProcessingInputs_ == 0;
+        numProcessingInputs_ == 0 && numRunningBatches_ == 0;
   });
 }
 
@@ -86,13 +94,33 @@ Function& TorchOperator::getTorchFunction() const {
   return *get_function(*module_);
 }
 
+bool TorchOperator::needsInput() const {
+  if (!streaming()) {
+    return !noMoreInput_;
+  }
+  std::unique_lock lock(mtx_);
+  return !noMoreInput_ && numPendingBatches_ < maxPendingBatches_;
+}
+
 void TorchOperator::addInput(RowVectorPtr input) {
+  if (streaming()) {
+    if (input->size() == 0) {
+      return;
+    }
+    batchInputRows_ += input->size();
+    batchInputs_.emplace_back(std::move(input));
+    if (batchInputRows_ >= batchRows_) {
+      dispatchBatch();
+    }
+    return;
+  }
+
   // Push the tensor to the queue of tensors to process.
   {
     std::unique_lock lock(mtx_);
     tensorInputs_.emplace_back(std::move(input));
     // Schedule a task to process this input.
-    executor_.add([this]() { ProcessInput(); });
+    executor_->add([this]() { ProcessInput(); });
   }
 }
 
@@ -116,15 +144,80 @@ void TorchOperator::ProcessInput() {
 
   cv_.notify_all();
 
+  result = run([&]() {
+    return BoltRowVectorToTorchTensor(pool(), boltTensorType_)(*input_table);
+  });
+
+  // Append result to the output queue.
+  {
+    std::unique_lock lock(mtx_);
+    tensorOutputs_.emplace_back(std::move(result));
+    numProcessingInputs_--;
+  }
+
+  cv_.notify_all();
+}
+
+void TorchOperator::dispatchBatch() {
+  std::vector<RowVectorPtr> inputs;
+  inputs.swap(batchInputs_);
+  const auto numRows = batchInputRows_;
+  batchInputRows_ = 0;
+
+  if (!reserved_) {
+    // Reserve room for the input and output tensors of all the batches that
+    // can be in flight, so that the conversions on the executor do not have
+    // to grow the pool one allocation at a time.
+    const int64_t bytesPerBatch = numRows *
+        (inputs[0]->childrenSize() + outputType_->size()) *
+        boltTensorType_->cppSizeInBytes();
+    reserved_ = pool()->maybeReserve(bytesPerBatch * maxPendingBatches_);
+  }
+
+  uint64_t seq;
+  {
+    std::unique_lock lock(mtx_);
+    seq = nextBatchSeq_++;
+    ++numPendingBatches_;
+    ++numRunningBatches_;
+  }
+  executor_->add([this, seq, inputs = std::move(inputs)]() mutable {
+    runBatch(seq, std::move(inputs));
+  });
+}
+
+void TorchOperator::runBatch(uint64_t seq, std::vector<RowVectorPtr> inputs) {
+  auto result = run([&]() {
+    return BoltRowVectorToTorchTensor(pool(), boltTensorType_)(
+        std::move(inputs));
+  });
+  inputs.clear();
+
+  std::vector<ContinuePromise> promises;
+  {
+    std::unique_lock lock(mtx_);
+    batchOutputs_.emplace(seq, std::move(result));
+    --numRunningBatches_;
+    promises.swap(promises_);
+  }
+  for (auto& promise : promises) {
+    promise.setValue();
+  }
+  cv_.notify_all();
+}
+
+TorchOperator::ResultOutput TorchOperator::run(
+    const std::function<Tensor()>& makeInput) {
+  ResultOutput result{RowVectorPtr{nullptr}};
+
   // 1. Convert the table to a tensor.
   // 2. Process the input tensor through the compiled torch script.
   // 3. Convert the output tensor back to a bolt type.
   try {
     // Inner try block converts exceptions to BoltException;
-    // Outter try block queues the exception in the output queue and returns.
+    // Outter try block returns the exception as the result.
     try {
-      auto input_tensor =
-          BoltRowVectorToTorchTensor(pool(), boltTensorType_)(*input_table);
+      auto input_tensor = makeInput();
       Function& fn = getTorchFunction();
       auto output_tensor = fn({::c10::IValue(input_tensor.get())});
       result = TorchTensorToBoltRowVector(
@@ -148,18 +241,13 @@ void TorchOperator::ProcessInput() {
   } catch (...) {
     result = std::current_exception();
   }
-
-  // Append result to the output queue.
-  {
-    std::unique_lock lock(mtx_);
-    tensorOutputs_.emplace_back(std::move(result));
-    numProcessingInputs_--;
-  }
-
-  cv_.notify_all();
+  return result;
 }
 
 void TorchOperator::noMoreInput() {
+  if (streaming() && !batchInputs_.empty()) {
+    dispatchBatch();
+  }
   std::unique_lock lock(mtx_);
   Operator::noMoreInput();
   cv_.notify_all();
@@ -167,17 +255,55 @@ void TorchOperator::noMoreInput() {
 
 bool TorchOperator::isFinished() {
   std::unique_lock lock(mtx_);
+  if (streaming()) {
+    return noMoreInput_ && batchInputs_.empty() && numPendingBatches_ == 0;
+  }
   return noMoreInput_ && tensorInputs_.empty() && numProcessingInputs_ == 0;
 }
 
 BlockingReason TorchOperator::isBlocked(
     bytedance::bolt::ContinueFuture* future) {
+  if (!streaming()) {
+    return BlockingReason::kNotBlocked;
+  }
+  std::unique_lock lock(mtx_);
+  if (hasBatchOutputLocked() || numPendingBatches_ == 0) {
+    return BlockingReason::kNotBlocked;
+  }
+  // Wait for a batch to complete once no more input can be taken.
+  if (noMoreInput_ || numPendingBatches_ >= maxPendingBatches_) {
+    promises_.emplace_back("TorchOperator::isBlocked");
+    *future = promises_.back().getSemiFuture();
+    return BlockingReason::kWaitForProducer;
+  }
   return BlockingReason::kNotBlocked;
 }
 
 RowVectorPtr TorchOperator::getOutput() {
   std::unique_lock lock(mtx_);
 
+  if (streaming()) {
+    if (!hasBatchOutputLocked()) {
+      return nullptr;
+    }
+    auto it = batchOutputs_.begin();
+    auto result = std::move(it->second);
+    batchOutputs_.erase(it);
+    ++nextOutputSeq_;
+    --numPendingBatches_;
+    const bool release = reserved_ && noMoreInput_ && numPendingBatches_ == 0;
+    lock.unlock();
+
+    if (release) {
+      reserved_ = false;
+      pool()->release();
+    }
+    if (std::holds_alternative<std::exception_ptr>(result)) {
+      std::rethrow_exception(std::get<std::exception_ptr>(result));
+    }
+    return std::get<RowVectorPtr>(std::move(result));
+  }
+
   cv_.wait(lock, [this]() {
     return !tensorOutputs_.empty() ||
         (tensorInputs_.empty() && numProcessingInputs_ == 0);
@@ -195,7 +321,7 @@ RowVectorPtr TorchOperator::getOutput() {
   cv_.notify_all();
 
   if (std::holds_alternative<std::exception_ptr>(result)) {
-    throw std::get<std::exception_ptr>(result);
+    std::rethrow_exception(std::get<std::exception_ptr>(result));
   }
 
   return std::get<RowVectorPtr>(std::move(result));
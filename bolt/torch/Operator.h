@@ -19,6 +19,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <functional>
+#include <map>
 
 #include <ATen/core/TensorBody.h>
 #include <folly/executors/CPUThreadPoolExecutor.h>
@@ -55,6 +57,15 @@ namespace bytedance::bolt::torch {
 /// operating based on column names unless the columns of the output
 /// tensor have been renamed. For instance, you can't run a project or
 /// filter operator directly after a TorchOperator.
+///
+/// By default every input is run on its own as soon as it is added, and
+/// outputs are returned in completion order. When the query config
+/// 'torch_operator_batch_rows' is set, the operator instead streams: inputs
+/// are coalesced into micro batches of at least that many rows, each batch is
+/// converted into a single tensor and run on the operator's executor while
+/// the driver keeps adding input, and outputs are returned in input order. At
+/// most 'torch_operator_max_pending_batches' batches are in flight; past that
+/// the operator stops taking input and blocks until a batch completes.
 class TorchOperator : public bytedance::bolt::exec::Operator {
  public:
   ~TorchOperator() override;
@@ -68,9 +79,7 @@ class TorchOperator : public bytedance::bolt::exec::Operator {
           std::nullopt);
 
   // Torch module requires an input tensor.
-  bool needsInput() const override {
-    return !noMoreInput_;
-  }
+  bool needsInput() const override;
 
   // Converts input to tensor input.
   void addInput(bytedance::bolt::RowVectorPtr input) override;
@@ -89,20 +98,72 @@ class TorchOperator : public bytedance::bolt::exec::Operator {
   bool isFinished() override;
 
  private:
+  using ResultOutput =
+      std::variant<std::exception_ptr, ::bytedance::bolt::RowVectorPtr>;
+
+  bool streaming() const {
+    return batchRows_ > 0;
+  }
+
+  // Converts the tensor returned by 'makeInput', runs the torch function on
+  // it and converts its result. Errors are returned rather than thrown.
+  ResultOutput run(
+      const std::function<::bytedance::bolt::torch::Tensor()>& makeInput);
+
+  // Hands 'batchInputs_' over to the executor as the next micro batch.
+  void dispatchBatch();
+
+  // Runs micro batch 'seq' made of 'inputs' and stores its result.
+  void runBatch(
+      uint64_t seq,
+      std::vector<::bytedance::bolt::RowVectorPtr> inputs);
+
+  // Returns true if the output of the next micro batch in input order is
+  // available. Requires 'mtx_'.
+  bool hasBatchOutputLocked() const {
+    return !batchOutputs_.empty() &&
+        batchOutputs_.begin()->first == nextOutputSeq_;
+  }
+
   // The queue of inputs to process.
   // A thread will take one from the queue and start processing.
   std::deque<::bytedance::bolt::RowVectorPtr> tensorInputs_;
 
   // The number inputs that are beeing processed.
   // The queue of output done processing.
-  using ResultOutput =
-      std::variant<std::exception_ptr, ::bytedance::bolt::RowVectorPtr>;
   std::deque<ResultOutput> tensorOutputs_;
   std::size_t numProcessingInputs_{0};
 
-  std::mutex mtx_;
+  // Minimum number of rows of a micro batch. 0 if not streaming.
+  const int32_t batchRows_;
+  // Maximum number of micro batches dispatched and not yet returned.
+  const int32_t maxPendingBatches_;
+
+  // Inputs of the micro batch being coalesced and their total row count.
+  std::vector<::bytedance::bolt::RowVectorPtr> batchInputs_;
+  int64_t batchInputRows_{0};
+
+  // Sequence numbers of the next micro batch to dispatch and to return.
+  uint64_t nextBatchSeq_{0};
+  uint64_t nextOutputSeq_{0};
+
+  // Completed micro batches keyed by sequence number.
+  std::map<uint64_t, ResultOutput> batchOutputs_;
+
+  // Micro batches dispatched and not yet returned by getOutput().
+  int32_t numPendingBatches_{0};
+  // Micro batches dispatched and not yet completed.
+  int32_t numRunningBatches_{0};
+
+  // Whether memory for 'maxPendingBatches_' micro batches is reserved.
+  bool reserved_{false};
+
+  // Fulfilled when a micro batch completes.
+  std::vector<::bytedance::bolt::ContinuePromise> promises_;
+
+  mutable std::mutex mtx_;
   std::condition_variable cv_;
-  ::folly::CPUThreadPoolExecutor executor_{4};
+  std::unique_ptr<::folly::CPUThreadPoolExecutor> executor_;
 
   ::bytedance::bolt::TypePtr boltTensorType_;
   ::caffe2::TypeMeta torchTensorType_;
@@ -23,21 +23,40 @@
 #include "bolt/torch/Tensor.h"
 
 namespace bytedance::bolt::torch {
-Tensor::Tensor(
+namespace {
+// Wraps 'data' as a column major tensor.
+::at::Tensor fromBlob(
     void* data,
-    size_t data_size,
     ::caffe2::TypeMeta tensor_type,
-    ::at::IntArrayRef tensor_sizes,
-    ::bytedance::bolt::memory::MemoryPool* pool)
-    : pool_(std::move(pool)), data_(data), data_size_(data_size) {
+    ::at::IntArrayRef tensor_sizes) {
   auto options = ::at::TensorOptions().dtype(tensor_type);
   std::vector<int64_t> tensor_strides(tensor_sizes.size(), 1);
   for (std::size_t i = 1; i < tensor_sizes.size(); i++) {
     tensor_strides[i] = tensor_sizes[i - 1] * tensor_strides[i - 1];
   }
-  this->tensor_ = ::torch::from_blob(
+  return ::torch::from_blob(
       data, tensor_sizes, ::at::IntArrayRef{tensor_strides}, options);
 }
+} // namespace
+
+Tensor::Tensor(
+    void* data,
+    size_t data_size,
+    ::caffe2::TypeMeta tensor_type,
+    ::at::IntArrayRef tensor_sizes,
+    ::bytedance::bolt::memory::MemoryPool* pool)
+    : pool_(std::move(pool)), data_(data), data_size_(data_size) {
+  this->tensor_ = fromBlob(data, tensor_type, tensor_sizes);
+}
+
+Tensor::Tensor(
+    ::bytedance::bolt::BufferPtr buffer,
+    ::caffe2::TypeMeta tensor_type,
+    ::at::IntArrayRef tensor_sizes)
+    : buffer_(std::move(buffer)) {
+  this->tensor_ =
+      fromBlob(buffer_->asMutable<void>(), tensor_type, tensor_sizes);
+}
 
 Tensor::~Tensor() {
   if (data_ != nullptr && pool_ != nullptr) {
@@ -59,6 +78,7 @@ Tensor& Tensor::operator=(Tensor&& other) {
   std::swap(tensor_, other.tensor_);
   std::swap(data_, other.data_);
   std::swap(data_size_, other.data_size_);
+  std::swap(buffer_, other.buffer_);
   return *this;
 };
 } // namespace bytedance::bolt::torch
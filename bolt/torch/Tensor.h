@@ -20,6 +20,7 @@
 
 #include <ATen/core/Tensor.h>
 
+#include "bolt/buffer/Buffer.h"
 #include "bolt/common/memory/MemoryPool.h"
 
 namespace bytedance::bolt::torch {
@@ -54,6 +55,13 @@ class Tensor {
       ::at::IntArrayRef tensor_sizes,
       ::bytedance::bolt::memory::MemoryPool* pool);
 
+  // Column major tensor viewing the data of 'buffer' without a copy. The
+  // tensor holds a reference to 'buffer' for its lifetime.
+  Tensor(
+      ::bytedance::bolt::BufferPtr buffer,
+      ::caffe2::TypeMeta tensor_type,
+      ::at::IntArrayRef tensor_sizes);
+
   ~Tensor();
 
   const ::at::Tensor& get() const {
@@ -65,9 +73,11 @@ class Tensor {
   }
 
  private:
-  ::bytedance::bolt::memory::MemoryPool* pool_;
+  ::bytedance::bolt::memory::MemoryPool* pool_{nullptr};
   ::at::Tensor tensor_{};
   void* data_{nullptr};
   size_t data_size_{0};
+  // Set instead of 'data_' when the tensor views an existing buffer.
+  ::bytedance::bolt::BufferPtr buffer_;
 };
 } // namespace bytedance::bolt::torch
@@ -18,6 +18,7 @@
 #include <thread>
 #include <type_traits>
 
+#include "bolt/exec/tests/utils/AssertQueryBuilder.h"
 #include "bolt/exec/tests/utils/OperatorTestBase.h"
 #include "bolt/exec/tests/utils/PlanBuilder.h"
 #include "bolt/torch/Operator.h"
@@ -25,6 +26,7 @@
 
 using namespace ::bytedance::bolt::torch::testing;
 using namespace ::bytedance::bolt;
+using ::bytedance::bolt::exec::test::AssertQueryBuilder;
 using ::bytedance::bolt::exec::test::OperatorTestBase;
 using ::bytedance::bolt::exec::test::PlanBuilder;
 
@@ -159,3 +161,27 @@ TEST_F(TorchOperatorTest, TestOperatorBase) {
           .planNode();
   assertQuery(plan_node, expected_output);
 }
+
+TEST_F(TorchOperatorTest, TestStreamingBatches) {
+  const ::bytedance::bolt::RowVectorPtr input = MakeTable();
+  const auto expected_output = MultiplyByTwo(input);
+  auto plan_node =
+      PlanBuilder()
+          .values({input, input, input, input, input})
+          .torch(kMultiplyByTwoTorchScript, asRowType(expected_output->type()))
+          .planNode();
+  const std::vector<RowVectorPtr> expected(5, expected_output);
+
+  // Batches smaller than, spanning and larger than the inputs.
+  for (const auto batch_rows : {1, 48, 1000}) {
+    SCOPED_TRACE(fmt::format("batch_rows: {}", batch_rows));
+    AssertQueryBuilder(plan_node)
+        .config(core::QueryConfig::kTorchOperatorBatchRows, batch_rows)
+        .config(core::QueryConfig::kTorchOperatorMaxPendingBatches, 1)
+        .assertResults(expected);
+    AssertQueryBuilder(plan_node)
+        .config(core::QueryConfig::kTorchOperatorBatchRows, batch_rows)
+        .config(core::QueryConfig::kTorchOperatorNumThreads, 2)
+        .assertResults(expected);
+  }
+}
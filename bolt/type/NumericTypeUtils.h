@@ -29,6 +29,12 @@ class NumericTypeUtils {
         kind == TypeKind::INTEGER || kind == TypeKind::BIGINT;
   }
 
+  /// Returns true if 'type' has an integral kind and is not a short decimal,
+  /// which is stored as BIGINT.
+  static bool isIntegralType(const TypePtr& type) {
+    return !type->isDecimal() && isIntegralType(type->kind());
+  }
+
   /// Returns true if the type is a floating point type (REAL, DOUBLE)
   static constexpr bool isFloatingPointType(TypeKind kind) {
     return kind == TypeKind::REAL || kind == TypeKind::DOUBLE;
@@ -2043,6 +2043,52 @@ bool Like::testBloomFilter(
   return true;
 }
 
+bool Like::testBytes(const char* value, int32_t length) const {
+  // Matches greedily and backtracks to the last '%' on a mismatch.
+  const auto* pattern = pattern_.data();
+  const int32_t patternLength = pattern_.size();
+  int32_t p = 0;
+  int32_t v = 0;
+  int32_t lastPercent = -1;
+  int32_t lastPercentValue = 0;
+  auto nextChar = [&](int32_t pos) {
+    do {
+      ++pos;
+    } while (pos < length && (value[pos] & 0xC0) == 0x80);
+    return pos;
+  };
+  while (v < length) {
+    if (p < patternLength && pattern[p] == '%') {
+      lastPercent = p++;
+      lastPercentValue = v;
+      continue;
+    }
+    if (p < patternLength && pattern[p] == '_') {
+      ++p;
+      v = nextChar(v);
+      continue;
+    }
+    const auto literal =
+        p < patternLength && pattern[p] == '\\' && p + 1 < patternLength
+        ? p + 1
+        : p;
+    if (literal < patternLength && pattern[literal] == value[v]) {
+      p = literal + 1;
+      ++v;
+      continue;
+    }
+    if (lastPercent < 0) {
+      return false;
+    }
+    p = lastPercent + 1;
+    v = lastPercentValue = nextChar(lastPercentValue);
+  }
+  while (p < patternLength && pattern[p] == '%') {
+    ++p;
+  }
+  return p == patternLength;
+}
+
 std::unique_ptr<Filter> IsNull::mergeWith(const Filter* other) const {
   BOLT_CHECK(other->isDeterministic());
 
@@ -2145,13 +2145,14 @@ class Like final : public Filter {
   /// @param value value that pass the filter.
   /// @param nullAllowed Null value are passing the filter if true.
   Like(const std::string& value, bool nullAllowed)
-      : Filter(true, nullAllowed, FilterKind::kBytesLike) {
+      : Filter(true, nullAllowed, FilterKind::kBytesLike), pattern_(value) {
     value_ = ITokenExtractor::splitToStringVector(value.c_str(), value.size());
     BOLT_CHECK(value_.size() > 0, "value must not be empty");
   }
 
   Like(const Like& other, bool nullAllowed)
       : Filter(true, nullAllowed, FilterKind::kBytesLike),
+        pattern_(other.pattern_),
         value_(other.value_) {}
 
   std::unique_ptr<Filter> clone(
@@ -2168,6 +2169,17 @@ class Like final : public Filter {
           std::unique_ptr<struct NgramTokenExtractor>,
           std::unique_ptr<NGramBloomFilter>>>& token_bloom_filters) const final;
 
+  /// Matches 'value' against the pattern, where '%' matches any sequence of
+  /// characters, '_' matches one character and '\\' escapes the next one.
+  bool testBytes(const char* value, int32_t length) const final;
+
+  bool testBytesRange(
+      std::optional<std::string_view> /*min*/,
+      std::optional<std::string_view> /*max*/,
+      bool /*hasNull*/) const final {
+    return true;
+  }
+
   const std::vector<std::string>& value() const {
     return value_;
   }
@@ -2181,6 +2193,8 @@ class Like final : public Filter {
   }
 
  private:
+  const std::string pattern_;
+  // The literal parts of 'pattern_' between '%', longest first.
   std::vector<std::string> value_;
 };
 
@@ -2057,5 +2057,26 @@ TEST(FilterTest, timestampRange) {
       Timestamp(5, 123000000), Timestamp(30, 123000000), true));
 }
 
+TEST(FilterTest, like) {
+  auto filter = std::make_unique<common::Like>("%ab_d%", false);
+  EXPECT_FALSE(filter->testNull());
+  EXPECT_TRUE(filter->testBytes("abcd", 4));
+  EXPECT_TRUE(filter->testBytes("xxab\xc3\xa9" "dyy", 9));
+  EXPECT_TRUE(filter->testBytes("aababxd", 7));
+  EXPECT_FALSE(filter->testBytes("abd", 3));
+  EXPECT_FALSE(filter->testBytes("", 0));
+
+  filter = std::make_unique<common::Like>("a%c", false);
+  EXPECT_TRUE(filter->testBytes("ac", 2));
+  EXPECT_TRUE(filter->testBytes("abcbc", 5));
+  EXPECT_FALSE(filter->testBytes("abcb", 4));
+
+  filter = std::make_unique<common::Like>("%100\\%%", true);
+  EXPECT_TRUE(filter->testNull());
+  EXPECT_TRUE(filter->testBytes("is 100%", 7));
+  EXPECT_FALSE(filter->testBytes("is 1000", 7));
+  EXPECT_TRUE(filter->testBytesRange("a", "b", false));
+}
+
 } // namespace
 } // namespace bytedance::bolt
@@ -29,6 +29,8 @@
  */
 
 #include "bolt/vector/VectorPool.h"
+
+#include "bolt/vector/ComplexVector.h"
 namespace bytedance::bolt {
 
 namespace {
@@ -61,14 +63,88 @@ FOLLY_ALWAYS_INLINE int32_t toCacheIndex(const TypePtr& type) {
 
   return -1;
 }
+
+/// Returns true if vectors of 'type' can be recycled. prepareForReuse does not
+/// reset opaque and function values, and UNKNOWN vectors have no values.
+bool isSupportedType(const Type& type) {
+  switch (type.kind()) {
+    case TypeKind::UNKNOWN:
+    case TypeKind::FUNCTION:
+    case TypeKind::OPAQUE:
+    case TypeKind::INVALID:
+      return false;
+    default:
+      for (auto i = 0; i < type.size(); ++i) {
+        if (!isSupportedType(*type.childAt(i))) {
+          return false;
+        }
+      }
+      return true;
+  }
+}
+
+/// Returns true if 'vector' is recursively singly-referenced and has an
+/// encoding prepareForReuse keeps, i.e. a flat vector with an initialized
+/// values buffer or a ROW, ARRAY or MAP vector.
+bool isRecyclable(const BaseVector& vector) {
+  switch (vector.encoding()) {
+    case VectorEncoding::Simple::FLAT:
+      return vector.values() != nullptr && vector.isWritable();
+    case VectorEncoding::Simple::ROW:
+      if (dynamic_cast<const CompositeRowVector*>(&vector) != nullptr) {
+        return false;
+      }
+      for (const auto& child : vector.asUnchecked<RowVector>()->children()) {
+        if (child == nullptr) {
+          return false;
+        }
+      }
+      return vector.isWritable();
+    case VectorEncoding::Simple::ARRAY:
+    case VectorEncoding::Simple::MAP:
+      return vector.isWritable();
+    default:
+      return false;
+  }
+}
+
+bool isStringVector(const BaseVector& vector) {
+  return vector.isFlatEncoding() &&
+      (vector.typeKind() == TypeKind::VARCHAR ||
+       vector.typeKind() == TypeKind::VARBINARY);
+}
+
+/// Returns the capacity class of a string buffer, i.e. floor(log2(capacity /
+/// initial string buffer size)), or -1 if the buffer is too small or too
+/// large to cache.
+int32_t stringBufferClass(uint64_t capacity, int32_t numClasses) {
+  constexpr uint64_t kMinCapacity = FlatVector<StringView>::kInitialStringSize;
+  if (capacity < kMinCapacity ||
+      capacity > FlatVector<StringView>::kMaxStringSizeForReuse) {
+    return -1;
+  }
+  return std::min<int32_t>(
+      numClasses - 1, 63 - __builtin_clzll(capacity / kMinCapacity));
+}
 } // namespace
 
 VectorPtr VectorPool::get(const TypePtr& type, vector_size_t size) {
-  auto cacheIndex = toCacheIndex(type);
-  if (cacheIndex >= 0 && size <= kMaxRecycleSize) {
-    return vectors_[cacheIndex].pop(type, size, *pool_);
+  VectorPtr vector;
+  if (size <= kMaxRecycleSize) {
+    if (auto* cache = typePool(type)) {
+      vector = cache->pop(size);
+    }
+  }
+
+  auto& stats = stats_[static_cast<int32_t>(type->kind())];
+  if (vector != nullptr) {
+    ++stats.hits;
+  } else {
+    ++stats.misses;
+    vector = BaseVector::create(type, size, pool_);
   }
-  return BaseVector::create(type, size, pool_);
+  maybeAddStringBuffer(*vector);
+  return vector;
 }
 
 bool VectorPool::release(VectorPtr& vector) {
@@ -79,11 +155,13 @@ bool VectorPool::release(VectorPtr& vector) {
     return false;
   }
 
-  auto cacheIndex = toCacheIndex(vector->type());
-  if (cacheIndex < 0) {
+  auto* cache = typePool(vector->type());
+  if (cache == nullptr || !cache->hasSpace() || !isRecyclable(*vector)) {
     return false;
   }
-  return vectors_[cacheIndex].maybePushBack(vector);
+  cacheStringBuffers(*vector);
+  cache->push(vector);
+  return true;
 }
 
 size_t VectorPool::release(std::vector<VectorPtr>& vectors) {
@@ -98,47 +176,119 @@ size_t VectorPool::release(std::vector<VectorPtr>& vectors) {
   return numReleased;
 }
 
-bool VectorPool::TypePool::maybePushBack(VectorPtr& vector) {
-  // Check that this is a Flat Vector with an initialized, unique, and mutable
-  // values Buffer and an uninitialized or unique and mutable nulls Buffer.
-  if (!vector->isWritable() || !vector->isFlatEncoding() || !vector->values()) {
-    return false;
+VectorPool::TypePool* VectorPool::typePool(const TypePtr& type) {
+  const auto cacheIndex = toCacheIndex(type);
+  if (cacheIndex >= 0) {
+    return &vectors_[cacheIndex];
   }
-  if (size >= kNumPerType) {
-    return false;
+
+  for (auto& [cachedType, cache] : otherVectors_) {
+    if (cachedType.get() == type.get() || *cachedType == *type) {
+      return &cache;
+    }
   }
+  if (otherVectors_.size() >= kMaxOtherTypes || !isSupportedType(*type)) {
+    return nullptr;
+  }
+  return &otherVectors_.emplace_back(type, TypePool{}).second;
+}
+
+void VectorPool::cacheStringBuffers(BaseVector& vector) {
+  switch (vector.encoding()) {
+    case VectorEncoding::Simple::FLAT: {
+      if (!isStringVector(vector)) {
+        return;
+      }
+      // prepareForReuse keeps the first buffer with the vector and drops the
+      // others.
+      const auto& buffers =
+          vector.asUnchecked<FlatVector<StringView>>()->stringBuffers();
+      for (auto i = 1; i < buffers.size(); ++i) {
+        if (!buffers[i]->isMutable()) {
+          continue;
+        }
+        const auto bufferClass =
+            stringBufferClass(buffers[i]->capacity(), kNumStringBufferClasses);
+        if (bufferClass >= 0 &&
+            stringBuffers_[bufferClass].size() < kNumPerStringBufferClass) {
+          stringBuffers_[bufferClass].push_back(buffers[i]);
+        }
+      }
+      return;
+    }
+    case VectorEncoding::Simple::ROW:
+      for (const auto& child : vector.asUnchecked<RowVector>()->children()) {
+        cacheStringBuffers(*child);
+      }
+      return;
+    case VectorEncoding::Simple::ARRAY:
+      cacheStringBuffers(*vector.asUnchecked<ArrayVector>()->elements());
+      return;
+    case VectorEncoding::Simple::MAP:
+      cacheStringBuffers(*vector.asUnchecked<MapVector>()->mapKeys());
+      cacheStringBuffers(*vector.asUnchecked<MapVector>()->mapValues());
+      return;
+    default:
+      return;
+  }
+}
 
+void VectorPool::maybeAddStringBuffer(BaseVector& vector) {
+  if (!isStringVector(vector)) {
+    return;
+  }
+  auto* flatVector = vector.asUnchecked<FlatVector<StringView>>();
+  if (!flatVector->stringBuffers().empty()) {
+    return;
+  }
+  // The vector's string sizes are not known yet. The largest buffer saves
+  // the most allocations.
+  for (auto i = kNumStringBufferClasses - 1; i >= 0; --i) {
+    auto& buffers = stringBuffers_[i];
+    if (!buffers.empty()) {
+      auto buffer = std::move(buffers.back());
+      buffers.pop_back();
+      buffer->setSize(0);
+      flatVector->addStringBuffer(buffer);
+      ++numStringBufferHits_;
+      return;
+    }
+  }
+}
+
+void VectorPool::TypePool::push(VectorPtr& vector) {
   vector->prepareForReuse();
+  if (!vector->isFlatEncoding()) {
+    // prepareForReuse leaves the children of complex vectors empty. Emptying
+    // the vector as well makes 'pop' size the children back up.
+    vector->resize(0);
+  }
   vectors[size++] = std::move(vector);
-  return true;
 }
 
-VectorPtr VectorPool::TypePool::pop(
-    const TypePtr& type,
-    vector_size_t vectorSize,
-    memory::MemoryPool& pool) {
-  if (size) {
-    auto result = std::move(vectors[--size]);
-    if (UNLIKELY(result->rawNulls() != nullptr)) {
-      // This is a recyclable vector, no need to check uniqueness.
-      simd::memset(
-          const_cast<uint64_t*>(result->rawNulls()),
-          bits::kNotNullByte,
-          bits::roundUp(std::min<int32_t>(vectorSize, result->size()), 64) / 8);
-    }
-    if (UNLIKELY(
-            result->typeKind() == TypeKind::VARCHAR ||
-            result->typeKind() == TypeKind::VARBINARY)) {
-      simd::memset(
-          const_cast<void*>(result->valuesAsVoid()),
-          0,
-          std::min<int32_t>(vectorSize, result->size()) * sizeof(StringView));
-    }
-    if (result->size() != vectorSize) {
-      result->resize(vectorSize);
-    }
-    return result;
+VectorPtr VectorPool::TypePool::pop(vector_size_t vectorSize) {
+  if (size == 0) {
+    return nullptr;
+  }
+  auto result = std::move(vectors[--size]);
+  if (UNLIKELY(result->rawNulls() != nullptr)) {
+    // This is a recyclable vector, no need to check uniqueness.
+    simd::memset(
+        const_cast<uint64_t*>(result->rawNulls()),
+        bits::kNotNullByte,
+        bits::roundUp(std::min<int32_t>(vectorSize, result->size()), 64) / 8);
+  }
+  if (UNLIKELY(
+          result->typeKind() == TypeKind::VARCHAR ||
+          result->typeKind() == TypeKind::VARBINARY)) {
+    simd::memset(
+        const_cast<void*>(result->valuesAsVoid()),
+        0,
+        std::min<int32_t>(vectorSize, result->size()) * sizeof(StringView));
+  }
+  if (result->size() != vectorSize) {
+    result->resize(vectorSize);
   }
-  return BaseVector::create(type, vectorSize, &pool);
+  return result;
 }
 } // namespace bytedance::bolt
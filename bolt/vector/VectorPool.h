@@ -34,46 +34,91 @@
 #include "bolt/vector/FlatVector.h"
 namespace bytedance::bolt {
 
-/// A thread-level cache of pre-allocated flat vectors of different types.
-/// Keeps up to 10 recyclable vectors of each type. A vector is
-/// recyclable if it is flat and recursively singly-referenced.
-/// Only singleton built-in types are supported. Decimal types, fixed-size array
-/// type, complex and custom types are not supported. Calling 'get' for an
-/// unsupported type already returns a newly allocated vector. Calling 'release'
-/// for an unsupported type is a no-op.
+/// A thread-level cache of pre-allocated vectors of different types.
+/// Keeps up to 10 recyclable vectors of each type. A vector is recyclable if
+/// it is flat or a ROW, ARRAY or MAP vector and is recursively
+/// singly-referenced. Complex vectors are recycled together with their
+/// children and their offsets and sizes buffers.
+///
+/// Built-in singleton types are looked up by kind. Other types, e.g.
+/// decimal, complex and custom types, are looked up by equality, for up to
+/// 32 distinct types per pool. Types containing OPAQUE, FUNCTION or UNKNOWN
+/// are not supported. Calling 'get' for an unsupported type returns a newly
+/// allocated vector. Calling 'release' for an unsupported type is a no-op.
+///
+/// Released string vectors keep one string buffer for themselves. Their
+/// other string buffers are cached by capacity class and given to string
+/// vectors returned by 'get' that have no string buffer.
 class VectorPool {
  public:
+  struct TypeStats {
+    /// Number of 'get' calls served from the cache.
+    uint64_t hits{0};
+    /// Number of 'get' calls that allocated a new vector.
+    uint64_t misses{0};
+  };
+
   explicit VectorPool(memory::MemoryPool* pool) : pool_{pool} {}
 
   /// Gets a possibly recycled vector of 'type and 'size'. Allocates from
-  /// 'pool_' if no pre-allocated vector or type is a complex type.
+  /// 'pool_' if no pre-allocated vector or type is not supported.
   VectorPtr get(const TypePtr& type, vector_size_t size);
 
-  /// Moves vector into 'this' if it is flat, recursively singly referenced and
-  /// there is space. The function returns true if 'vector' is not null and has
-  /// been returned back to this pool, otherwise returns false.
+  /// Moves vector into 'this' if it is recyclable and there is space. The
+  /// function returns true if 'vector' is not null and has been returned back
+  /// to this pool, otherwise returns false.
   bool release(VectorPtr& vector);
 
   size_t release(std::vector<VectorPtr>& vectors);
 
+  /// Returns the hits and misses of 'get' for types of 'kind'.
+  const TypeStats& stats(TypeKind kind) const {
+    return stats_[static_cast<int32_t>(kind)];
+  }
+
+  /// Returns the number of cached string buffers given to vectors.
+  uint64_t numStringBufferHits() const {
+    return numStringBufferHits_;
+  }
+
  private:
   /// Max number of elements for a vector to be recyclable. The larger
   /// the batch the less the win from recycling.
   static constexpr vector_size_t kMaxRecycleSize = 64 * 1024;
   static constexpr int32_t kNumPerType = 10;
+  static constexpr int32_t kMaxOtherTypes = 32;
+
+  /// String buffers are cached in power of two capacity classes from
+  /// FlatVector's initial string buffer size up to the largest size it
+  /// reuses, 32KB to 1MB.
+  static constexpr int32_t kNumStringBufferClasses = 6;
+  static constexpr int32_t kNumPerStringBufferClass = 4;
 
   struct TypePool {
     int32_t size{0};
     std::array<VectorPtr, kNumPerType> vectors;
 
-    bool maybePushBack(VectorPtr& vector);
+    bool hasSpace() const {
+      return size < kNumPerType;
+    }
 
-    VectorPtr pop(
-        const TypePtr& type,
-        vector_size_t vectorSize,
-        memory::MemoryPool& pool);
+    void push(VectorPtr& vector);
+
+    VectorPtr pop(vector_size_t vectorSize);
   };
 
+  /// Returns the cache for 'type' or nullptr if 'type' is not supported. Adds
+  /// a cache for a type that is not a built-in singleton if there is room.
+  TypePool* typePool(const TypePtr& type);
+
+  /// Moves the string buffers 'vector' and its children do not keep on reuse
+  /// to 'stringBuffers_'.
+  void cacheStringBuffers(BaseVector& vector);
+
+  /// Gives a cached string buffer to 'vector' if it is a string vector
+  /// without string buffers.
+  void maybeAddStringBuffer(BaseVector& vector);
+
   memory::MemoryPool* const pool_;
 
   static constexpr int32_t kNumCachedVectorTypes =
@@ -81,6 +126,15 @@ class VectorPool {
 
   /// Caches of pre-allocated vectors indexed by typeKind.
   std::array<TypePool, kNumCachedVectorTypes> vectors_;
+
+  /// Caches of pre-allocated vectors of other types.
+  std::vector<std::pair<TypePtr, TypePool>> otherVectors_;
+
+  /// Cached string buffers by capacity class.
+  std::array<std::vector<BufferPtr>, kNumStringBufferClasses> stringBuffers_;
+
+  std::array<TypeStats, static_cast<int32_t>(TypeKind::INVALID) + 1> stats_;
+  uint64_t numStringBufferHits_{0};
 };
 
 /// A simple vector ptr wrapper with an associated vector pool. It releases
@@ -165,4 +165,103 @@ TEST_F(VectorPoolTest, customTypes) {
   ASSERT_EQ(1'000, vector->size());
   ASSERT_TRUE(isJsonType(vector->type()));
 }
+
+TEST_F(VectorPoolTest, complexTypes) {
+  VectorPool vectorPool(pool());
+  const auto type =
+      ROW({"a", "b", "c"},
+          {BIGINT(), ARRAY(VARCHAR()), MAP(INTEGER(), DECIMAL(20, 2))});
+
+  auto vector = vectorPool.get(type, 1'000);
+  ASSERT_EQ(1'000, vector->size());
+  auto* rowVector = vector->asUnchecked<RowVector>();
+  ASSERT_EQ(1'000, rowVector->childAt(0)->size());
+  ASSERT_EQ(1'000, rowVector->childAt(1)->size());
+  auto* elements =
+      rowVector->childAt(1)->asUnchecked<ArrayVector>()->elements().get();
+  elements->resize(3'000);
+  auto* rawPtr = vector.get();
+
+  ASSERT_TRUE(vectorPool.release(vector));
+  ASSERT_EQ(vector, nullptr);
+  ASSERT_EQ(1, vectorPool.stats(TypeKind::ROW).misses);
+
+  // An equal type that is a different instance finds the recycled vector.
+  // The children come back with the requested size and the array elements
+  // are empty.
+  vector = vectorPool.get(
+      ROW({"a", "b", "c"},
+          {BIGINT(), ARRAY(VARCHAR()), MAP(INTEGER(), DECIMAL(20, 2))}),
+      500);
+  ASSERT_EQ(rawPtr, vector.get());
+  ASSERT_EQ(1, vectorPool.stats(TypeKind::ROW).hits);
+  rowVector = vector->asUnchecked<RowVector>();
+  ASSERT_EQ(500, rowVector->childAt(0)->size());
+  ASSERT_EQ(500, rowVector->childAt(2)->size());
+  auto* arrayVector = rowVector->childAt(1)->asUnchecked<ArrayVector>();
+  ASSERT_EQ(elements, arrayVector->elements().get());
+  ASSERT_EQ(0, elements->size());
+  for (auto i = 0; i < 500; ++i) {
+    ASSERT_EQ(0, arrayVector->sizeAt(i));
+    ASSERT_FALSE(vector->isNullAt(i));
+  }
+
+  // Different field names make a different type.
+  auto other = vectorPool.get(
+      ROW({"x", "y", "z"},
+          {BIGINT(), ARRAY(VARCHAR()), MAP(INTEGER(), DECIMAL(20, 2))}),
+      500);
+  ASSERT_NE(rawPtr, other.get());
+  ASSERT_EQ(2, vectorPool.stats(TypeKind::ROW).misses);
+
+  // A vector with a shared child is not recycled.
+  auto child = rowVector->childAt(0);
+  ASSERT_FALSE(vectorPool.release(vector));
+  child.reset();
+
+  // Decimals are recycled by precision and scale.
+  auto decimals = vectorPool.get(DECIMAL(10, 2), 100);
+  rawPtr = decimals.get();
+  ASSERT_TRUE(vectorPool.release(decimals));
+  ASSERT_NE(rawPtr, vectorPool.get(DECIMAL(10, 3), 100).get());
+  ASSERT_EQ(rawPtr, vectorPool.get(DECIMAL(10, 2), 100).get());
+
+  // Types with opaque values are not supported.
+  auto opaque = vectorPool.get(OPAQUE<int>(), 100);
+  ASSERT_FALSE(vectorPool.release(opaque));
+}
+
+TEST_F(VectorPoolTest, stringBuffers) {
+  VectorPool vectorPool(pool());
+
+  // Fill a string vector with enough long strings to need several buffers.
+  auto vector = vectorPool.get(VARCHAR(), 1'000);
+  auto* flatVector = vector->asFlatVector<StringView>();
+  const std::string value(1'000, 'x');
+  for (auto i = 0; i < 1'000; ++i) {
+    flatVector->set(i, StringView(value));
+  }
+  const auto numBuffers = flatVector->stringBuffers().size();
+  ASSERT_GT(numBuffers, 2);
+  std::unordered_set<const Buffer*> buffers;
+  for (const auto& buffer : flatVector->stringBuffers()) {
+    buffers.insert(buffer.get());
+  }
+
+  // The recycled vector keeps its first buffer. The other buffers go to new
+  // string vectors.
+  ASSERT_TRUE(vectorPool.release(vector));
+  vector = vectorPool.get(VARCHAR(), 1'000);
+  ASSERT_EQ(1, vector->asFlatVector<StringView>()->stringBuffers().size());
+  ASSERT_EQ(0, vectorPool.numStringBufferHits());
+
+  auto json = vectorPool.get(JSON(), 1'000);
+  const auto& jsonBuffers = json->asFlatVector<StringView>()->stringBuffers();
+  ASSERT_EQ(1, jsonBuffers.size());
+  ASSERT_EQ(1, buffers.count(jsonBuffers[0].get()));
+  ASSERT_EQ(0, jsonBuffers[0]->size());
+  ASSERT_EQ(1, vectorPool.numStringBufferHits());
+  ASSERT_EQ(1, vectorPool.stats(TypeKind::VARCHAR).hits);
+  ASSERT_EQ(2, vectorPool.stats(TypeKind::VARCHAR).misses);
+}
 } // namespace bytedance::bolt::test